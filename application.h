@@ -30,11 +30,15 @@
  * 
  * REVISIONS and CHANGES 
  * 20/02/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Visit function for a contiguous range of nodes.
+ * 14/10/2026  V0.3  Per thread clones of an application.
+ * 14/10/2026  V0.4  Raw access to the coordinates of the nodes.
  * 
  * ============================================================================
  */
 
 #include <ostream>
+#include <memory>
 
 #ifndef _OPTIMIZEXX_APPLICATION_H_
 #define _OPTIMIZEXX_APPLICATION_H_
@@ -55,7 +59,13 @@ namespace optimize
    *
    * If creating a concrete parameter space visitor by inheritance from this
    * base abstract base class you must take care that your visitor application
-   * works completely thread safe.
+   * works completely thread safe.\n
+   *
+   * Alternatively an application might provide a clone() function. Then each
+   * worker of a thread pool visits nodes with its own clone of the
+   * application (e.g. owning its own scratch buffers) and the clones are
+   * merged into the original application by means of merge() after the
+   * computation had finished.
    *
    * \ingroup group_applications
    */
@@ -70,6 +80,45 @@ namespace optimize
       //! Abstract visit function for a node.
       //! \param grid Node to be visited.
       virtual void operator()(Node<Ctype, CresultData>* node) = 0; 
+      /*!
+       * Visit function for a contiguous range of nodes.\n
+       * Global algorithms dispatching batches of nodes call this function. By
+       * default the nodes are visited one after another. Override this
+       * function if an application is able to process a batch of nodes at
+       * once (e.g. to vectorize a forward model across the nodes).
+       *
+       * \param begin Pointer to the first node of the range.
+       * \param end Pointer past the last node of the range.
+       */
+      virtual void operator()(Node<Ctype, CresultData>** begin,
+          Node<Ctype, CresultData>** end)
+      {
+        for (; begin != end; ++begin) { operator()(*begin); }
+      }
+      /*! 
+       * Create a copy of the application for a worker thread.\n
+       * Notice that here the
+       * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
+       * Virtual_Constructor"> Virtual Constructor idiom</a> had been
+       * applied. By default no clone is created so that all workers share
+       * the application.
+       *
+       * \return unique pointer to the clone - empty if the application can't
+       * be cloned
+       */
+      virtual std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+        clone() const
+      {
+        return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>();
+      }
+      /*!
+       * Merge the state of a clone into the application. Called once for
+       * each clone after the computation had finished. Does nothing by
+       * default.
+       *
+       * \param clone clone created by clone()
+       */
+      virtual void merge(ParameterSpaceVisitor<Ctype, CresultData>& clone) { }
       //! destructor
       virtual ~ParameterSpaceVisitor() { }
     protected:
@@ -117,10 +166,10 @@ namespace optimize
   void GridCoordinateDataVisitor<Ctype,CresultData>::operator()(
       Node<Ctype,CresultData>* node)
   {
-    for (auto cit = node->getCoordinates().cbegin();
-        cit != node->getCoordinates().cend(); ++cit)
+    Ctype const* coordinates = node->getCoordinateData();
+    for (size_t d = 0; d < node->getDimensions(); ++d)
     {
-      Mos << *cit << " ";
+      Mos << coordinates[d] << " ";
     }
     Mos << "\n";
   }
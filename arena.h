@@ -0,0 +1,260 @@
+/*! \file arena.h
+ * \brief Arenas for the grid components of a parameter space.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Arenas for the grid components of a parameter space.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Reuse of deallocated memory.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_ARENA_H_
+#define _OPTIMIZEXX_ARENA_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Abstract base class of an arena grid components of a parameter space are
+   * allocated from.\n
+   *
+   * An arena is owned by the root grid of a parameter space and shared with
+   * its subgrids (see optimize::Grid::getArena). Grid components created by
+   * means of optimize::GridComponent::create only are destructed when they
+   * are removed from their grid. The memory is released in bulk as soon as
+   * the arena is destroyed. Memory might be handed back to an arena for
+   * reuse by means of deallocate() (see optimize::GridComponent::recycle).
+   *
+   * \note Arenas are not thread safe.
+   *
+   * \ingroup group_grid
+   */
+  class Arena
+  {
+    public:
+      //! destructor
+      virtual ~Arena() { }
+      /*!
+       * allocate memory
+       *
+       * \param bytes number of bytes
+       * \param alignment alignment of the memory - must be a power of two
+       * \return pointer to the memory allocated
+       */
+      virtual void* allocate(size_t const bytes, size_t const alignment) = 0;
+      /*!
+       * Hand back memory allocated from the arena so that it might be reused
+       * by an allocation of the same size and alignment. Does nothing by
+       * default, i.e. the memory is released as soon as the arena is
+       * destroyed.
+       *
+       * \param memory memory allocated by allocate()
+       * \param bytes number of bytes passed to allocate()
+       * \param alignment alignment passed to allocate()
+       */
+      virtual void deallocate(void* memory, size_t const bytes,
+          size_t const alignment)
+      { }
+
+    protected:
+      //! constructor
+      Arena() { }
+
+    private:
+      //! copy constructor - not implemented
+      Arena(Arena const&);
+      //! assignment operator - not implemented
+      Arena& operator=(Arena const&);
+
+  }; // class Arena
+
+  /* ======================================================================= */
+  /*!
+   * Arena allocating memory in large blocks. Memory is handed out
+   * sequentially so that an allocation just moves a pointer.\n
+   *
+   * Deallocated memory is kept within free lists, one for each pair of size
+   * and alignment, and handed out again before the current block is
+   * consumed further. So a parameter space replacing nodes (e.g. when being
+   * rebuilt after its parameters had changed) does not grow the arena. The
+   * free lists are intrusive, i.e. deallocating does not allocate any
+   * memory (apart from a new pair of size and alignment). Memory which is
+   * never deallocated is released when the arena is destroyed.
+   *
+   * \ingroup group_grid
+   */
+  class MonotonicArena : public Arena
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param block_size size of a memory block in bytes
+       */
+      MonotonicArena(size_t block_size = 1 << 20) : Mcurrent(0), Mend(0),
+        MblockSize(block_size)
+      {
+        OPTIMIZE_assert(0 < MblockSize, "Illegal block size.");
+      }
+      //! destructor
+      virtual ~MonotonicArena() { }
+      /*!
+       * allocate memory
+       *
+       * \param bytes number of bytes
+       * \param alignment alignment of the memory - must be a power of two
+       * \return pointer to the memory allocated
+       */
+      virtual void* allocate(size_t const bytes, size_t const alignment);
+      /*!
+       * Hand back memory for reuse.
+       *
+       * \param memory memory allocated by allocate()
+       * \param bytes number of bytes passed to allocate()
+       * \param alignment alignment passed to allocate()
+       */
+      virtual void deallocate(void* memory, size_t const bytes,
+          size_t const alignment);
+      //! query function for the number of memory blocks
+      size_t getBlockCount() const { return Mblocks.size(); }
+      //! query function for the number of deallocated memory slots
+      size_t getFreeCount() const;
+
+    private:
+      //! free list of deallocated memory of a certain size and alignment
+      struct FreeList
+      {
+        //! size of the memory slots
+        size_t Mbytes;
+        //! alignment of the memory slots
+        size_t Malignment;
+        //! first slot - each slot stores a pointer to the next one
+        void* Mhead;
+        //! number of slots
+        size_t Msize;
+      }; // struct FreeList
+
+    private:
+      //! free lists of deallocated memory
+      std::vector<FreeList> MfreeLists;
+      //! memory blocks
+      std::vector<std::unique_ptr<char[]>> Mblocks;
+      //! next free byte of the current block
+      char* Mcurrent;
+      //! end of the current block
+      char* Mend;
+      //! size of a memory block in bytes
+      size_t MblockSize;
+
+  }; // class MonotonicArena
+
+  /* ======================================================================= */
+  inline void* MonotonicArena::allocate(size_t const bytes,
+      size_t const alignment)
+  {
+    // reuse deallocated memory first
+    for (auto it(MfreeLists.begin()); it != MfreeLists.end(); ++it)
+    {
+      if (it->Mbytes == bytes && it->Malignment == alignment && it->Mhead)
+      {
+        void* memory = it->Mhead;
+        it->Mhead = *static_cast<void**>(memory);
+        --it->Msize;
+        return memory;
+      }
+    }
+    std::uintptr_t const mask = alignment-1;
+    std::uintptr_t pos = (reinterpret_cast<std::uintptr_t>(Mcurrent)+mask) &
+      ~mask;
+    if (0 == Mcurrent || pos+bytes > reinterpret_cast<std::uintptr_t>(Mend))
+    {
+      // start a new block (large requests get a block on their own)
+      size_t const size = std::max(MblockSize, bytes+alignment);
+      Mblocks.push_back(std::unique_ptr<char[]>(new char[size]));
+      Mcurrent = Mblocks.back().get();
+      Mend = Mcurrent + size;
+      pos = (reinterpret_cast<std::uintptr_t>(Mcurrent)+mask) & ~mask;
+    }
+    Mcurrent = reinterpret_cast<char*>(pos+bytes);
+    return reinterpret_cast<void*>(pos);
+  } // function MonotonicArena::allocate
+
+  /* ----------------------------------------------------------------------- */
+  inline void MonotonicArena::deallocate(void* memory, size_t const bytes,
+      size_t const alignment)
+  {
+    // a slot must be able to store the link to the next one
+    if (0 == memory || bytes < sizeof(void*) ||
+        alignment < std::alignment_of<void*>::value)
+    {
+      return;
+    }
+    auto it(MfreeLists.begin());
+    while (it != MfreeLists.end() &&
+        (it->Mbytes != bytes || it->Malignment != alignment))
+    {
+      ++it;
+    }
+    if (MfreeLists.end() == it)
+    {
+      FreeList const list = { bytes, alignment, 0, 0 };
+      it = MfreeLists.insert(MfreeLists.end(), list);
+    }
+    *static_cast<void**>(memory) = it->Mhead;
+    it->Mhead = memory;
+    ++it->Msize;
+  } // function MonotonicArena::deallocate
+
+  /* ----------------------------------------------------------------------- */
+  inline size_t MonotonicArena::getFreeCount() const
+  {
+    size_t num = 0;
+    for (auto cit(MfreeLists.cbegin()); cit != MfreeLists.cend(); ++cit)
+    {
+      num += cit->Msize;
+    }
+    return num;
+  } // function MonotonicArena::getFreeCount
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF arena.h  ----- */
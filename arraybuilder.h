@@ -0,0 +1,185 @@
+/*! \file arraybuilder.h
+ * \brief Builder of a parameter space storing its data in contiguous arrays.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Builder of a parameter space storing its data in contiguous arrays.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <optimizexx/builder.h>
+#include <optimizexx/arraygrid.h>
+#include <optimizexx/error.h>
+ 
+#ifndef _OPTIMIZEXX_ARRAYBUILDER_H_
+#define _OPTIMIZEXX_ARRAYBUILDER_H_
+
+namespace optimize
+{
+  // forward declarations
+  template <typename Ctype, typename CresultData> class GridComponent;
+  template <typename Ctype> class Parameter;
+
+  /* ======================================================================= */
+  /*!
+   * Concrete builder class template for an array parameter space. Note,
+   * that here the builder design pattern is in use (GoF p.97).
+   *
+   * This builder builds an optimize::ArrayGrid which covers the same grid
+   * points in the same order as a parameter space built by
+   * optimize::StandardParameterSpaceBuilder but stores coordinates and
+   * results in contiguous columns rather than in node objects.
+   *
+   * Additionally the builder design pattern is in use (GoF p.151). The
+   * class template corresponds to \c RefinedAbstraction in GoF.
+   *
+   * \ingroup group_builder
+   */
+  template<typename Ctype, typename CresultData>
+  class ArrayParameterSpaceBuilder : 
+      public ParameterSpaceBuilder<Ctype, CresultData>
+  {
+    public:
+      typedef ParameterSpaceBuilder<Ctype, CresultData> Tbase;
+
+    public:
+      //! constructor
+#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
+      ArrayParameterSpaceBuilder() : Tbase(nullptr)
+#else
+      ArrayParameterSpaceBuilder()
+#endif
+      { }
+      /*!
+       * query function for order of parameters the builder will generate the
+       * parameter space grid
+       *
+       * \param dims number of dimensions of the parameter space
+       * \return vector containing the order
+       */
+      virtual std::vector<int> getParameterOrder(size_t const dims) const;
+      //! Create an instance of a parameter space.
+      virtual void buildParameterSpace();
+      /*!
+       * Build a \c N dimensional array grid where \c N is the size of the
+       * parameter vector passed.
+       *
+       * \param parameters Parameters of the parameter space.
+       */
+      virtual void buildGrid(
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters);
+      //! destructor
+      virtual ~ArrayParameterSpaceBuilder() { }
+      /*!
+       * Query function for the array parameter space.
+       *
+       * \return The parameter space built by the builder.
+       */
+      virtual typename
+        std::unique_ptr<GridComponent<Ctype, CresultData>> getParameterSpace();
+
+  }; // class ArrayParameterSpaceBuilder
+
+  /* ======================================================================= */
+  template<typename Ctype, typename CresultData> 
+  void ArrayParameterSpaceBuilder<Ctype, CresultData>::buildParameterSpace()
+  {
+    Tbase::MparameterSpace.reset(new ArrayGrid<Ctype, CresultData>); 
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData> 
+  std::vector<int> 
+  ArrayParameterSpaceBuilder<Ctype, CresultData>::getParameterOrder(
+      size_t const dims) const
+  {
+    std::vector<int> retval(dims);
+    for (size_t i = 0; i < dims; ++i) { retval[i] = i; }
+    return retval;
+  } // function ArrayParameterSpaceBuilder::getParameterOrder
+
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData> 
+  void ArrayParameterSpaceBuilder<Ctype, CresultData>::buildGrid(
+      typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+      parameters)
+  {
+    ArrayGrid<Ctype, CresultData>* grid =
+      dynamic_cast<ArrayGrid<Ctype, CresultData>*>(
+          Tbase::MparameterSpace.get());
+    OPTIMIZE_assert(0 != grid, "Missing array parameter space.");
+
+    // coordinate ids of parameter space
+    std::vector<std::string> coordIds;
+    coordIds.reserve(parameters.size());
+    for (auto cit(parameters.cbegin()); cit != parameters.cend(); ++cit)
+    {
+      OPTIMIZE_assert((*cit)->isValid(), "Invalid parameter");
+      if (! (*cit)->getId().empty())
+      {
+        coordIds.push_back((*cit)->getId());
+      } else
+      {
+        coordIds.push_back("Unkown");
+      }
+      // generate samples
+      size_t const samples = (*cit)->getSamples();
+      typename ArrayGrid<Ctype, CresultData>::Tcolumn column;
+      column.reserve(samples);
+      Ctype val = (*cit)->getStart();
+      for (size_t s = 0; s < samples; ++s)
+      {
+        column.push_back(val);
+        val += (*cit)->getDelta();
+      }
+      grid->addDimension(column);
+    }
+    grid->setCoordinateId(coordIds);
+  } // function ArrayParameterSpaceBuilder<Ctype, CresultData>::buildGrid 
+
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData> 
+  typename std::unique_ptr<GridComponent<Ctype,CresultData>>
+  ArrayParameterSpaceBuilder<Ctype, CresultData>::getParameterSpace()
+  {
+    return std::move(Tbase::MparameterSpace);
+  }
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF arraybuilder.h  ----- */
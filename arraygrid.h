@@ -0,0 +1,299 @@
+/*! \file arraygrid.h
+ * \brief Parameter space grid storing coordinates and results in contiguous
+ * arrays.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Parameter space grid storing coordinates and results in contiguous
+ * arrays.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Aligned columns passed to batch applications.
+ * 14/10/2026  V0.2  Assignment of scattered grid points.
+ * 14/10/2026  V0.3  Gather if grid points already computed are skipped.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <algorithm>
+#include <optimizexx/indexedgrid.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_ARRAYGRID_H_
+#define _OPTIMIZEXX_ARRAYGRID_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Structured parameter space grid storing its data in a structure of
+   * arrays.\n
+   *
+   * The coordinates of the grid points are kept in one contiguous column per
+   * dimension, the result data in an additional result column. Grid points
+   * are addressed by their linear index and visited by means of flyweight
+   * nodes (optimize::IndexedNode) which pass the result data set by an
+   * application to the result column. Post-processing the results (e.g.
+   * searching the minimum or exporting the results) streams through the
+   * columns then instead of chasing node pointers.\n
+   *
+   * The coordinate columns are aligned (see optimize::CoordinateBlock) so
+   * that batch applications (optimize::BatchParameterSpaceVisitor) are passed
+   * spans of the columns without copying any coordinates.\n
+   *
+   * Results of different grid points may be set concurrently.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData>
+  class ArrayGrid : public IndexedGrid<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef IndexedGrid<Ctype, CresultData> Tbase; 
+      //! typedef for coordinates
+      typedef typename Tbase::Tcoordinates Tcoordinates;
+      //! typedef for a coordinate column
+      typedef typename std::vector<Ctype, AlignedAllocator<Ctype,
+        CoordinateBlock<Ctype, CresultData>::Malignment>> Tcolumn;
+      //! typedef for the result column
+      typedef typename std::vector<CresultData> TresultColumn;
+
+    public:
+      //! constructor
+      ArrayGrid() : Msize(1) { }
+      //! destructor
+      virtual ~ArrayGrid() { }
+      /*!
+       * Append a dimension to the grid. Existing result data is discarded.
+       *
+       * \param samples sample values of the dimension
+       */
+      void addDimension(Tcolumn const& samples);
+      /*!
+       * Assign the grid points. In contrast to addDimension() the grid points
+       * need not to form a regular lattice (e.g. when loading a parameter
+       * space which had been refined).
+       *
+       * \param columns coordinate columns - one for each dimension
+       * \param results result column
+       * \param computed computed flags of the grid points
+       */
+      void assign(std::vector<Tcolumn> columns, TresultColumn results,
+          std::vector<char> computed);
+      //! query function for the number of grid points
+      virtual size_t size() const { return Mcolumns.empty() ? 0 : Msize; }
+      //! query function for the number of dimensions
+      virtual size_t getDimensions() const { return Mcolumns.size(); }
+      /*!
+       * Query the coordinates of a grid point.
+       *
+       * \param index linear index of the grid point
+       * \param coordinates vector the coordinates are written to
+       */
+      virtual void getCoordinatesAt(size_t const index,
+          Tcoordinates& coordinates) const;
+      //! query function for the result data of a grid point
+      virtual CresultData getResultDataAt(size_t const index) const
+      {
+        OPTIMIZE_assert(index < size(), "Index out of range.");
+        return Mresults[index];
+      }
+      //! Set the result data of a grid point.
+      virtual void setResultDataAt(size_t const index,
+          CresultData const& data)
+      {
+        OPTIMIZE_assert(index < size(), "Index out of range.");
+        Mresults[index] = data;
+      }
+      //! query function if the grid point had been computed
+      virtual bool isComputedAt(size_t const index) const
+      {
+        OPTIMIZE_assert(index < size(), "Index out of range.");
+        return MisComputed[index];
+      }
+      //! Set the computed flag of a grid point.
+      virtual void setComputedAt(size_t const index)
+      {
+        OPTIMIZE_assert(index < size(), "Index out of range.");
+        MisComputed[index] = true;
+      }
+      /*!
+       * query function for a coordinate column
+       *
+       * \param dim dimension of the column
+       * \return coordinates of all grid points in this dimension
+       */
+      Tcolumn const& getColumn(size_t const dim) const
+      {
+        OPTIMIZE_assert(dim < Mcolumns.size(), "Illegal dimension.");
+        return Mcolumns[dim];
+      }
+      //! query function for the result column
+      TresultColumn const& getResultColumn() const { return Mresults; }
+      /*!
+       * Apply a batch application to a range of grid points. The blocks refer
+       * to the columns of the grid directly. Grid points preceding the first
+       * aligned grid point of the range are gathered. If the application
+       * skips grid points already computed (see
+       * BatchParameterSpaceVisitor::skipsComputed) the whole range is
+       * gathered.
+       *
+       * \param v batch application
+       * \param first linear index of the first grid point
+       * \param last linear index past the last grid point
+       */
+      virtual void visitRange(
+          BatchParameterSpaceVisitor<Ctype, CresultData>& v, size_t first,
+          size_t const last);
+
+    private:
+      //! coordinate columns - one for each dimension
+      std::vector<Tcolumn> Mcolumns;
+      //! result column
+      TresultColumn Mresults;
+      /*!
+       * computed flags of the grid points\n
+       * Note that std::vector<bool> is not used since flags of different grid
+       * points might be set concurrently.
+       */
+      std::vector<char> MisComputed;
+      //! number of grid points
+      size_t Msize;
+
+  }; // class template ArrayGrid
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void ArrayGrid<Ctype, CresultData>::addDimension(Tcolumn const& samples)
+  {
+    OPTIMIZE_assert(0 < samples.size(), "Illegal number of samples.");
+    size_t const num = Mcolumns.empty() ? 1 : Msize;
+    Msize = num*samples.size();
+
+    // the first coordinate varies fastest - repeat existing columns
+    for (auto it(Mcolumns.begin()); it != Mcolumns.end(); ++it)
+    {
+      it->reserve(Msize);
+      for (size_t s = 1; s < samples.size(); ++s)
+      {
+        it->insert(it->end(), it->begin(), it->begin()+num);
+      }
+    }
+    Tcolumn column;
+    column.reserve(Msize);
+    for (auto cit(samples.cbegin()); cit != samples.cend(); ++cit)
+    {
+      column.insert(column.end(), num, *cit);
+    }
+    Mcolumns.push_back(column);
+
+    Mresults.assign(Msize, CresultData());
+    MisComputed.assign(Msize, false);
+    Tbase::Mcomputed = false;
+  } // function ArrayGrid<Ctype, CresultData>::addDimension
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void ArrayGrid<Ctype, CresultData>::assign(std::vector<Tcolumn> columns,
+      TresultColumn results, std::vector<char> computed)
+  {
+    OPTIMIZE_assert(! columns.empty(), "Missing coordinate columns.");
+    Msize = columns.front().size();
+    for (auto cit(columns.cbegin()); cit != columns.cend(); ++cit)
+    {
+      OPTIMIZE_assert(cit->size() == Msize, "Illegal column size.");
+    }
+    OPTIMIZE_assert(results.size() == Msize && computed.size() == Msize,
+        "Illegal column size.");
+    Mcolumns.swap(columns);
+    Mresults.swap(results);
+    MisComputed.swap(computed);
+    Tbase::Mcomputed = false;
+  } // function ArrayGrid<Ctype, CresultData>::assign
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void ArrayGrid<Ctype, CresultData>::getCoordinatesAt(size_t const index,
+      Tcoordinates& coordinates) const
+  {
+    OPTIMIZE_assert(index < size(), "Index out of range.");
+    coordinates.resize(Mcolumns.size());
+    for (size_t d = 0; d < Mcolumns.size(); ++d)
+    {
+      coordinates[d] = Mcolumns[d][index];
+    }
+  } // function ArrayGrid<Ctype, CresultData>::getCoordinatesAt
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void ArrayGrid<Ctype, CresultData>::visitRange(
+      BatchParameterSpaceVisitor<Ctype, CresultData>& v, size_t first,
+      size_t const last)
+  {
+    OPTIMIZE_assert(first <= last && last <= size(), "Index out of range.");
+    if (v.skipsComputed())
+    {
+      Tbase::visitRange(v, first, last);
+      return;
+    }
+    // number of coordinates per aligned line
+    size_t const per_line = std::max<size_t>(1,
+        CoordinateBlock<Ctype, CresultData>::Malignment/sizeof(Ctype));
+    size_t const aligned = std::min(last,
+        (first+per_line-1)/per_line*per_line);
+    Tbase::visitRange(v, first, aligned);
+
+    // blocks of multiple lines keep the following blocks aligned
+    size_t const block_size =
+      (v.getBlockSize()+per_line-1)/per_line*per_line;
+    std::vector<Ctype const*> columns(Mcolumns.size());
+    for (first = aligned; first != last; )
+    {
+      size_t const num = std::min(block_size, last-first);
+      for (size_t d = 0; d < Mcolumns.size(); ++d)
+      {
+        columns[d] = Mcolumns[d].data() + first;
+      }
+      v(CoordinateBlock<Ctype, CresultData>(num, columns.data(),
+            columns.size(), Mresults.data() + first));
+      std::fill(MisComputed.begin()+first, MisComputed.begin()+first+num,
+          true);
+      first += num;
+    }
+  } // function ArrayGrid<Ctype, CresultData>::visitRange
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF arraygrid.h  ----- */
@@ -0,0 +1,439 @@
+/*! \file batchapplication.h
+ * \brief Batch applications visiting blocks of contiguous coordinates.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Batch applications visiting blocks of contiguous coordinates.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Gather single nodes on the stack; decorators forwarding
+ *                   blocks.
+ * 14/10/2026  V0.3  Raw access to the coordinates of the nodes.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <cstdlib>
+#include <optimizexx/application.h>
+#include <optimizexx/node.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_BATCHAPPLICATION_H_
+#define _OPTIMIZEXX_BATCHAPPLICATION_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * STL allocator returning memory aligned to \a Calignment bytes (e.g. for
+   * coordinate columns which are loaded by SIMD instructions).
+   *
+   * \ingroup group_applications
+   */
+  template <typename T, size_t Calignment=64>
+  class AlignedAllocator
+  {
+    public:
+      typedef T value_type;
+      typedef T* pointer;
+      typedef T const* const_pointer;
+      typedef T& reference;
+      typedef T const& const_reference;
+      typedef size_t size_type;
+      typedef std::ptrdiff_t difference_type;
+      //! rebind the allocator to another type
+      template <typename U> struct rebind
+      {
+        typedef AlignedAllocator<U, Calignment> other;
+      };
+
+    public:
+      //! constructor
+      AlignedAllocator() { }
+      //! converting constructor
+      template <typename U>
+      AlignedAllocator(AlignedAllocator<U, Calignment> const&) { }
+      //! allocate memory for \a n objects
+      pointer allocate(size_type const n, void const* = 0)
+      {
+        void* ptr = 0;
+        if (0 != posix_memalign(&ptr, Calignment,
+              std::max<size_type>(1, n)*sizeof(T)))
+        {
+          throw std::bad_alloc();
+        }
+        return static_cast<pointer>(ptr);
+      }
+      //! release memory
+      void deallocate(pointer p, size_type) { std::free(p); }
+      //! construct an object
+      void construct(pointer p, const_reference val) { new (p) T(val); }
+      //! destroy an object
+      void destroy(pointer p) { p->~T(); }
+      //! query function for the maximum number of objects
+      size_type max_size() const
+      {
+        return std::numeric_limits<size_type>::max()/sizeof(T);
+      }
+      //! query function for the address of an object
+      pointer address(reference x) const { return &x; }
+      //! query function for the address of an object
+      const_pointer address(const_reference x) const { return &x; }
+
+  }; // class template AlignedAllocator
+
+  //! aligned allocators are interchangeable
+  template <typename T, typename U, size_t Calignment>
+  bool operator==(AlignedAllocator<T, Calignment> const&,
+      AlignedAllocator<U, Calignment> const&) { return true; }
+  //! aligned allocators are interchangeable
+  template <typename T, typename U, size_t Calignment>
+  bool operator!=(AlignedAllocator<T, Calignment> const&,
+      AlignedAllocator<U, Calignment> const&) { return false; }
+
+  /* ======================================================================= */
+  /*!
+   * Block of grid points passed to an optimize::BatchParameterSpaceVisitor.
+   * \n
+   *
+   * The coordinates of the grid points are provided in structure of arrays
+   * layout i.e. as one contiguous span per dimension. Each coordinate span
+   * starts at an address aligned to \c Malignment bytes. The application
+   * writes the result data of the grid points to the result span. Both the
+   * coordinate spans and the result span have getSize() elements.
+   *
+   * \ingroup group_applications
+   */
+  template <typename Ctype, typename CresultData>
+  class CoordinateBlock
+  {
+    public:
+      //! alignment of the coordinate spans in bytes
+      static size_t const Malignment = 64;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param size number of grid points
+       * \param columns pointers to the coordinate spans - one for each
+       * dimension
+       * \param dims number of dimensions
+       * \param results result span
+       */
+      CoordinateBlock(size_t const size, Ctype const* const* columns,
+          size_t const dims, CresultData* results) : Msize(size),
+          Mcolumns(columns), Mdims(dims), Mresults(results)
+      { }
+      //! query function for the number of grid points
+      size_t getSize() const { return Msize; }
+      //! query function for the number of dimensions
+      size_t getDimensions() const { return Mdims; }
+      /*!
+       * query function for a coordinate span
+       *
+       * \param dim dimension of the span
+       * \return aligned pointer to the coordinates of the grid points in this
+       * dimension
+       */
+      Ctype const* getColumn(size_t const dim) const
+      {
+        OPTIMIZE_assert(dim < Mdims, "Illegal dimension.");
+        return Mcolumns[dim];
+      }
+      //! query function for the writable result span
+      CresultData* getResults() const { return Mresults; }
+
+    private:
+      //! number of grid points
+      size_t Msize;
+      //! coordinate spans
+      Ctype const* const* Mcolumns;
+      //! number of dimensions
+      size_t Mdims;
+      //! result span
+      CresultData* Mresults;
+
+  }; // class template CoordinateBlock
+
+  /* ======================================================================= */
+  /*!
+   * Aligned scratch memory gathering the coordinates of grid points which are
+   * not stored in structure of arrays layout.
+   *
+   * \ingroup group_applications
+   */
+  template <typename Ctype, typename CresultData>
+  class BlockBuffer
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param dims number of dimensions
+       * \param capacity maximum number of grid points of a block
+       */
+      BlockBuffer(size_t const dims, size_t const capacity);
+      //! query function for the writable coordinate span of a dimension
+      Ctype* getColumn(size_t const dim)
+      {
+        return Mcoordinates.data() + dim*Mstride;
+      }
+      //! query function for the result span
+      CresultData* getResults() { return Mresults.data(); }
+      //! query function for the maximum number of grid points of a block
+      size_t getCapacity() const { return Mresults.size(); }
+      /*!
+       * query function for a block of the buffer
+       *
+       * \param size number of grid points gathered
+       */
+      CoordinateBlock<Ctype, CresultData> getBlock(size_t const size) const
+      {
+        OPTIMIZE_assert(size <= getCapacity(), "Illegal block size.");
+        return CoordinateBlock<Ctype, CresultData>(size, Mcolumns.data(),
+            Mcolumns.size(), const_cast<CresultData*>(Mresults.data()));
+      }
+
+    private:
+      //! not copyable
+      BlockBuffer(BlockBuffer const&);
+      //! not assignable
+      BlockBuffer& operator=(BlockBuffer const&);
+
+    private:
+      //! distance of the coordinate spans in number of coordinates
+      size_t Mstride;
+      //! coordinate spans
+      std::vector<Ctype, AlignedAllocator<Ctype,
+        CoordinateBlock<Ctype, CresultData>::Malignment>> Mcoordinates;
+      //! pointers to the coordinate spans
+      std::vector<Ctype const*> Mcolumns;
+      //! result span
+      std::vector<CresultData> Mresults;
+
+  }; // class template BlockBuffer
+
+  /* ======================================================================= */
+  /*!
+   * Abstract class template for applications computing blocks of grid
+   * points at once.\n
+   *
+   * Scalar applications are visited node by node and read the coordinates of
+   * each node by means of Node::getCoordinates(). A batch application instead
+   * is visited with blocks (optimize::CoordinateBlock) providing aligned and
+   * contiguous coordinate spans for each dimension and a writable result
+   * span. Thus the forward model runs in a tight loop over the grid points
+   * which the compiler is able to auto-vectorize (or which is implemented by
+   * means of explicit SIMD instructions).\n
+   *
+   * Grid points of an optimize::ArrayGrid are passed without copying since
+   * the grid already stores its coordinates in structure of arrays layout.
+   * The coordinates of other nodes are gathered block by block into scratch
+   * memory and the results are scattered to the nodes afterwards. The grid
+   * points of a block are marked as computed.\n
+   *
+   * The decorators of the global algorithms (instrumentation, result cache
+   * and incremental executions) are batch applications themselves if the
+   * decorated application is one, so that blocks are forwarded. Decorators
+   * skipping grid points already computed report so by skipsComputed().
+   *
+   * \note The pruning visitor of optimize::GridSearch visits nodes one by
+   * one. A batch application decorated by it gets blocks consisting of a
+   * single grid point which is gathered on the stack.
+   *
+   * \ingroup group_applications
+   */
+  template <typename Ctype, typename CresultData>
+  class BatchParameterSpaceVisitor :
+    public ParameterSpaceVisitor<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef ParameterSpaceVisitor<Ctype, CresultData> Tbase;
+      using Tbase::operator();
+
+    public:
+      //! destructor
+      virtual ~BatchParameterSpaceVisitor() { }
+      /*!
+       * Abstract visit function for a block of grid points.
+       *
+       * \param block block to be computed - the result data of each grid
+       * point has to be written to the result span
+       */
+      virtual void operator()(CoordinateBlock<Ctype, CresultData> const&
+          block) = 0;
+      /*!
+       * Visit function for a grid.
+       * Does nothing by default.
+       */
+      virtual void operator()(Grid<Ctype, CresultData>* grid) { }
+      /*!
+       * Visit function for a node - computes a block of a single node. The
+       * coordinates of nodes with up to \c MmaxInlineDimensions dimensions
+       * are gathered to aligned memory on the stack.
+       */
+      virtual void operator()(Node<Ctype, CresultData>* node);
+      /*!
+       * Visit function for a contiguous range of nodes. Gathers the
+       * coordinates of the nodes block by block.
+       *
+       * \param begin Pointer to the first node of the range.
+       * \param end Pointer past the last node of the range.
+       */
+      virtual void operator()(Node<Ctype, CresultData>** begin,
+          Node<Ctype, CresultData>** end);
+      //! set the maximum number of grid points of a block
+      void setBlockSize(size_t const size)
+      {
+        OPTIMIZE_assert(0 < size, "Illegal value.");
+        MblockSize = size;
+      }
+      //! query function for the maximum number of grid points of a block
+      size_t getBlockSize() const { return MblockSize; }
+      /*!
+       * query function if grid points already computed must not be passed
+       * to the application (e.g. incremental executions)
+       */
+      virtual bool skipsComputed() const { return false; }
+
+    protected:
+      //! constructor
+      BatchParameterSpaceVisitor() : MblockSize(256) { }
+
+    private:
+      //! maximum number of dimensions of a node gathered on the stack
+      static size_t const MmaxInlineDimensions = 16;
+
+    private:
+      //! maximum number of grid points of a block
+      size_t MblockSize;
+
+  }; // class template BatchParameterSpaceVisitor
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  BlockBuffer<Ctype, CresultData>::BlockBuffer(size_t const dims,
+      size_t const capacity) : Mstride(capacity), Mresults(capacity)
+  {
+    // each coordinate span starts aligned
+    size_t const per_line = std::max<size_t>(1,
+        CoordinateBlock<Ctype, CresultData>::Malignment/sizeof(Ctype));
+    Mstride = (capacity+per_line-1)/per_line*per_line;
+    Mcoordinates.resize(dims*Mstride);
+    for (size_t d = 0; d < dims; ++d)
+    {
+      Mcolumns.push_back(Mcoordinates.data() + d*Mstride);
+    }
+  } // function BlockBuffer<Ctype, CresultData>::BlockBuffer
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  size_t const BatchParameterSpaceVisitor<Ctype, CresultData>::
+    MmaxInlineDimensions;
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void BatchParameterSpaceVisitor<Ctype, CresultData>::operator()(
+      Node<Ctype, CresultData>* node)
+  {
+    size_t const alignment = CoordinateBlock<Ctype, CresultData>::Malignment;
+    size_t const dims = node->getDimensions();
+    if (MmaxInlineDimensions < dims || alignment < sizeof(Ctype) ||
+        ! std::is_trivial<Ctype>::value)
+    {
+      operator()(&node, &node+1);
+      return;
+    }
+    // each coordinate starts an aligned line
+    typename std::aligned_storage<MmaxInlineDimensions*alignment,
+             alignment>::type memory;
+    Ctype* const lines = reinterpret_cast<Ctype*>(&memory);
+    size_t const per_line = alignment/sizeof(Ctype);
+    Ctype const* columns[MmaxInlineDimensions];
+    Ctype const* const coordinates = node->getCoordinateData();
+    for (size_t d = 0; d < dims; ++d)
+    {
+      lines[d*per_line] = coordinates[d];
+      columns[d] = lines + d*per_line;
+    }
+    CresultData result = CresultData();
+    operator()(CoordinateBlock<Ctype, CresultData>(1, columns, dims,
+          &result));
+    node->setResultData(result);
+    node->setComputed();
+  } // function BatchParameterSpaceVisitor<Ctype, CresultData>::operator()
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void BatchParameterSpaceVisitor<Ctype, CresultData>::operator()(
+      Node<Ctype, CresultData>** begin, Node<Ctype, CresultData>** end)
+  {
+    if (begin == end) { return; }
+    size_t const dims = (*begin)->getDimensions();
+    BlockBuffer<Ctype, CresultData> buffer(dims,
+        std::min<size_t>(MblockSize, end-begin));
+
+    while (begin != end)
+    {
+      size_t const size = std::min<size_t>(buffer.getCapacity(), end-begin);
+      // gather
+      for (size_t i = 0; i < size; ++i)
+      {
+        OPTIMIZE_assert(begin[i]->getDimensions() == dims,
+            "Dimension mismatch.");
+        Ctype const* c = begin[i]->getCoordinateData();
+        for (size_t d = 0; d < dims; ++d) { buffer.getColumn(d)[i] = c[d]; }
+      }
+      operator()(buffer.getBlock(size));
+      // scatter
+      CresultData const* results = buffer.getResults();
+      for (size_t i = 0; i < size; ++i)
+      {
+        begin[i]->setResultData(results[i]);
+        begin[i]->setComputed();
+      }
+      begin += size;
+    }
+  } // function BatchParameterSpaceVisitor<Ctype, CresultData>::operator()
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF batchapplication.h  ----- */
@@ -0,0 +1,491 @@
+/*! \file binaryio.h
+ * \brief Binary export and import of a parameter space.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Binary export and import of a parameter space.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Writing the header separately.
+ * 14/10/2026  V0.3  Raw access to the coordinates of the nodes.
+ * 
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <istream>
+#include <ostream>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <optimizexx/gridcomponent.h>
+#include <optimizexx/node.h>
+#include <optimizexx/parameter.h>
+#include <optimizexx/arraygrid.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_BINARYIO_H_
+#define _OPTIMIZEXX_BINARYIO_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Description of a parameter space stored in binary format.
+   */
+  template <typename Ctype>
+  struct BinaryGridInfo
+  {
+    //! number of grid points (nodes)
+    std::uint64_t MnumPoints;
+    //! parameters the parameter space had been built of
+    std::vector<std::shared_ptr<Parameter<Ctype> const>> Mparameters;
+    //! coordinate ids
+    std::vector<std::string> McoordinateIds;
+    //! offset in bytes of the first coordinate column
+    std::uint64_t MdataOffset;
+  }; // struct BinaryGridInfo
+
+  /* ======================================================================= */
+  /*!
+   * Compact binary format of a computed parameter space.\n
+   *
+   * A header holds the coordinate ids and the definitions of the parameters
+   * (id, unit, start, end and delta). It is followed by packed columns: one
+   * coordinate column for each dimension, the result column and the column
+   * of computed flags. Nodes are stored in the order a node iterator (e.g.
+   * optimize::ForwardNodeIter) traverses the parameter space. Every column
+   * starts at an offset which is a multiple of 64 bytes so that the file may
+   * be mapped into memory (see optimize::MappedGrid).\n
+   *
+   * Exporting a parameter space does not require any memory per node.
+   * Importing rebuilds the parameter space as an optimize::ArrayGrid without
+   * running a builder. A parameter space containing subgrids is flattened.
+   *
+   * \note Coordinates and result data must be plain old data since columns
+   * are copied bytewise. Data is stored in the native byte order.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData>
+  class BinaryFormat
+  {
+    static_assert(std::is_pod<Ctype>::value &&
+        std::is_pod<CresultData>::value,
+        "BinaryFormat requires plain old data.");
+
+    public:
+      /*!
+       * Export a parameter space.
+       *
+       * \param os binary output stream
+       * \param space parameter space
+       * \param parameters parameters the parameter space had been built of
+       */
+      static void write(std::ostream& os,
+          GridComponent<Ctype, CresultData> const& space,
+          std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+            parameters);
+      /*!
+       * Write the header of a parameter space in binary format. The columns
+       * have to be written at the offsets of the returned header information
+       * afterwards (e.g. by optimize::BinarySink).
+       *
+       * \param os binary output stream
+       * \param parameters parameters the parameter space had been built of
+       * \param num_points number of grid points
+       * \return header information
+       */
+      static BinaryGridInfo<Ctype> writeHeader(std::ostream& os,
+          std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+            parameters, std::uint64_t const num_points);
+      /*!
+       * Import a parameter space.
+       *
+       * \param is binary input stream
+       * \param parameters if not null the parameters the parameter space had
+       * been built of are written to this vector
+       * \return parameter space
+       */
+      static std::unique_ptr<ArrayGrid<Ctype, CresultData>> read(
+          std::istream& is,
+          std::vector<std::shared_ptr<Parameter<Ctype> const>>* parameters =
+            0);
+      /*!
+       * Read the header of a parameter space in binary format.
+       *
+       * \param is binary input stream positioned at the beginning of the data
+       * \return header information
+       */
+      static BinaryGridInfo<Ctype> readHeader(std::istream& is);
+      //! query function for the offset of the coordinate column \a dim
+      static std::uint64_t getColumnOffset(BinaryGridInfo<Ctype> const& info,
+          size_t const dim)
+      {
+        return info.MdataOffset + dim*align(info.MnumPoints*sizeof(Ctype));
+      }
+      //! query function for the offset of the result column
+      static std::uint64_t getResultOffset(BinaryGridInfo<Ctype> const& info)
+      {
+        return getColumnOffset(info, info.Mparameters.size());
+      }
+      //! query function for the offset of the column of computed flags
+      static std::uint64_t getComputedOffset(
+          BinaryGridInfo<Ctype> const& info)
+      {
+        return getResultOffset(info) +
+          align(info.MnumPoints*sizeof(CresultData));
+      }
+      //! query function for the size of the data in bytes
+      static std::uint64_t getSize(BinaryGridInfo<Ctype> const& info)
+      {
+        return getComputedOffset(info) + info.MnumPoints;
+      }
+
+    private:
+      //! fixed size part of the header
+      struct Header
+      {
+        //! file identifier
+        char Mmagic[8];
+        //! version of the format
+        std::uint32_t Mversion;
+        //! size of a coordinate in bytes
+        std::uint32_t McoordinateSize;
+        //! size of the result data in bytes
+        std::uint32_t MresultSize;
+        //! number of dimensions
+        std::uint32_t Mdimensions;
+        //! number of grid points
+        std::uint64_t MnumPoints;
+        //! offset of the first coordinate column
+        std::uint64_t MdataOffset;
+      }; // struct Header
+
+      //! alignment of the columns in bytes
+      static std::uint64_t const Malignment = 64;
+      //! number of values written at once if exporting a parameter space
+      static size_t const MbufferSize = 4096;
+
+    private:
+      //! round up \a bytes to the alignment of the columns
+      static std::uint64_t align(std::uint64_t const bytes)
+      {
+        return (bytes + Malignment-1) / Malignment * Malignment;
+      }
+      //! write \a bytes bytes and keep track of the position
+      static void writeRaw(std::ostream& os, void const* data,
+          std::uint64_t const bytes, std::uint64_t& pos)
+      {
+        os.write(static_cast<char const*>(data), bytes);
+        pos += bytes;
+      }
+      //! write zeros up to the next aligned position
+      static void writePadding(std::ostream& os, std::uint64_t& pos)
+      {
+        static char const zeros[Malignment] = { };
+        writeRaw(os, zeros, align(pos)-pos, pos);
+      }
+      //! write a string (length followed by the characters)
+      static void writeString(std::ostream& os, std::string const& str,
+          std::uint64_t& pos)
+      {
+        std::uint32_t const length = str.size();
+        writeRaw(os, &length, sizeof(length), pos);
+        writeRaw(os, str.data(), length, pos);
+      }
+      //! read \a bytes bytes and keep track of the position
+      static void readRaw(std::istream& is, void* data,
+          std::uint64_t const bytes, std::uint64_t& pos)
+      {
+        is.read(static_cast<char*>(data), bytes);
+        OPTIMIZE_assert(is.good(), "Corrupt binary parameter space.");
+        pos += bytes;
+      }
+      //! read a string
+      static std::string readString(std::istream& is, std::uint64_t& pos);
+      //! fill in the fixed size part of the header
+      static void initHeader(Header& header);
+
+  }; // class template BinaryFormat
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  std::uint64_t const BinaryFormat<Ctype, CresultData>::Malignment;
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  size_t const BinaryFormat<Ctype, CresultData>::MbufferSize;
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void BinaryFormat<Ctype, CresultData>::initHeader(Header& header)
+  {
+    std::memset(&header, 0, sizeof(Header));
+    std::strncpy(header.Mmagic, "OXXGRID", sizeof(header.Mmagic));
+    header.Mversion = 1;
+    header.McoordinateSize = sizeof(Ctype);
+    header.MresultSize = sizeof(CresultData);
+  } // function BinaryFormat<Ctype, CresultData>::initHeader
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void BinaryFormat<Ctype, CresultData>::write(std::ostream& os,
+      GridComponent<Ctype, CresultData> const& space,
+      std::vector<std::shared_ptr<Parameter<Ctype> const>> const& parameters)
+  {
+    size_t const dims = parameters.size();
+    OPTIMIZE_assert(0 < dims, "Missing parameters.");
+    Iterator<Ctype, CresultData> iter(
+        space.createIterator(ForwardNodeIter));
+    ArrayGrid<Ctype, CresultData> const* array_grid =
+      dynamic_cast<ArrayGrid<Ctype, CresultData> const*>(&space);
+
+    std::uint64_t num_points = array_grid ? array_grid->size() : 0;
+    if (! array_grid)
+    {
+      for (iter.first(); !iter.isDone(); ++iter)
+      {
+        Node<Ctype, CresultData> const* node =
+          static_cast<Node<Ctype, CresultData> const*>(*iter);
+        OPTIMIZE_assert(node->getDimensions() == dims,
+            "Illegal number of coordinates.");
+        ++num_points;
+      }
+    }
+
+    BinaryGridInfo<Ctype> const info(writeHeader(os, parameters, num_points));
+    std::uint64_t pos = info.MdataOffset;
+
+    if (array_grid)
+    {
+      // columns are already packed
+      for (size_t d = 0; d < dims; ++d)
+      {
+        writeRaw(os, array_grid->getColumn(d).data(),
+            num_points*sizeof(Ctype), pos);
+        writePadding(os, pos);
+      }
+      writeRaw(os, array_grid->getResultColumn().data(),
+          num_points*sizeof(CresultData), pos);
+      writePadding(os, pos);
+      for (size_t i = 0; i < num_points; ++i)
+      {
+        char const computed = array_grid->isComputedAt(i);
+        writeRaw(os, &computed, 1, pos);
+      }
+    } else
+    {
+      // pack a column after another by means of a buffer
+      std::vector<Ctype> coordinates;
+      coordinates.reserve(MbufferSize);
+      for (size_t d = 0; d < dims; ++d)
+      {
+        for (iter.first(); !iter.isDone(); ++iter)
+        {
+          coordinates.push_back(static_cast<Node<Ctype, CresultData> const*>(
+                *iter)->getCoordinateData()[d]);
+          if (MbufferSize == coordinates.size())
+          {
+            writeRaw(os, coordinates.data(), MbufferSize*sizeof(Ctype), pos);
+            coordinates.clear();
+          }
+        }
+        writeRaw(os, coordinates.data(), coordinates.size()*sizeof(Ctype),
+            pos);
+        coordinates.clear();
+        writePadding(os, pos);
+      }
+
+      std::vector<CresultData> results;
+      results.reserve(MbufferSize);
+      for (iter.first(); !iter.isDone(); ++iter)
+      {
+        results.push_back((*iter)->getResultData());
+        if (MbufferSize == results.size())
+        {
+          writeRaw(os, results.data(), MbufferSize*sizeof(CresultData), pos);
+          results.clear();
+        }
+      }
+      writeRaw(os, results.data(), results.size()*sizeof(CresultData), pos);
+      writePadding(os, pos);
+
+      std::vector<char> computed;
+      computed.reserve(MbufferSize);
+      for (iter.first(); !iter.isDone(); ++iter)
+      {
+        computed.push_back((*iter)->isComputed());
+        if (MbufferSize == computed.size())
+        {
+          writeRaw(os, computed.data(), MbufferSize, pos);
+          computed.clear();
+        }
+      }
+      writeRaw(os, computed.data(), computed.size(), pos);
+    }
+    OPTIMIZE_assert(os.good(), "Unable to write binary parameter space.");
+  } // function BinaryFormat<Ctype, CresultData>::write
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  BinaryGridInfo<Ctype> BinaryFormat<Ctype, CresultData>::writeHeader(
+      std::ostream& os,
+      std::vector<std::shared_ptr<Parameter<Ctype> const>> const& parameters,
+      std::uint64_t const num_points)
+  {
+    OPTIMIZE_assert(0 < parameters.size(), "Missing parameters.");
+    Header header;
+    initHeader(header);
+    header.Mdimensions = parameters.size();
+    header.MnumPoints = num_points;
+    // size of the variable part of the header
+    std::uint64_t pos = sizeof(Header);
+    for (auto cit(parameters.cbegin()); cit != parameters.cend(); ++cit)
+    {
+      pos += 2*sizeof(std::uint32_t) + (*cit)->getId().size() +
+        (*cit)->getUnit().size() + 3*sizeof(Ctype);
+    }
+    header.MdataOffset = align(pos);
+
+    BinaryGridInfo<Ctype> info;
+    info.MnumPoints = num_points;
+    info.Mparameters = parameters;
+    info.MdataOffset = header.MdataOffset;
+
+    pos = 0;
+    writeRaw(os, &header, sizeof(Header), pos);
+    for (auto cit(parameters.cbegin()); cit != parameters.cend(); ++cit)
+    {
+      writeString(os, (*cit)->getId(), pos);
+      writeString(os, (*cit)->getUnit(), pos);
+      Ctype const values[] = { (*cit)->getStart(), (*cit)->getEnd(),
+        (*cit)->getDelta() };
+      writeRaw(os, values, sizeof(values), pos);
+      info.McoordinateIds.push_back(
+          (*cit)->getId().empty() ? "Unkown" : (*cit)->getId());
+    }
+    writePadding(os, pos);
+    return info;
+  } // function BinaryFormat<Ctype, CresultData>::writeHeader
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::string BinaryFormat<Ctype, CresultData>::readString(std::istream& is,
+      std::uint64_t& pos)
+  {
+    std::uint32_t length = 0;
+    readRaw(is, &length, sizeof(length), pos);
+    std::string str(length, '\0');
+    if (0 < length) { readRaw(is, &str[0], length, pos); }
+    return str;
+  } // function BinaryFormat<Ctype, CresultData>::readString
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  BinaryGridInfo<Ctype> BinaryFormat<Ctype, CresultData>::readHeader(
+      std::istream& is)
+  {
+    Header expected;
+    initHeader(expected);
+    Header header;
+    std::uint64_t pos = 0;
+    readRaw(is, &header, sizeof(Header), pos);
+    OPTIMIZE_assert(0 == std::memcmp(header.Mmagic, expected.Mmagic,
+          sizeof(header.Mmagic)) && header.Mversion == expected.Mversion,
+        "Not a binary parameter space.");
+    OPTIMIZE_assert(header.McoordinateSize == expected.McoordinateSize &&
+        header.MresultSize == expected.MresultSize,
+        "Binary parameter space of different data types.");
+
+    BinaryGridInfo<Ctype> info;
+    info.MnumPoints = header.MnumPoints;
+    info.MdataOffset = header.MdataOffset;
+    for (std::uint32_t d = 0; d < header.Mdimensions; ++d)
+    {
+      std::string const id = readString(is, pos);
+      std::string const unit = readString(is, pos);
+      Ctype values[3];
+      readRaw(is, values, sizeof(values), pos);
+      info.Mparameters.push_back(std::shared_ptr<Parameter<Ctype> const>(
+            new StandardParameter<Ctype>(id, values[0], values[1], values[2],
+              unit)));
+      info.McoordinateIds.push_back(id.empty() ? "Unkown" : id);
+    }
+    OPTIMIZE_assert(pos <= info.MdataOffset,
+        "Corrupt binary parameter space.");
+    // skip padding
+    is.ignore(info.MdataOffset-pos);
+    return info;
+  } // function BinaryFormat<Ctype, CresultData>::readHeader
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ArrayGrid<Ctype, CresultData>>
+  BinaryFormat<Ctype, CresultData>::read(std::istream& is,
+      std::vector<std::shared_ptr<Parameter<Ctype> const>>* parameters)
+  {
+    BinaryGridInfo<Ctype> const info(readHeader(is));
+    size_t const num = info.MnumPoints;
+    std::uint64_t pos = info.MdataOffset;
+
+    std::vector<typename ArrayGrid<Ctype, CresultData>::Tcolumn> columns(
+        info.Mparameters.size());
+    for (auto it(columns.begin()); it != columns.end(); ++it)
+    {
+      it->resize(num);
+      if (0 < num) { readRaw(is, it->data(), num*sizeof(Ctype), pos); }
+      is.ignore(align(pos)-pos);
+      pos = align(pos);
+    }
+    typename ArrayGrid<Ctype, CresultData>::TresultColumn results(num);
+    if (0 < num) { readRaw(is, results.data(), num*sizeof(CresultData), pos); }
+    is.ignore(align(pos)-pos);
+    pos = align(pos);
+    std::vector<char> computed(num);
+    if (0 < num) { readRaw(is, computed.data(), num, pos); }
+
+    std::unique_ptr<ArrayGrid<Ctype, CresultData>> grid(
+        new ArrayGrid<Ctype, CresultData>);
+    grid->assign(std::move(columns), std::move(results),
+        std::move(computed));
+    grid->setCoordinateId(info.McoordinateIds);
+    if (parameters) { *parameters = info.Mparameters; }
+    return grid;
+  } // function BinaryFormat<Ctype, CresultData>::read
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF binaryio.h  ----- */
@@ -31,6 +31,9 @@
  * REVISIONS and CHANGES 
  * 20/02/2012   V0.1    Daniel Armbruster
  * 25/04/2012   V0.2    Make use of smart pointers and C++0x.
+ * 14/10/2026   V0.3    Build subgrids of an arbitrary grid.
+ * 14/10/2026   V0.4    Incremental rebuild of a parameter space.
+ * 14/10/2026   V0.5    Builders might share the thread pool of an algorithm.
  * 
  * ============================================================================
  */
@@ -45,6 +48,12 @@
 
 namespace optimize
 {
+  namespace thread
+  {
+    // forward declaration
+    template <typename Ctype, typename CresultData> class ThreadPool;
+  } // namespace thread
+
   /* ======================================================================= */
   //! \defgroup group_builder builder modul
   /*!
@@ -99,6 +108,53 @@ namespace optimize
           typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
           parameters)
       { }
+      /*!
+       * Function to build a subgrid and to add it to a grid of an already
+       * existing parameter space (e.g. to refine the parameter space locally).
+       * The subgrid is the last child of \c grid then. Iterators over the
+       * children of \c grid are invalidated (see optimize::Grid).
+       * Does nothing by default.
+       *
+       * \param grid grid the subgrid will be added to
+       * \param parameters parameters for the subgrid.
+       */
+      virtual void buildSubGrid(GridComponent<Ctype, CresultData>* grid,
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters)
+      { }
+      /*!
+       * Hand over a persistent thread pool (see
+       * optimize::GlobalAlgorithm::setThreadPool) to a builder constructing
+       * nodes in parallel. Does nothing by default.
+       *
+       * \param pool initialized thread pool constructed without an
+       * application - empty if the builder has to create a pool of its own
+       */
+      virtual void setThreadPool(
+          std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool)
+      { }
+      /*!
+       * Rebuild the grid of an already existing parameter space after its
+       * parameters had been changed (e.g. a range had been widened or the
+       * number of samples had been increased). Nodes whose coordinates are
+       * samples of the new parameters are kept together with their result
+       * data, only the nodes missing are created. Nodes not being samples
+       * of the new parameters anymore are destroyed.
+       * Does nothing by default.
+       *
+       * \param parameterspace parameter space to be rebuilt
+       * \param parameters new parameters of the parameter space
+       *
+       * \return false if the parameter space can't be rebuilt incrementally
+       * in which case it is left untouched
+       */
+      virtual bool rebuildGrid(
+          GridComponent<Ctype, CresultData>* parameterspace,
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters)
+      {
+        return false;
+      }
       //! destructor
       virtual ~ParameterSpaceBuilder() { }
       /*!
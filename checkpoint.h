@@ -0,0 +1,324 @@
+/*! \file checkpoint.h
+ * \brief Checkpoint files of results of a parameter space.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Checkpoint files of results of a parameter space.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Progress reporting.
+ * 
+ * ============================================================================
+ */
+
+#include <string>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <optimizexx/gridcomponent.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/threadpool.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_CHECKPOINT_H_
+#define _OPTIMIZEXX_CHECKPOINT_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Memory mapped checkpoint file of the results of a parameter space.\n
+   *
+   * The file is index addressed. The index of a node is its position within
+   * the parameter space if iterating with a node iterator (e.g.
+   * optimize::ForwardNodeIter). For each node the file holds a record of its
+   * result data and its computed flag. Results are written to the mapped
+   * memory as soon as a node had been computed and flushed to disk
+   * asynchronously range by range (flush()) so workers do not wait for the
+   * disk.\n
+   *
+   * If a checkpoint file already exists it is reattached. Then restore()
+   * writes the results stored back to the parameter space and marks the
+   * nodes as computed so algorithms are able to skip them.
+   *
+   * \note The result data type must be plain old data since the records are
+   * copied bytewise. A checkpoint file is only portable between machines of
+   * the same architecture.
+   */
+  template <typename CresultData>
+  class Checkpoint
+  {
+    static_assert(std::is_pod<CresultData>::value,
+        "Checkpoint requires plain old data as result data.");
+
+    public:
+      /*!
+       * constructor\n
+       * Creates the checkpoint file if it does not exist yet.
+       *
+       * \param filename name of the checkpoint file
+       * \param num_nodes number of nodes of the parameter space
+       */
+      Checkpoint(std::string const& filename, size_t num_nodes);
+      //! query function for the number of nodes
+      size_t size() const { return Msize; }
+      //! query function if the node with index \a index had been computed
+      bool isComputedAt(size_t const index) const
+      {
+        return Mrecords[index].Mcomputed;
+      }
+      //! query function for the result data of node with index \a index
+      CresultData const& getResultDataAt(size_t const index) const
+      {
+        return Mrecords[index].MresultData;
+      }
+      /*!
+       * store the result data of the node with index \a index and mark the
+       * node as computed\n
+       * Different threads might store the results of different nodes
+       * concurrently.
+       */
+      void setResultDataAt(size_t const index, CresultData const& data)
+      {
+        Mrecords[index].MresultData = data;
+        Mrecords[index].Mcomputed = true;
+      }
+      /*!
+       * Write the results of the nodes from \a first up to \a last to disk.
+       * The function returns without waiting for the disk.
+       *
+       * \param first index of the first node
+       * \param last index past the last node
+       */
+      void flush(size_t const first, size_t const last);
+      //! write all results to disk and wait until the data had been written
+      void sync() { Mregion.flush(0, 0, false); }
+      /*!
+       * Write the results stored back to the nodes of the parameter space and
+       * mark those nodes as computed.
+       *
+       * \param iter node iterator of the parameter space
+       * \return number of nodes restored
+       */
+      template <typename Ctype>
+      size_t restore(Iterator<Ctype, CresultData>& iter) const;
+
+    private:
+      //! file header
+      struct Header
+      {
+        //! file identifier
+        char Mmagic[8];
+        //! number of nodes
+        std::uint64_t Msize;
+        //! size of a record in bytes
+        std::uint64_t MrecordSize;
+      }; // struct Header
+
+      //! record of a node
+      struct Record
+      {
+        //! result data of the node
+        CresultData MresultData;
+        //! computed flag
+        char Mcomputed;
+      }; // struct Record
+
+      //! size of the file header in bytes (keeps the records aligned)
+      static size_t const MheaderSize = 64;
+
+    private:
+      //! number of nodes
+      size_t Msize;
+      //! mapping of the checkpoint file
+      boost::interprocess::file_mapping Mfile;
+      //! mapped memory region
+      boost::interprocess::mapped_region Mregion;
+      //! records of the nodes
+      Record* Mrecords;
+
+  }; // class template Checkpoint
+
+  namespace thread
+  {
+    /* ===================================================================== */
+    /*!
+     * Thread pool task applying an application to a range of nodes and
+     * storing the results into a checkpoint. Nodes already computed
+     * according to the checkpoint are skipped.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData>
+    class CheckpointTask : public Task<Ctype, CresultData>
+    {
+      public:
+        /*!
+         * constructor
+         *
+         * \param iter random access node iterator of the parameter space
+         * \param first index of the first node of the range
+         * \param last index past the last node of the range
+         * \param checkpoint checkpoint the results are stored into
+         */
+        CheckpointTask(Iterator<Ctype, CresultData> const& iter,
+            size_t first, size_t last, Checkpoint<CresultData>* checkpoint) :
+          Miter(iter), Mfirst(first), Mlast(last), Mcheckpoint(checkpoint)
+        { }
+        //! destructor
+        virtual ~CheckpointTask() { }
+        //! apply an application to the range of nodes
+        virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app);
+        //! query function for the number of nodes of the task
+        virtual size_t getSize() const { return Mlast-Mfirst; }
+
+      private:
+        //! random access node iterator (own copy of the task)
+        Iterator<Ctype, CresultData> Miter;
+        //! first node of the range
+        size_t Mfirst;
+        //! end of the range
+        size_t Mlast;
+        //! checkpoint
+        Checkpoint<CresultData>* Mcheckpoint;
+
+    }; // class template CheckpointTask
+
+  } // namespace thread
+
+  /* ======================================================================= */
+  template <typename CresultData>
+  size_t const Checkpoint<CresultData>::MheaderSize;
+
+  /* ----------------------------------------------------------------------- */
+  template <typename CresultData>
+  Checkpoint<CresultData>::Checkpoint(std::string const& filename,
+      size_t num_nodes) : Msize(num_nodes), Mrecords(0)
+  {
+    OPTIMIZE_assert(Msize > 0, "Empty parameter space.");
+    std::uint64_t const file_size = MheaderSize + Msize*sizeof(Record);
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::strncpy(header.Mmagic, "OXXCKPT", sizeof(header.Mmagic));
+    header.Msize = Msize;
+    header.MrecordSize = sizeof(Record);
+
+    if (! std::ifstream(filename.c_str()))
+    {
+      // create a new checkpoint file - all nodes not computed yet
+      std::ofstream ofs(filename.c_str(), std::ios::binary);
+      ofs.write(reinterpret_cast<char const*>(&header), sizeof(Header));
+      ofs.seekp(file_size-1);
+      ofs.put('\0');
+      OPTIMIZE_assert(ofs.good(), "Unable to create checkpoint file.");
+    } else
+    {
+      // reattach to an existing checkpoint file
+      std::ifstream ifs(filename.c_str(), std::ios::binary | std::ios::ate);
+      OPTIMIZE_assert(static_cast<std::uint64_t>(ifs.tellg()) == file_size,
+          "Checkpoint file does not match the parameter space.");
+      Header existing;
+      ifs.seekg(0);
+      ifs.read(reinterpret_cast<char*>(&existing), sizeof(Header));
+      OPTIMIZE_assert(ifs.good() &&
+          0 == std::memcmp(&existing, &header, sizeof(Header)),
+          "Checkpoint file does not match the parameter space.");
+    }
+
+    Mfile = boost::interprocess::file_mapping(filename.c_str(),
+        boost::interprocess::read_write);
+    Mregion = boost::interprocess::mapped_region(Mfile,
+        boost::interprocess::read_write);
+    Mrecords = reinterpret_cast<Record*>(
+        static_cast<char*>(Mregion.get_address()) + MheaderSize);
+  } // function Checkpoint<CresultData>::Checkpoint
+
+  /* ----------------------------------------------------------------------- */
+  template <typename CresultData>
+  void Checkpoint<CresultData>::flush(size_t const first, size_t const last)
+  {
+    if (first >= last) { return; }
+    Mregion.flush(MheaderSize + first*sizeof(Record),
+        (last-first)*sizeof(Record), true);
+  } // function Checkpoint<CresultData>::flush
+
+  /* ----------------------------------------------------------------------- */
+  template <typename CresultData>
+  template <typename Ctype>
+  size_t Checkpoint<CresultData>::restore(
+      Iterator<Ctype, CresultData>& iter) const
+  {
+    size_t num_restored = 0;
+    size_t index = 0;
+    for (iter.first(); !iter.isDone(); ++iter, ++index)
+    {
+      OPTIMIZE_assert(index < Msize,
+          "Checkpoint file does not match the parameter space.");
+      if (isComputedAt(index))
+      {
+        (*iter)->setResultData(getResultDataAt(index));
+        (*iter)->setComputed();
+        ++num_restored;
+      }
+    }
+    return num_restored;
+  } // function Checkpoint<CresultData>::restore
+
+  namespace thread
+  {
+    /* ===================================================================== */
+    template <typename Ctype, typename CresultData>
+    void CheckpointTask<Ctype, CresultData>::execute(
+        ParameterSpaceVisitor<Ctype, CresultData>& app)
+    {
+      Miter.first();
+      Miter.advance(Mfirst);
+      for (size_t i = Mfirst; i < Mlast; ++i, ++Miter)
+      {
+        if (Mcheckpoint->isComputedAt(i)) { continue; }
+        GridComponent<Ctype, CresultData>* node = *Miter;
+        node->accept(app);
+        node->setComputed();
+        Mcheckpoint->setResultDataAt(i, node->getResultData());
+      }
+      Mcheckpoint->flush(Mfirst, Mlast);
+    } // function CheckpointTask<Ctype, CresultData>::execute
+
+  } // namespace thread
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF checkpoint.h  ----- */
@@ -0,0 +1,156 @@
+/*! \file execution.h
+ * \brief Handle of an asynchronous execution of a global algorithm.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Handle of an asynchronous execution of a global algorithm.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <memory>
+#include <atomic>
+#include <exception>
+#include <boost/thread.hpp>
+#include <optimizexx/application.h>
+#include <optimizexx/progress.h>
+
+#ifndef _OPTIMIZEXX_EXECUTION_H_
+#define _OPTIMIZEXX_EXECUTION_H_
+
+namespace optimize
+{
+  // forward declaration
+  template <typename Ctype, typename CresultData> class GlobalAlgorithm;
+
+  /* ======================================================================= */
+  /*!
+   * Handle of an asynchronous execution of a global algorithm (see
+   * optimize::GlobalAlgorithm::executeAsync). The algorithm is executed by a
+   * thread of its own which submits the tasks to the thread pool of the
+   * algorithm. Similar to a future the handle provides waiting for the
+   * execution and passes exceptions thrown by the execution to the caller
+   * of get(). Additionally the execution might be cancelled and its progress
+   * might be queried while it is running.\n
+   *
+   * \note The destructor waits until the execution had finished. The
+   * algorithm and the application must outlive the execution.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class Execution
+  {
+    public:
+      /*!
+       * constructor - starts the execution
+       *
+       * \param algorithm global algorithm whose parameter space had been
+       * constructed already
+       * \param v application
+       * \param progress progress of the execution
+       */
+      Execution(GlobalAlgorithm<Ctype, CresultData>& algorithm,
+          ParameterSpaceVisitor<Ctype, CresultData>& v,
+          std::shared_ptr<Progress> progress);
+      //! destructor
+      ~Execution() { wait(); }
+      //! block the calling thread until the execution had finished
+      void wait() { if (Mthread.joinable()) { Mthread.join(); } }
+      /*!
+       * Wait until the execution had finished and rethrow the exception the
+       * execution failed with (if any).
+       */
+      void get();
+      //! query function if the execution had finished
+      bool isDone() const { return Mdone; }
+      /*!
+       * Request the cancellation of the execution. Tasks still queued are
+       * discarded. Tasks currently worked on are completed.
+       */
+      void cancel() { Mprogress->cancel(); }
+      //! query function if the cancellation had been requested
+      bool isCancelled() const { return Mprogress->isCancelled(); }
+      //! query function for the progress of the execution
+      Progress const& getProgress() const { return *Mprogress; }
+
+    private:
+      //! not copyable
+      Execution(Execution const&);
+      //! not assignable
+      Execution& operator=(Execution const&);
+
+    private:
+      //! progress of the execution
+      std::shared_ptr<Progress> Mprogress;
+      //! status variable if the execution had finished
+      std::atomic<bool> Mdone;
+      //! exception the execution failed with
+      std::exception_ptr Merror;
+      //! thread executing the algorithm
+      boost::thread Mthread;
+
+  }; // class template Execution
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  Execution<Ctype, CresultData>::Execution(
+      GlobalAlgorithm<Ctype, CresultData>& algorithm,
+      ParameterSpaceVisitor<Ctype, CresultData>& v,
+      std::shared_ptr<Progress> progress) : Mprogress(progress), Mdone(false)
+  {
+    Mthread = boost::thread([this, &algorithm, &v]()
+        {
+          try
+          {
+            algorithm.execute(v);
+          }
+          catch (...)
+          {
+            Merror = std::current_exception();
+          }
+          Mdone = true;
+        });
+  } // constructor Execution<Ctype, CresultData>
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void Execution<Ctype, CresultData>::get()
+  {
+    wait();
+    if (Merror) { std::rethrow_exception(Merror); }
+  } // function Execution<Ctype, CresultData>::get
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF execution.h  ----- */
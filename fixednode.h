@@ -0,0 +1,169 @@
+/*! \file fixednode.h
+ * \brief Node of a parameter space of fixed dimension.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Node of a parameter space of fixed dimension.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  No coordinate vector anymore.
+ * 14/10/2026  V0.3  Trivially disposable for trivial types.
+ * 14/10/2026  V0.4  No coordinate vector to reference.
+ * 
+ * ============================================================================
+ */
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <optimizexx/node.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_FIXEDNODE_H_
+#define _OPTIMIZEXX_FIXEDNODE_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Node of a parameter space whose dimension is known at compile time.\n
+   *
+   * The coordinates are stored inline in a \c std::array so that
+   * constructing a node does not allocate any memory for its coordinates.
+   * Applications access the coordinates by means of getFixedCoordinates()
+   * or optimize::Node::getCoordinateData() which allow the compiler to
+   * unroll loops over the coordinates.\n
+   *
+   * \note A node of fixed dimension leaves the coordinate vector of
+   * optimize::Node empty. Thus it does not provide its coordinates by
+   * means of the generic interface optimize::Node::getCoordinates(), which
+   * returns a reference to this vector. Applications visiting nodes of fixed
+   * dimension have to make use of getCoordinateData() instead.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData, size_t Cdim>
+  class FixedNode : public Node<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef Node<Ctype, CresultData> Tbase;
+      //! typedef for coordinates
+      typedef typename Tbase::Tcoordinates Tcoordinates;
+      //! typedef for fixed coordinates
+      typedef typename std::array<Ctype, Cdim> TfixedCoordinates;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param coordinates The coordinates of the node.
+       */
+      FixedNode(Tcoordinates const& coordinates)
+      {
+        OPTIMIZE_assert(Cdim == coordinates.size(),
+            "Illegal number of coordinates.");
+        std::copy(coordinates.begin(), coordinates.end(),
+            McoordinatesFixed.begin());
+      }
+      //! destructor
+      virtual ~FixedNode() { }
+      /*!
+       * Illegal query function. A node of fixed dimension does not store its
+       * coordinates within a vector. Use getCoordinateData() instead.
+       */
+      virtual Tcoordinates const& getCoordinates() const
+      {
+        OPTIMIZE_illegal;
+      }
+      //! query function for the nodes' coordinates
+      virtual Ctype const* getCoordinateData() const
+      {
+        return McoordinatesFixed.data();
+      }
+      //! query function for the number of coordinates
+      virtual size_t getDimensions() const { return Cdim; }
+      //! query function for the nodes' coordinates
+      TfixedCoordinates const& getFixedCoordinates() const
+      {
+        return McoordinatesFixed;
+      }
+
+    private:
+      //! Coordinates of the node.
+      TfixedCoordinates McoordinatesFixed;
+
+  }; // class template FixedNode
+
+  /* ======================================================================= */
+  /*!
+   * A node of fixed dimension does not release any resources if its
+   * coordinates and results are of trivial types (the coordinate vector of
+   * optimize::Node remains empty). Thus its destruction is
+   * skipped if it had been allocated from an arena.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData, size_t Cdim>
+  struct TriviallyDisposable<FixedNode<Ctype, CresultData, Cdim>>
+  {
+    //! status variable
+    static bool const value = std::is_trivial<Ctype>::value &&
+      std::is_trivial<CresultData>::value;
+  }; // struct TriviallyDisposable
+
+  /* ======================================================================= */
+  /*!
+   * Type of the nodes of a parameter space of dimension \c Cdim. A
+   * dimension of zero denotes a dimension only known at runtime.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData, size_t Cdim>
+  struct NodeType
+  {
+    //! node type
+    typedef FixedNode<Ctype, CresultData, Cdim> Tnode;
+  }; // struct NodeType
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  struct NodeType<Ctype, CresultData, 0>
+  {
+    //! node type
+    typedef Node<Ctype, CresultData> Tnode;
+  }; // struct NodeType
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF fixednode.h  ----- */
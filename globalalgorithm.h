@@ -31,16 +31,35 @@
  * REVISIONS and CHANGES 
  * 20/02/2012  V0.1   Daniel Armbruster
  * 25/04/2012  V0.2   Make use of smart pointers and C++0x.
+ * 14/10/2026  V0.3   Result cache shared between global algorithms.
+ * 14/10/2026  V0.4   Partitions of the node index space.
+ * 14/10/2026  V0.5   Asynchronous execution, progress and shared thread
+ *                    pools.
+ * 14/10/2026  V0.6   Thread pools persist across executions.
+ * 14/10/2026  V0.7   Optional instrumentation of the executions.
+ * 14/10/2026  V0.8   Incremental rebuild of the parameter space.
+ * 14/10/2026  V0.9   Hand over the progress under a lock.
+ * 14/10/2026  V0.10  Partition ranges of large parameter spaces.
+ * 14/10/2026  V0.11  The builder shares the thread pool.
  * 
  * ============================================================================
  */
 
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <boost/thread.hpp>
 #include <optimizexx/builder.h>
 #include <optimizexx/gridcomponent.h>
 #include <optimizexx/parameter.h>
 #include <optimizexx/application.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/resultcache.h>
+#include <optimizexx/threadpool.h>
+#include <optimizexx/progress.h>
+#include <optimizexx/execution.h>
+#include <optimizexx/instrumentation.h>
+#include <optimizexx/incremental.h>
  
 #ifndef _OPTIMIZEXX_GLOBALALGORITHM_H_
 #define _OPTIMIZEXX_GLOBALALGORITHM_H_
@@ -68,6 +87,22 @@ namespace optimize
    * use one of a CompositeIterators provided by liboptimizexx which might be
    * more convenient and easier to handle.\n
    *
+   * Executions either block the caller (\c execute) or run asynchronously
+   * (\c executeAsync) providing a handle to wait for, cancel and query the
+   * progress of the execution. Several algorithms might share a single
+   * thread pool (see setThreadPool()) e.g. to run concurrently. Without a
+   * shared thread pool an algorithm keeps the thread pool it created for
+   * an execution alive for subsequent executions.\n
+   *
+   * If liboptimizexx is compiled with OPTIMIZE_INSTRUMENTATION defined the
+   * executions are instrumented (see getInstrumentation()).\n
+   *
+   * After the parameters had been changed (e.g. a range had been widened)
+   * updateParameterSpace() rebuilds the parameter space incrementally
+   * keeping the nodes and the results of the unchanged grid points. If
+   * incremental executions are enabled (see setIncremental()) nodes already
+   * computed are skipped so that only the grid points added are computed.\n
+   *
    * \ingroup group_global_algos
    */
   template <typename Ctype, typename CresultData>
@@ -78,6 +113,15 @@ namespace optimize
        * Note that the builder design pattern is in use (GoF p.97).
        */
       virtual void constructParameterSpace() = 0;
+      /*!
+       * Rebuild the parameter space after the parameters had been changed.
+       * Nodes whose coordinates still are grid points are kept together with
+       * their result data (see
+       * optimize::ParameterSpaceBuilder::rebuildGrid). If the builder does
+       * not support an incremental rebuild or no parameter space had been
+       * constructed yet the parameter space is constructed from scratch.
+       */
+      virtual void updateParameterSpace();
       /*!
        * Note that the visitor design pattern is in use (GoF p.315). The
        * agorithm acts as a client in this case.
@@ -85,11 +129,58 @@ namespace optimize
        * \param v An application applied to the grid.
        */
       virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& v) = 0;
+      /*!
+       * Execute the algorithm asynchronously.
+       *
+       * \param v An application applied to the grid. Must outlive the
+       * execution.
+       *
+       * \return handle of the execution
+       */
+      std::unique_ptr<Execution<Ctype, CresultData>> executeAsync(
+          ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * query function for the progress of the current or last execution
+       *
+       * \note Use optimize::Execution::getProgress to query the progress of
+       * an asynchronous execution. Calling this function while an
+       * asynchronous execution is running is safe though.
+       */
+      std::shared_ptr<Progress const> getProgress() const
+      {
+        boost::lock_guard<boost::mutex> lock(MprogressMutex);
+        return Mprogress;
+      }
+      /*!
+       * Set a thread pool shared with other global algorithms. The pool must
+       * have been constructed without an application and must have been
+       * initialized. If set, the pool is used by each execution instead of
+       * creating a thread pool of its own. The pool is handed over to the
+       * parameter space builder as well (see
+       * optimize::ParameterSpaceBuilder::setThreadPool).
+       *
+       * \param pool thread pool - empty to create a thread pool per
+       * execution
+       */
+      void setThreadPool(
+          std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool);
+      //! query function for the shared thread pool
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>>
+        getThreadPool() const { return MthreadPool; }
       //! destructor
       virtual ~GlobalAlgorithm() { }
       //! add a parameter or rather add an additional component to the grid
       void addParameter(typename 
           std::shared_ptr<Parameter<Ctype> const> param);
+      /*!
+       * Replace a parameter e.g. to widen its range before updating the
+       * parameter space (see updateParameterSpace()).
+       *
+       * \param index index of the parameter
+       * \param param new parameter
+       */
+      void setParameter(size_t const index,
+          typename std::shared_ptr<Parameter<Ctype> const> param);
       /*!
        * query function for parameter space
        *
@@ -116,6 +207,66 @@ namespace optimize
        * \return dimension of base parameter space
        */
       size_t getParameterSpaceDimensions() const { return Mparameters.size(); }
+      /*!
+       * Set a result cache. Nodes whose coordinates are already cached get
+       * their result data from the cache without applying the application.
+       * The cache might be shared between several global algorithms.
+       *
+       * \param cache result cache - empty to disable caching
+       */
+      void setResultCache(
+          std::shared_ptr<ResultCache<Ctype, CresultData>> cache)
+      { MresultCache = cache; }
+      //! query function for the result cache
+      std::shared_ptr<ResultCache<Ctype, CresultData>> getResultCache() const
+      { return MresultCache; }
+      /*!
+       * Enable incremental executions. Executions then skip the nodes which
+       * had been computed already and mark the nodes they visit as
+       * computed. Disabled by default.
+       *
+       * \param incremental flag
+       */
+      void setIncremental(bool incremental) { Mincremental = incremental; }
+      //! query function if executions are incremental
+      bool isIncremental() const { return Mincremental; }
+      /*!
+       * query function for the instrumentation of the executions\n
+       * The statistics are recorded only if OPTIMIZE_INSTRUMENTATION is
+       * defined (see optimize::Instrumentation::isEnabled).
+       */
+      Instrumentation const& getInstrumentation() const
+      { return Minstrumentation; }
+      //! query function for the instrumentation (e.g. to reset it)
+      Instrumentation& getInstrumentation() { return Minstrumentation; }
+      //! query function for the parameters of the parameter space
+      std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+        getParameters() const { return Mparameters; }
+      /*!
+       * Restrict the execution to a partition of the parameter space. The
+       * node index space (the positions of an optimize::RandomAccessNodeIter
+       * iterator) is divided into \a count contiguous blocks of nearly equal
+       * size. Only the nodes of block \a index are computed. By default the
+       * parameter space consists of a single partition.
+       *
+       * \param index index of the partition to be computed
+       * \param count number of partitions
+       */
+      void setPartition(size_t index, size_t count);
+      //! query function for the index of the partition to be computed
+      size_t getPartitionIndex() const { return MpartitionIndex; }
+      //! query function for the number of partitions
+      size_t getPartitionCount() const { return MpartitionCount; }
+      /*!
+       * query function for the range of node indices of the partition to be
+       * computed
+       *
+       * \param num_nodes number of nodes of the parameter space
+       * \param first index of the first node of the partition
+       * \param last index past the last node of the partition
+       */
+      void getPartitionRange(size_t const num_nodes, size_t& first,
+          size_t& last) const;
 
     protected:
       //! constructor
@@ -123,7 +274,9 @@ namespace optimize
           std::unique_ptr<GridComponent<Ctype, CresultData>> parameterspace,
           std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder) : 
           MparameterSpace(std::move(parameterspace)),
-          MparameterSpaceBuilder(std::move(builder))
+          MparameterSpaceBuilder(std::move(builder)), Mincremental(false),
+          MpartitionIndex(0), MpartitionCount(1), Mprogress(new Progress),
+          MownNumThreads(0)
       { }
          
 
@@ -134,7 +287,8 @@ namespace optimize
           std::vector<std::shared_ptr<Parameter<Ctype> const>> parameters) :
           MparameterSpace(std::move(parameterspace)),
           MparameterSpaceBuilder(std::move(builder)),
-          Mparameters(parameters) 
+          Mparameters(parameters), Mincremental(false), MpartitionIndex(0),
+          MpartitionCount(1), Mprogress(new Progress), MownNumThreads(0)
       { 
         for (auto cit(Mparameters.cbegin()); cit != Mparameters.cend(); ++cit)
         {
@@ -147,7 +301,9 @@ namespace optimize
       GlobalAlgorithm(        
           std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder) : 
           MparameterSpace(0),
-          MparameterSpaceBuilder(std::move(builder))
+          MparameterSpaceBuilder(std::move(builder)), Mincremental(false),
+          MpartitionIndex(0), MpartitionCount(1), Mprogress(new Progress),
+          MownNumThreads(0)
       { }
          
 
@@ -157,7 +313,8 @@ namespace optimize
           std::vector<std::shared_ptr<Parameter<Ctype> const>> parameters) :
           MparameterSpace(0),
           MparameterSpaceBuilder(std::move(builder)),
-          Mparameters(parameters) 
+          Mparameters(parameters), Mincremental(false), MpartitionIndex(0),
+          MpartitionCount(1), Mprogress(new Progress), MownNumThreads(0)
       { 
         for (auto cit(Mparameters.cbegin()); cit != Mparameters.cend(); ++cit)
         {
@@ -167,6 +324,79 @@ namespace optimize
 
 #endif
 
+      /*!
+       * Decorate an application with the result cache.
+       *
+       * \param app application to be decorated
+       *
+       * \return decorating application - empty if no result cache is set.
+       * A batch application is decorated by a batch application.
+       */
+      std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+        createCachingVisitor(ParameterSpaceVisitor<Ctype, CresultData>& app);
+      /*!
+       * Decorate an application skipping the nodes already computed.
+       *
+       * \param app application to be decorated
+       *
+       * \return decorating application - empty if executions are not
+       * incremental. A batch application is decorated by a batch
+       * application.
+       */
+      std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+        createIncrementalVisitor(
+            ParameterSpaceVisitor<Ctype, CresultData>& app);
+      /*!
+       * Decorate an application with a measurement of the latency of its
+       * calls.
+       *
+       * \param app application to be decorated
+       *
+       * \return decorating application - empty if the instrumentation is
+       * compiled out. A batch application is decorated by a batch
+       * application timing each block.
+       */
+      std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+        createInstrumentingVisitor(
+            ParameterSpaceVisitor<Ctype, CresultData>& app);
+      /*!
+       * query function for the instrumentation thread pool jobs record their
+       * tasks with
+       *
+       * \return instrumentation - null if it is compiled out
+       */
+      Instrumentation* getJobInstrumentation()
+      {
+        return Instrumentation::isEnabled() ? &Minstrumentation : 0;
+      }
+      /*!
+       * Start counting the progress of an execution. Called by \c execute of
+       * concrete algorithms.
+       *
+       * \return progress of the execution
+       */
+      Progress& startProgress();
+      /*!
+       * query function if an execution makes use of a thread pool
+       *
+       * \param num_threads number of threads of the algorithm - zero for
+       * single threaded execution
+       */
+      bool isConcurrent(size_t const num_threads) const
+      {
+        return 0 != num_threads || MthreadPool;
+      }
+      /*!
+       * Provide the thread pool of an execution. This is the shared thread
+       * pool if set. Otherwise the thread pool of its own is provided which
+       * is created and initialized by the first execution (or if the number
+       * of threads changed) and reused by the subsequent executions.
+       *
+       * \param num_threads number of threads of a thread pool of its own
+       */
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>>
+        createThreadPool(size_t const num_threads);
+
     protected:
       //! Pointer to the parameter space
       std::unique_ptr<GridComponent<Ctype, CresultData>> MparameterSpace;
@@ -178,6 +408,31 @@ namespace optimize
        * grid.
        */
       std::vector<std::shared_ptr<Parameter<Ctype> const>> Mparameters;
+      //! result cache (optional)
+      std::shared_ptr<ResultCache<Ctype, CresultData>> MresultCache;
+      //! status variable if executions skip the nodes already computed
+      bool Mincremental;
+      //! index of the partition to be computed
+      size_t MpartitionIndex;
+      //! number of partitions
+      size_t MpartitionCount;
+      //! progress of the current or last execution
+      std::shared_ptr<Progress> Mprogress;
+      //! progress prepared for an asynchronous execution
+      std::shared_ptr<Progress> MasyncProgress;
+      /*!
+       * Mutex guarding Mprogress and MasyncProgress which are handed over
+       * between the thread of an asynchronous execution and the caller.
+       */
+      mutable boost::mutex MprogressMutex;
+      //! thread pool shared with other global algorithms (optional)
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> MthreadPool;
+      //! thread pool of its own persisting across executions
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> MownThreadPool;
+      //! number of threads the thread pool of its own was requested with
+      size_t MownNumThreads;
+      //! instrumentation of the executions
+      Instrumentation Minstrumentation;
 
   }; // class template GlobalAlgorithm
 
@@ -190,6 +445,33 @@ namespace optimize
     Mparameters.push_back(param);
   }
 
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GlobalAlgorithm<Ctype, CresultData>::setParameter(size_t const index,
+      typename std::shared_ptr<Parameter<Ctype> const> param) 
+  {
+    OPTIMIZE_assert(index < Mparameters.size(), "Illegal index.");
+    OPTIMIZE_assert(param->isValid(), "Invalid parameter.");
+    Mparameters[index] = param;
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GlobalAlgorithm<Ctype, CresultData>::updateParameterSpace()
+  {
+    OPTIMIZE_assert(Mparameters.size() != 0, "Missing parameters.");
+    if (MparameterSpace)
+    {
+      OPTIMIZE_phase(Minstrumentation, Instrumentation::Construction);
+      if (MparameterSpaceBuilder->rebuildGrid(MparameterSpace.get(),
+            Mparameters))
+      {
+        return;
+      }
+    }
+    constructParameterSpace();
+  } // function GlobalAlgorithm<Ctype, CresultData>::updateParameterSpace
+
   /* ----------------------------------------------------------------------- */
   template <typename Ctype, typename CresultData>
   GridComponent<Ctype, CresultData> const& 
@@ -207,6 +489,153 @@ namespace optimize
   }
 
   /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<Execution<Ctype, CresultData>>
+  GlobalAlgorithm<Ctype, CresultData>::executeAsync(
+      ParameterSpaceVisitor<Ctype, CresultData>& v)
+  {
+    // the progress is created (and started) before the execution thread
+    // and taken over by startProgress()
+    std::shared_ptr<Progress> progress(new Progress);
+    {
+      boost::lock_guard<boost::mutex> lock(MprogressMutex);
+      MasyncProgress = progress;
+    }
+    return std::unique_ptr<Execution<Ctype, CresultData>>(
+        new Execution<Ctype, CresultData>(*this, v, progress));
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GlobalAlgorithm<Ctype, CresultData>::setThreadPool(
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool)
+  {
+    OPTIMIZE_assert(! pool || pool->isInitialized(),
+        "Thread pool not initialized.");
+    MthreadPool = pool;
+    if (MparameterSpaceBuilder) { MparameterSpaceBuilder->setThreadPool(pool); }
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  Progress& GlobalAlgorithm<Ctype, CresultData>::startProgress()
+  {
+    boost::lock_guard<boost::mutex> lock(MprogressMutex);
+    if (MasyncProgress)
+    {
+      Mprogress = MasyncProgress;
+      MasyncProgress.reset();
+    } else
+    {
+      Mprogress.reset(new Progress);
+    }
+    return *Mprogress;
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::shared_ptr<thread::ThreadPool<Ctype, CresultData>>
+  GlobalAlgorithm<Ctype, CresultData>::createThreadPool(
+      size_t const num_threads)
+  {
+    if (MthreadPool) { return MthreadPool; }
+    if (! MownThreadPool || MownNumThreads != num_threads)
+    {
+      MownThreadPool.reset(
+          new thread::ThreadPool<Ctype, CresultData>(num_threads));
+      MownThreadPool->initialize();
+      MownNumThreads = num_threads;
+    }
+    return MownThreadPool;
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GlobalAlgorithm<Ctype, CresultData>::setPartition(size_t index,
+      size_t count)
+  {
+    OPTIMIZE_assert(index < count, "Illegal partition.");
+    MpartitionIndex = index;
+    MpartitionCount = count;
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GlobalAlgorithm<Ctype, CresultData>::getPartitionRange(
+      size_t const num_nodes, size_t& first, size_t& last) const
+  {
+    // the first blocks are one node larger - avoids overflowing products
+    size_t const size = num_nodes/MpartitionCount;
+    size_t const rest = num_nodes%MpartitionCount;
+    first = MpartitionIndex*size + std::min(MpartitionIndex, rest);
+    last = first + size + (MpartitionIndex < rest ? 1 : 0);
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  GlobalAlgorithm<Ctype, CresultData>::createCachingVisitor(
+      ParameterSpaceVisitor<Ctype, CresultData>& app)
+  {
+    if (! MresultCache)
+    {
+      return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>();
+    }
+    BatchParameterSpaceVisitor<Ctype, CresultData>* batch =
+      dynamic_cast<BatchParameterSpaceVisitor<Ctype, CresultData>*>(&app);
+    if (batch)
+    {
+      return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>(
+          new CachingBatchVisitor<Ctype, CresultData>(*batch, *MresultCache));
+    }
+    return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>(
+        new CachingVisitor<Ctype, CresultData>(app, *MresultCache));
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  GlobalAlgorithm<Ctype, CresultData>::createIncrementalVisitor(
+      ParameterSpaceVisitor<Ctype, CresultData>& app)
+  {
+    if (! Mincremental)
+    {
+      return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>();
+    }
+    BatchParameterSpaceVisitor<Ctype, CresultData>* batch =
+      dynamic_cast<BatchParameterSpaceVisitor<Ctype, CresultData>*>(&app);
+    if (batch)
+    {
+      return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>(
+          new IncrementalBatchVisitor<Ctype, CresultData>(*batch));
+    }
+    return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>(
+        new IncrementalVisitor<Ctype, CresultData>(app));
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  GlobalAlgorithm<Ctype, CresultData>::createInstrumentingVisitor(
+      ParameterSpaceVisitor<Ctype, CresultData>& app)
+  {
+    if (! Instrumentation::isEnabled())
+    {
+      return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>();
+    }
+    BatchParameterSpaceVisitor<Ctype, CresultData>* batch =
+      dynamic_cast<BatchParameterSpaceVisitor<Ctype, CresultData>*>(&app);
+    if (batch)
+    {
+      return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>(
+          new InstrumentingBatchVisitor<Ctype, CresultData>(*batch,
+            Minstrumentation));
+    }
+    return std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>(
+        new InstrumentingVisitor<Ctype, CresultData>(app, Minstrumentation));
+  }
+
+  /* ----------------------------------------------------------------------- */
 
 } // namespace optimize
 
@@ -0,0 +1,395 @@
+/*! \file adaptivegridsearch.h
+ * \brief Adaptive grid search algorithm refining the parameter space locally.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Adaptive grid search algorithm refining the parameter space
+ * locally.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Merge per thread clones of the application.
+ * 14/10/2026  V0.3  Apply the application through a result cache.
+ * 14/10/2026  V0.4  Progress, cancellation and shared thread pools.
+ * 14/10/2026  V0.5  Optional instrumentation.
+ * 14/10/2026  V0.6  Skip the nodes already computed.
+ * 14/10/2026  V0.7  Raw access to the coordinates of the nodes.
+ * 14/10/2026  V0.8  Finish the progress of an execution.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <optimizexx/globalalgorithm.h>
+#include <optimizexx/parameter.h>
+#include <optimizexx/threadpool.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/node.h>
+#include <optimizexx/error.h>
+ 
+#ifndef _OPTIMIZEXX_ADAPTIVEGRIDSEARCH_H_
+#define _OPTIMIZEXX_ADAPTIVEGRIDSEARCH_H_
+
+namespace optimize
+{
+  // forward declarations
+  template <typename Ctype, typename CresultData> class ParameterSpaceVisitor;
+  template <typename Ctype> class Parameter;
+
+  /* ======================================================================= */
+  /*!
+   * Adaptive grid search algorithm.\n
+   *
+   * First a coarse grid search is performed. Afterwards the best \c K nodes
+   * are selected by means of a comparator of the result data. Around each of
+   * these nodes a finer subgrid is built using the
+   * ParameterSpaceBuilder::buildSubGrid function. A subgrid covers the
+   * interval to the neighbouring nodes and has a delta interval which is
+   * smaller by the refinement factor. Then the nodes of the new subgrids are
+   * computed and the procedure is repeated until the depth demanded is
+   * reached.\n
+   *
+   * To use this algorithm an application must be specified which is inherited
+   * of ParameterSpaceVisitor. The parameter space builder must support
+   * subgrids (e.g. optimize::StandardParameterSpaceBuilder).
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class AdaptiveGridSearch : public GlobalAlgorithm<Ctype, CresultData>
+  {
+    public:
+      typedef GlobalAlgorithm<Ctype, CresultData> Tbase;
+      //! comparator of result data - returns true if lhs is better than rhs
+      typedef std::function<bool(CresultData const&, CresultData const&)>
+        Tcomparator;
+      
+    public:
+      /*!
+       * constructor
+       *
+       * \param builder Pointer to a builder of a parameter space.
+       * \param depth number of refinement steps
+       * \param num_best number of nodes refined in each refinement step
+       * \param refinement ratio of the delta intervals of a grid and its
+       * subgrids (at least 2)
+       * \param num_threads Number of threads the algorithm uses for parallel
+       * computation
+       */
+      AdaptiveGridSearch(
+          std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder,
+          size_t depth=1, size_t num_best=1, size_t refinement=2,
+          size_t num_threads=0) :
+#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
+          Tbase(nullptr, std::move(builder)),
+#else
+          Tbase(std::move(builder)),
+#endif
+          Mdepth(depth), MnumBest(num_best), Mrefinement(refinement),
+          MnumThreads(num_threads), Mcomparator(std::less<CresultData>())
+      {
+        OPTIMIZE_assert(0 < MnumBest && 2 <= Mrefinement, "Illegal value.");
+      }
+      /*!
+       * constructor
+       *
+       * \param builder Pointer to a builder of a parameter space.
+       * \param parameters STL vector of pointers to parameters.
+       * \param depth number of refinement steps
+       * \param num_best number of nodes refined in each refinement step
+       * \param refinement ratio of the delta intervals of a grid and its
+       * subgrids (at least 2)
+       * \param num_threads Number of threads the algorithm uses for parallel
+       * computation
+       */
+      AdaptiveGridSearch(
+          std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder,
+          std::vector<std::shared_ptr<Parameter<Ctype> const>> const parameters,
+          size_t depth=1, size_t num_best=1, size_t refinement=2,
+          size_t num_threads=0) :
+#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
+          Tbase(nullptr, std::move(builder), parameters),
+#else
+          Tbase(std::move(builder), parameters),
+#endif
+          Mdepth(depth), MnumBest(num_best), Mrefinement(refinement),
+          MnumThreads(num_threads), Mcomparator(std::less<CresultData>())
+      {
+        OPTIMIZE_assert(0 < MnumBest && 2 <= Mrefinement, "Illegal value.");
+      }
+      /*!
+       * Construct a parameter space. Before constructing a parameter space for
+       * a global algorithm don't forget to make parameters available.
+       */
+      virtual void constructParameterSpace();
+      /*!
+       * Apply an application to the coarse parameter space grid and refine
+       * the parameter space around the best nodes afterwards.
+       *
+       * \param v Reference to a ParameterSpaceVisitor or rather application.
+       * For further information on how to implement an application for the
+       * parameter space \sa ParameterSpace
+       */
+      virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * Set the comparator used to select the best nodes. By default nodes
+       * with smaller results are better (std::less).
+       *
+       * \param comp comparator returning true if the first result is better
+       */
+      void setComparator(Tcomparator comp) { Mcomparator = comp; }
+      /*!
+       * query function for the best nodes of the last refinement step
+       *
+       * \return nodes sorted by means of the comparator - best node first
+       */
+      std::vector<Node<Ctype, CresultData>*> const& getBestNodes() const
+      {
+        return MbestNodes;
+      }
+
+    private:
+      //! typedef for a vector of node pointers
+      typedef typename std::vector<Node<Ctype, CresultData>*> Tnodes;
+      /*!
+       * Apply an application to nodes.
+       *
+       * \param nodes nodes to be computed
+       * \param v application
+       * \param progress progress of the execution
+       * \param job thread pool job - null for single threading execution
+       */
+      void compute(Tnodes& nodes, ParameterSpaceVisitor<Ctype, CresultData>& v,
+          Progress& progress, thread::Job<Ctype, CresultData>* job);
+      /*!
+       * Build a subgrid around a node.
+       *
+       * \param node node to be refined
+       * \param deltas delta intervals of the grid the node belongs to
+       */
+      void refine(Node<Ctype, CresultData>* node,
+          std::vector<Ctype> const& deltas);
+
+    private:
+      //! number of refinement steps
+      size_t Mdepth;
+      //! number of nodes refined within a refinement step
+      size_t MnumBest;
+      //! ratio of the delta intervals of a grid and its subgrids
+      size_t Mrefinement;
+      //! status variable if algorithm uses multiple threads
+      size_t MnumThreads;
+      //! comparator of the result data
+      Tcomparator Mcomparator;
+      //! best nodes found in the last refinement step
+      Tnodes MbestNodes;
+
+  }; // class template AdaptiveGridSearch
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void AdaptiveGridSearch<Ctype, CresultData>::constructParameterSpace()
+  {
+    OPTIMIZE_assert(Tbase::Mparameters.size() != 0, "Missing parameters.");
+    OPTIMIZE_phase(Tbase::Minstrumentation, Instrumentation::Construction);
+    Tbase::MparameterSpaceBuilder->buildParameterSpace();
+    Tbase::MparameterSpaceBuilder->buildGrid(Tbase::Mparameters);
+    Tbase::MparameterSpace = 
+      Tbase::MparameterSpaceBuilder->getParameterSpace();
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void AdaptiveGridSearch<Ctype, CresultData>::execute(
+      ParameterSpaceVisitor<Ctype, CresultData>& visitor)
+  {
+    OPTIMIZE_assert(Tbase::MparameterSpace, "Missing parameter space.");
+    Progress& progress = Tbase::startProgress();
+    ScopedProgress const finish(progress);
+    OPTIMIZE_phase(Tbase::Minstrumentation, Instrumentation::Execution);
+
+    // apply the application through the instrumentation, the result cache
+    // and the skipping of the nodes already computed if any
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> instrumented(
+        Tbase::createInstrumentingVisitor(visitor));
+    ParameterSpaceVisitor<Ctype, CresultData>& measured =
+      instrumented ? *instrumented : visitor;
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> cached(
+        Tbase::createCachingVisitor(measured));
+    ParameterSpaceVisitor<Ctype, CresultData>& lookup =
+      cached ? *cached : measured;
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> incremental(
+        Tbase::createIncrementalVisitor(lookup));
+    ParameterSpaceVisitor<Ctype, CresultData>& v =
+      incremental ? *incremental : lookup;
+
+    // thread pool for parallel computation - shared or of its own
+    std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool;
+    std::unique_ptr<thread::Job<Ctype, CresultData>> job;
+    if (Tbase::isConcurrent(MnumThreads))
+    {
+      pool = Tbase::createThreadPool(MnumThreads);
+      job.reset(new thread::Job<Ctype, CresultData>(*pool, v, progress,
+          Tbase::getJobInstrumentation()));
+    }
+
+    // nodes of the coarse grid
+    Tnodes nodes;
+    Iterator<Ctype, CresultData> iter(
+        Tbase::MparameterSpace->createIterator(ForwardNodeIter));
+    for (iter.first(); !iter.isDone(); ++iter)
+    {
+      nodes.push_back(static_cast<Node<Ctype, CresultData>*>(*iter));
+    }
+
+    std::vector<Ctype> deltas;
+    for (auto cit(Tbase::Mparameters.cbegin());
+        cit != Tbase::Mparameters.cend(); ++cit)
+    {
+      deltas.push_back((*cit)->getDelta());
+    }
+
+    for (size_t level = 0; ; ++level)
+    {
+      compute(nodes, v, progress, job.get());
+      if (progress.isCancelled()) { break; }
+
+      // select the best nodes
+      size_t const num_best = std::min(MnumBest, nodes.size());
+      std::partial_sort(nodes.begin(), nodes.begin()+num_best, nodes.end(),
+          [this](Node<Ctype, CresultData> const* lhs,
+            Node<Ctype, CresultData> const* rhs)
+          {
+            return Mcomparator(lhs->getResultData(), rhs->getResultData());
+          });
+      MbestNodes.assign(nodes.begin(), nodes.begin()+num_best);
+
+      if (level == Mdepth) { break; }
+
+      // build subgrids around the best nodes - refine() adds the subgrid to
+      // the parent of the node so that it is the last child of the parent.
+      // Adding children invalidates iterators over the children of the
+      // parent only, the node pointers collected remain valid.
+      nodes.clear();
+      for (auto cit(MbestNodes.cbegin()); cit != MbestNodes.cend(); ++cit)
+      {
+        refine(*cit, deltas);
+        Iterator<Ctype, CresultData> sub_iter(
+            (*(*cit)->getParent()->rbegin())->createIterator(ForwardNodeIter));
+        for (sub_iter.first(); !sub_iter.isDone(); ++sub_iter)
+        {
+          nodes.push_back(static_cast<Node<Ctype, CresultData>*>(*sub_iter));
+        }
+      }
+      for (auto it(deltas.begin()); it != deltas.end(); ++it)
+      {
+        *it /= Mrefinement;
+      }
+    }
+
+    // merge the workers' clones of the application
+    if (job) { job->merge(); }
+  } // function AdaptiveGridSearch<Ctype, CresultData>::execute
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void AdaptiveGridSearch<Ctype, CresultData>::compute(Tnodes& nodes,
+      ParameterSpaceVisitor<Ctype, CresultData>& v, Progress& progress,
+      thread::Job<Ctype, CresultData>* job)
+  {
+    // simple single threading execution
+    if (0 == job)
+    {
+      for (auto it(nodes.begin());
+          it != nodes.end() && ! progress.isCancelled(); ++it)
+      {
+        (*it)->accept(v);
+        progress.complete(1);
+      }
+      return;
+    }
+
+    // add tasks (chunks of nodes) to pool task queue - guided scheduling
+    size_t const num_workers = job->getThreadPool().getNumThreads();
+    Node<Ctype, CresultData>** const end = nodes.data() + nodes.size();
+    for (Node<Ctype, CresultData>** begin = nodes.data(); begin != end; )
+    {
+      size_t const remaining = end - begin;
+      size_t const chunk = std::max<size_t>(1, remaining / (2*num_workers));
+      job->addTask(typename thread::Job<Ctype, CresultData>::Ttask(
+            new thread::NodeRangeTask<Ctype, CresultData>(begin,
+              begin+chunk)));
+      begin += chunk;
+    }
+
+    // wait until all tasks had been completed
+    job->wait();
+  } // function AdaptiveGridSearch<Ctype, CresultData>::compute
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void AdaptiveGridSearch<Ctype, CresultData>::refine(
+      Node<Ctype, CresultData>* node, std::vector<Ctype> const& deltas)
+  {
+    Ctype const* c = node->getCoordinateData();
+    std::vector<std::shared_ptr<Parameter<Ctype> const>> params;
+    for (size_t d = 0; d < node->getDimensions(); ++d)
+    {
+      std::shared_ptr<Parameter<Ctype> const> const& p = 
+        Tbase::Mparameters[d];
+      Ctype const lower = std::min(p->getStart(), p->getEnd());
+      Ctype const upper = std::max(p->getStart(), p->getEnd());
+      Ctype const delta = deltas[d]/Mrefinement;
+
+      // cover the interval to the neighbouring nodes
+      Ctype const start = std::max(lower, c[d]-deltas[d]);
+      Ctype const end = std::max(c[d], std::min(upper, c[d]+deltas[d]));
+      size_t samples = 1;
+      while (samples < 2*Mrefinement+1 && start+samples*delta <= end+delta/2)
+      {
+        ++samples;
+      }
+      // a valid parameter has got at least three samples
+      samples = std::max<size_t>(samples, 3);
+      // the number of samples is computed from the end value - so avoid
+      // rounding errors
+      params.push_back(std::shared_ptr<Parameter<Ctype> const>(
+            new StandardParameter<Ctype>(p->getId(), start,
+              start+(samples-1.5)*delta, delta, p->getUnit())));
+    }
+    Tbase::MparameterSpaceBuilder->buildSubGrid(node->getParent(), params);
+  } // function AdaptiveGridSearch<Ctype, CresultData>::refine
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF adaptivegridsearch.h  ----- */
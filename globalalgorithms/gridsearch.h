@@ -32,16 +32,42 @@
  * 24/02/2012  V0.1   Daniel Armbruster
  * 08/04/2012  V0.2   Make use of the threadpool take advantage of concurrency.
  * 25/04/2012  V0.3   Make use of smart pointers and C++0x.
+ * 14/10/2026  V0.4   Wait for the thread pool's completion latch instead of
+ *                    busy waiting.
+ * 14/10/2026  V0.5   Dispatch chunks of nodes to the thread pool.
+ * 14/10/2026  V0.6   Support index addressed parameter spaces.
+ * 14/10/2026  V0.7   Merge per thread clones of the application.
+ * 14/10/2026  V0.8   Checkpoint/resume by means of a checkpoint file.
+ * 14/10/2026  V0.9   Traverse the parameter space without iterators.
+ * 14/10/2026  V0.10  Apply the application through a result cache.
+ * 14/10/2026  V0.11  Early termination and pruning.
+ * 14/10/2026  V0.12  Compute a partition of the parameter space only.
+ * 14/10/2026  V0.13  Progress, cancellation and shared thread pools.
+ * 14/10/2026  V0.14  Optional instrumentation.
+ * 14/10/2026  V0.15  Blocks of nodes passed to batch applications.
+ * 14/10/2026  V0.16  Streaming execution passing tiles to a sink.
+ * 14/10/2026  V0.17  Skip the nodes already computed.
+ * 14/10/2026  V0.18  Finish the progress of an execution.
  * 
  * ============================================================================
  */
 
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <string>
+#include <limits>
 #include <optimizexx/globalalgorithm.h>
 #include <optimizexx/parameter.h>
 #include <optimizexx/threadpool.h>
+#include <optimizexx/indexedgrid.h>
+#include <optimizexx/batchapplication.h>
 #include <optimizexx/iterator.h>
+#include <optimizexx/traversal.h>
+#include <optimizexx/checkpoint.h>
+#include <optimizexx/pruning.h>
+#include <optimizexx/streaming.h>
+#include <optimizexx/implicitbuilder.h>
 #include <optimizexx/error.h>
  
 #ifndef _OPTIMIZEXX_GRIDSEARCH_H_
@@ -61,7 +87,43 @@ namespace optimize
    * href="http://en.wikipedia.org/wiki/Grid_search">Wikipedia</a>\n
    *
    * To use this algorithm an application must be specified which is inherited
-   * of ParameterSpaceVisitor.
+   * of ParameterSpaceVisitor.\n
+   *
+   * If a checkpoint file is set the results are stored into this file as
+   * soon as the nodes had been computed (see optimize::Checkpoint). When
+   * executing the algorithm once again with the same file the results
+   * stored are restored and the nodes already computed are skipped.\n
+   *
+   * Single threaded execution traverses the parameter space by means of
+   * optimize::forEachNode() instead of a composite iterator.\n
+   *
+   * If a pruning policy is set (see optimize::Pruner) the run is cancelled
+   * as soon as the policy terminates it and the nodes of pruned (sub)grids
+   * are skipped. Nodes which had been skipped are left untouched. Tasks
+   * still queued in the thread pool are discarded. Pruning does not
+   * support checkpointing.\n
+   *
+   * If the parameter space is divided into partitions (see
+   * optimize::GlobalAlgorithm::setPartition) only the nodes of the
+   * partition are computed e.g. by a rank of an optimize::MPIExecutor.\n
+   *
+   * Batch applications (see optimize::BatchParameterSpaceVisitor) are passed
+   * blocks of nodes by both single and multi threaded executions, also if
+   * they are applied through the instrumentation, a result cache or
+   * incrementally (see optimize::GlobalAlgorithm::setIncremental).\n
+   *
+   * If a sink is set (see optimize::TileSink) the execution streams the
+   * results instead of keeping them in the parameter space: the coordinates
+   * of the grid points are generated from the parameters tile by tile, each
+   * tile is computed and passed to the sink afterwards. Only a bounded
+   * number of tiles is in flight at the same time so that the memory in use
+   * depends on the tile size but not on the number of grid points. A
+   * streaming execution does not require a parameter space to be
+   * constructed. It neither supports checkpointing nor pruning.\n
+   *
+   * The progress of an execution is counted per node (see
+   * optimize::GlobalAlgorithm::getProgress). If the cancellation of an
+   * execution is requested nodes not yet computed are skipped.
    *
    * \ingroup group_global_algos
    */
@@ -79,15 +141,19 @@ namespace optimize
        * Default is a StandardParameterSpaceBuilder.
        * \param num_threads Number of threads the algorithm uses for parallel
        * computation
+       * \param chunk_size Number of nodes passed to the thread pool within a
+       * single task. If zero the chunk size is adapted to the number of nodes
+       * still to be dispatched (guided scheduling).
        */
       GridSearch(
           std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder,
-          size_t num_threads=0) :
+          size_t num_threads=0, size_t chunk_size=0) :
 #if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
-          Tbase(nullptr, std::move(builder)), MnumThreads(num_threads)
+          Tbase(nullptr, std::move(builder)), MnumThreads(num_threads),
 #else
-          Tbase(std::move(builder)), MnumThreads(num_threads)
+          Tbase(std::move(builder)), MnumThreads(num_threads),
 #endif
+          MchunkSize(chunk_size), Mterminated(false), MtileSize(4096)
       { }
       /*!
        * constructor
@@ -97,17 +163,21 @@ namespace optimize
        * \param parameters STL vector of pointers to parameters.
        * \param num_threads Number of threads the algorithm uses for parallel
        * computation
+       * \param chunk_size Number of nodes passed to the thread pool within a
+       * single task. If zero the chunk size is adapted to the number of nodes
+       * still to be dispatched (guided scheduling).
        */
       GridSearch(
           std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder,
           std::vector<std::shared_ptr<Parameter<Ctype> const>> const parameters,
-          size_t num_threads=0) :
+          size_t num_threads=0, size_t chunk_size=0) :
 #if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
           Tbase(nullptr, std::move(builder), parameters),
-          MnumThreads(num_threads)
+          MnumThreads(num_threads),
 #else
-          Tbase(std::move(builder), parameters), MnumThreads(num_threads)
+          Tbase(std::move(builder), parameters), MnumThreads(num_threads),
 #endif
+          MchunkSize(chunk_size), Mterminated(false), MtileSize(4096)
       { }
       /*!
        * Construct a parameter space. Before constructing a parameter space for
@@ -124,10 +194,117 @@ namespace optimize
        * parameter space \sa ParameterSpace
        */
       virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * Set the number of nodes passed to the thread pool within a single
+       * task.
+       *
+       * \param chunk_size chunk size - zero enables guided scheduling
+       */
+      void setChunkSize(size_t chunk_size) { MchunkSize = chunk_size; }
+      //! query function for the chunk size
+      size_t getChunkSize() const { return MchunkSize; }
+      /*!
+       * Set the checkpoint file the results are stored into.
+       *
+       * \param filename name of the checkpoint file - an empty name disables
+       * checkpointing
+       */
+      void setCheckpointFile(std::string const& filename)
+      {
+        McheckpointFile = filename;
+      }
+      //! query function for the name of the checkpoint file
+      std::string const& getCheckpointFile() const { return McheckpointFile; }
+      /*!
+       * Set the pruning policy.
+       *
+       * \param pruner pruning policy - empty to disable pruning
+       */
+      void setPruner(std::shared_ptr<Pruner<Ctype, CresultData>> pruner)
+      {
+        Mpruner = pruner;
+      }
+      //! query function for the pruning policy
+      std::shared_ptr<Pruner<Ctype, CresultData>> getPruner() const
+      {
+        return Mpruner;
+      }
+      //! query function if the last execution had been terminated early
+      bool isTerminated() const { return Mterminated; }
+      /*!
+       * Set the sink the results of a streaming execution are passed to.
+       *
+       * \param sink sink - empty to disable streaming
+       * \param tile_size number of grid points per tile
+       */
+      void setSink(std::shared_ptr<TileSink<Ctype, CresultData>> sink,
+          size_t const tile_size=4096)
+      {
+        OPTIMIZE_assert(0 < tile_size, "Illegal value.");
+        Msink = sink;
+        MtileSize = tile_size;
+      }
+      //! query function for the sink of a streaming execution
+      std::shared_ptr<TileSink<Ctype, CresultData>> getSink() const
+      {
+        return Msink;
+      }
+      //! query function for the number of grid points per tile
+      size_t getTileSize() const { return MtileSize; }
+
+    private:
+      /*!
+       * Apply an application to the parameter space storing the results into
+       * the checkpoint file.
+       *
+       * \param v application
+       * \param progress progress of the execution
+       */
+      void executeCheckpointed(ParameterSpaceVisitor<Ctype, CresultData>& v,
+          Progress& progress);
+      /*!
+       * Generate the grid points tile by tile, compute the tiles and pass
+       * them to the sink.
+       *
+       * \param v application
+       * \param progress progress of the execution
+       */
+      void executeStreaming(ParameterSpaceVisitor<Ctype, CresultData>& v,
+          Progress& progress);
+      /*!
+       * Apply a batch application to the (partition of the) parameter space
+       * block by block - single threaded execution.
+       *
+       * \param v batch application
+       * \param progress progress of the execution
+       */
+      void executeBatch(BatchParameterSpaceVisitor<Ctype, CresultData>& v,
+          Progress& progress);
+      /*!
+       * query function for the size of the next chunk to be dispatched
+       *
+       * \param remaining number of nodes still to be dispatched
+       * \param num_workers number of workers of the thread pool
+       * \return chunk size
+       */
+      size_t getNextChunkSize(size_t const remaining,
+          size_t const num_workers) const;
 
     private:
       //! status variable if algorithm uses multiple threads
       size_t MnumThreads;
+      //! number of nodes per task (zero for guided scheduling)
+      size_t MchunkSize;
+      //! name of the checkpoint file
+      std::string McheckpointFile;
+      //! pruning policy (optional)
+      std::shared_ptr<Pruner<Ctype, CresultData>> Mpruner;
+      //! status variable if the last execution had been terminated early
+      bool Mterminated;
+      //! sink of a streaming execution (optional)
+      std::shared_ptr<TileSink<Ctype, CresultData>> Msink;
+      //! number of grid points per tile of a streaming execution
+      size_t MtileSize;
 
   }; // class template GridSearch
 
@@ -136,6 +313,7 @@ namespace optimize
   void GridSearch<Ctype, CresultData>::constructParameterSpace()
   {
     OPTIMIZE_assert(Tbase::Mparameters.size() != 0, "Missing parameters.");
+    OPTIMIZE_phase(Tbase::Minstrumentation, Instrumentation::Construction);
     Tbase::MparameterSpaceBuilder->buildParameterSpace();
     Tbase::MparameterSpaceBuilder->buildGrid(Tbase::Mparameters);
     Tbase::MparameterSpace = 
@@ -145,44 +323,328 @@ namespace optimize
   /* ----------------------------------------------------------------------- */
   template <typename Ctype, typename CresultData>
   void GridSearch<Ctype, CresultData>::execute(
-      ParameterSpaceVisitor<Ctype, CresultData>& v)
+      ParameterSpaceVisitor<Ctype, CresultData>& visitor)
   {
-    OPTIMIZE_assert(Tbase::MparameterSpace, "Missing parameter space.");
+    OPTIMIZE_assert(Tbase::MparameterSpace || Msink,
+        "Missing parameter space.");
+    Progress& progress = Tbase::startProgress();
+    ScopedProgress const finish(progress);
+    OPTIMIZE_phase(Tbase::Minstrumentation, Instrumentation::Execution);
 
-    Iterator<Ctype, CresultData> iter(
-        Tbase::MparameterSpace->createIterator(ForwardNodeIter));
+    // apply the application through the instrumentation, the result cache
+    // and the skipping of the nodes already computed if any
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> instrumented(
+        Tbase::createInstrumentingVisitor(visitor));
+    ParameterSpaceVisitor<Ctype, CresultData>& measured =
+      instrumented ? *instrumented : visitor;
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> cached(
+        Tbase::createCachingVisitor(measured));
+    ParameterSpaceVisitor<Ctype, CresultData>& lookup =
+      cached ? *cached : measured;
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> incremental(
+        Tbase::createIncrementalVisitor(lookup));
+    ParameterSpaceVisitor<Ctype, CresultData>& app =
+      incremental ? *incremental : lookup;
+
+    if (Msink)
+    {
+      Mterminated = false;
+      OPTIMIZE_assert(McheckpointFile.empty() && ! Mpruner,
+          "Streaming supports neither checkpointing nor pruning.");
+      executeStreaming(app, progress);
+      return;
+    }
+
+    if (! McheckpointFile.empty())
+    {
+      OPTIMIZE_assert(! Mpruner, "Pruning does not support checkpointing.");
+      OPTIMIZE_assert(1 == Tbase::getPartitionCount(),
+          "Partitions do not support checkpointing.");
+      executeCheckpointed(app, progress);
+      return;
+    }
+
+    // apply the application through the pruning policy if any
+    Mterminated = false;
+    std::unique_ptr<PruningVisitor<Ctype, CresultData>> pruning;
+    if (Mpruner)
+    {
+      pruning.reset(new PruningVisitor<Ctype, CresultData>(app, *Mpruner));
+      pruning->setProgress(&progress);
+    }
+    ParameterSpaceVisitor<Ctype, CresultData>& v =
+      pruning ? *pruning : app;
+    // node indices of partitions must not depend on pruning - the
+    // decorator prunes the grids of the nodes instead
+    bool const partitioned = 1 < Tbase::getPartitionCount();
+    auto prune = [&pruning, partitioned](Grid<Ctype, CresultData>* grid)
+    {
+      return ! partitioned && pruning && pruning->prune(grid);
+    };
+
+    // single threaded execution of a batch application - since the pruning
+    // visitor is no batch application there is nothing to be pruned
+    BatchParameterSpaceVisitor<Ctype, CresultData>* batch =
+      dynamic_cast<BatchParameterSpaceVisitor<Ctype, CresultData>*>(&v);
+    if (batch && ! Tbase::isConcurrent(MnumThreads))
+    {
+      executeBatch(*batch, progress);
+      return;
+    }
 
     // simple single threading execution
-    if (0 == MnumThreads)
+    if (! Tbase::isConcurrent(MnumThreads))
     {
-      for (iter.first(); !iter.isDone(); ++iter)
+      size_t first = 0;
+      size_t last = std::numeric_limits<size_t>::max();
+      if (partitioned)
       {
-        (*iter)->accept(v);
+        size_t num = 0;
+        auto count = [&num](Node<Ctype, CresultData>* node) { ++num; };
+        forEachNode(*Tbase::MparameterSpace, count);
+        Tbase::getPartitionRange(num, first, last);
       }
+      size_t index = 0;
+      auto visit = [&v, &progress, &index, first, last](
+          Node<Ctype, CresultData>* node)
+      {
+        if (first <= index && index < last && ! progress.isCancelled())
+        {
+          v(node);
+          progress.complete(1);
+        }
+        ++index;
+      };
+      forEachNode(*Tbase::MparameterSpace, visit, prune);
     } else
     {
-      size_t num_tasks = 0;
+      // thread pool for parallel computation - shared or of its own
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool(
+          Tbase::createThreadPool(MnumThreads));
+      thread::Job<Ctype, CresultData> job(*pool, v, progress,
+          Tbase::getJobInstrumentation());
 
-      // create thread pool for parallel computation
-      typename thread::ThreadPool<Ctype, CresultData>* pool =
-        new typename thread::ThreadPool<Ctype, CresultData>(v, MnumThreads);
-      pool->initialize();
+      typedef typename thread::Job<Ctype, CresultData>::Ttask Ttask;
+      size_t const num_workers = pool->getNumThreads();
+      // node pointers of the parameter space
+      std::vector<Node<Ctype, CresultData>*> nodes;
 
-      // add tasks (node pointers) to pool task queue
-      for (iter.first(); !iter.isDone(); ++iter)
+      IndexedGrid<Ctype, CresultData> const* indexed_grid = 
+        dynamic_cast<IndexedGrid<Ctype, CresultData> const*>(
+            Tbase::MparameterSpace.get());
+      if (indexed_grid)
       {
-        pool->addTask(*iter);
-        ++num_tasks;
-      }
+        // add tasks (ranges of grid points) to pool task queue
+        size_t first = 0;
+        size_t last = 0;
+        Tbase::getPartitionRange(indexed_grid->size(), first, last);
+        while (first != last)
+        {
+          size_t const chunk = getNextChunkSize(last-first, num_workers);
+          job.addTask(Ttask(new thread::IndexRangeTask<Ctype, CresultData>(
+                  indexed_grid, first, first+chunk)));
+          first += chunk;
+        }
+      } else
+      {
+        // collect node pointers
+        auto collect = [&nodes](Node<Ctype, CresultData>* node)
+        {
+          nodes.push_back(node);
+        };
+        forEachNode(*Tbase::MparameterSpace, collect, prune);
 
-      // wait until all threads finished
-      while(num_tasks != pool->getCompletedTasksCount()) { }
+        // add tasks (chunks of nodes) to pool task queue
+        size_t first = 0;
+        size_t last = 0;
+        Tbase::getPartitionRange(nodes.size(), first, last);
+        Node<Ctype, CresultData>** const end = nodes.data() + last;
+        for (Node<Ctype, CresultData>** begin = nodes.data() + first;
+            begin != end; )
+        {
+          size_t const chunk = getNextChunkSize(end-begin, num_workers);
+          job.addTask(Ttask(new thread::NodeRangeTask<Ctype, CresultData>(
+                  begin, begin+chunk)));
+          begin += chunk;
+        }
+      }
 
-      delete pool;
+      // wait until all tasks had been completed
+      job.wait();
+      // merge the workers' clones of the application
+      job.merge();
     }
+    Mterminated = pruning && pruning->isCancelled();
   } // function GridSearch<Ctype, CresultData>::execute
 
   /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GridSearch<Ctype, CresultData>::executeCheckpointed(
+      ParameterSpaceVisitor<Ctype, CresultData>& v, Progress& progress)
+  {
+    // random access - the index of a node is its position
+    Iterator<Ctype, CresultData> iter(
+        Tbase::MparameterSpace->createIterator(RandomAccessNodeIter));
+    size_t const num = iter.getSize();
+
+    Checkpoint<CresultData> checkpoint(McheckpointFile, num);
+    checkpoint.restore(iter);
+
+    if (! Tbase::isConcurrent(MnumThreads))
+    {
+      thread::CheckpointTask<Ctype, CresultData> task(iter, 0, num,
+          &checkpoint);
+      progress.submit(num);
+      progress.begin(num);
+      task.execute(v);
+      progress.end(num);
+    } else
+    {
+      // thread pool for parallel computation - shared or of its own
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool(
+          Tbase::createThreadPool(MnumThreads));
+      thread::Job<Ctype, CresultData> job(*pool, v, progress,
+          Tbase::getJobInstrumentation());
+
+      typedef typename thread::Job<Ctype, CresultData>::Ttask Ttask;
+      size_t const num_workers = pool->getNumThreads();
+      // add tasks (ranges of nodes) to pool task queue
+      for (size_t first = 0; first != num; )
+      {
+        size_t const chunk = getNextChunkSize(num-first, num_workers);
+        job.addTask(Ttask(new thread::CheckpointTask<Ctype, CresultData>(
+                iter, first, first+chunk, &checkpoint)));
+        first += chunk;
+      }
+
+      // wait until all tasks had been completed
+      job.wait();
+      // merge the workers' clones of the application
+      job.merge();
+    }
+    checkpoint.sync();
+  } // function GridSearch<Ctype, CresultData>::executeCheckpointed
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GridSearch<Ctype, CresultData>::executeStreaming(
+      ParameterSpaceVisitor<Ctype, CresultData>& v, Progress& progress)
+  {
+    OPTIMIZE_assert(Tbase::Mparameters.size() != 0, "Missing parameters.");
+    // an implicit grid generates the coordinates from the parameters
+    ImplicitParameterSpaceBuilder<Ctype, CresultData> builder;
+    builder.buildParameterSpace();
+    builder.buildGrid(Tbase::Mparameters);
+    std::unique_ptr<GridComponent<Ctype, CresultData>> space(
+        builder.getParameterSpace());
+    IndexedGrid<Ctype, CresultData> const& grid =
+      static_cast<IndexedGrid<Ctype, CresultData> const&>(*space);
+
+    size_t first = 0;
+    size_t last = 0;
+    Tbase::getPartitionRange(grid.size(), first, last);
+    Msink->begin(Tbase::Mparameters, grid.size());
+
+    if (! Tbase::isConcurrent(MnumThreads))
+    {
+      // a single tile buffer
+      BlockBuffer<Ctype, CresultData> buffer(grid.getDimensions(),
+          std::max<size_t>(1, std::min(MtileSize, last-first)));
+      while (first != last && ! progress.isCancelled())
+      {
+        size_t const num = std::min(MtileSize, last-first);
+        thread::TileTask<Ctype, CresultData>::compute(grid, first,
+            first+num, buffer, v, *Msink);
+        progress.complete(num);
+        first += num;
+      }
+    } else
+    {
+      // thread pool for parallel computation - shared or of its own
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool(
+          Tbase::createThreadPool(MnumThreads));
+      thread::Job<Ctype, CresultData> job(*pool, v, progress,
+          Tbase::getJobInstrumentation());
+
+      typedef typename thread::Job<Ctype, CresultData>::Ttask Ttask;
+      // tiles are dispatched in rounds so that the number of tiles in
+      // flight is bounded
+      size_t const num_tiles = 4*pool->getNumThreads();
+      while (first != last && ! progress.isCancelled())
+      {
+        for (size_t t = 0; t < num_tiles && first != last; ++t)
+        {
+          size_t const num = std::min(MtileSize, last-first);
+          job.addTask(Ttask(new thread::TileTask<Ctype, CresultData>(
+                  &grid, first, first+num, *Msink)));
+          first += num;
+        }
+        job.wait();
+      }
+      // merge the workers' clones of the application
+      job.merge();
+    }
+    Msink->end();
+  } // function GridSearch<Ctype, CresultData>::executeStreaming
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GridSearch<Ctype, CresultData>::executeBatch(
+      BatchParameterSpaceVisitor<Ctype, CresultData>& v, Progress& progress)
+  {
+    size_t const block_size = v.getBlockSize();
+    size_t first = 0;
+    size_t last = 0;
+
+    IndexedGrid<Ctype, CresultData>* indexed_grid = 
+      dynamic_cast<IndexedGrid<Ctype, CresultData>*>(
+          Tbase::MparameterSpace.get());
+    if (indexed_grid)
+    {
+      Tbase::getPartitionRange(indexed_grid->size(), first, last);
+      while (first != last && ! progress.isCancelled())
+      {
+        size_t const num = std::min(block_size, last-first);
+        indexed_grid->visitRange(v, first, first+num);
+        progress.complete(num);
+        first += num;
+      }
+      return;
+    }
+
+    // collect node pointers
+    std::vector<Node<Ctype, CresultData>*> nodes;
+    auto collect = [&nodes](Node<Ctype, CresultData>* node)
+    {
+      nodes.push_back(node);
+    };
+    forEachNode(*Tbase::MparameterSpace, collect);
+
+    Tbase::getPartitionRange(nodes.size(), first, last);
+    while (first != last && ! progress.isCancelled())
+    {
+      size_t const num = std::min(block_size, last-first);
+      v(nodes.data()+first, nodes.data()+first+num);
+      progress.complete(num);
+      first += num;
+    }
+  } // function GridSearch<Ctype, CresultData>::executeBatch
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  size_t GridSearch<Ctype, CresultData>::getNextChunkSize(
+      size_t const remaining, size_t const num_workers) const
+  {
+    size_t chunk = MchunkSize;
+    if (0 == chunk)
+    {
+      // guided scheduling - chunks shrink with the remaining work
+      chunk = std::max<size_t>(1, remaining / (2*num_workers));
+    }
+    return std::min(chunk, remaining);
+  } // function GridSearch<Ctype, CresultData>::getNextChunkSize
+
+  /* ----------------------------------------------------------------------- */
 
 } // namespace optimize
 
@@ -0,0 +1,748 @@
+/*! \file localsearch.h
+ * \brief Gradient-free local search seeded from grid results.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Gradient-free local search (Nelder-Mead simplex and compass
+ * search) refining the best nodes of a grid off the grid.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Skip the nodes already computed.
+ * 14/10/2026  V0.3  Raw access to the coordinates of the nodes.
+ * 14/10/2026  V0.4  Finish the progress of an execution.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include <optimizexx/globalalgorithm.h>
+#include <optimizexx/parameter.h>
+#include <optimizexx/threadpool.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/node.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_LOCALSEARCH_H_
+#define _OPTIMIZEXX_LOCALSEARCH_H_
+
+namespace optimize
+{
+  // forward declarations
+  template <typename Ctype, typename CresultData> class ParameterSpaceVisitor;
+  template <typename Ctype> class Parameter;
+  template <typename Ctype, typename CresultData> class LocalSearch;
+
+  //! local search methods
+  enum ElocalSearch
+  {
+    NelderMead,     //!< Nelder-Mead downhill simplex
+    CompassSearch   //!< compass (coordinate pattern) search
+  }; // enum ElocalSearch
+
+  namespace thread
+  {
+    /* ===================================================================== */
+    /*!
+     * Task performing the local search of a single starting point.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData>
+    class LocalSearchTask : public Task<Ctype, CresultData>
+    {
+      public:
+        /*!
+         * constructor
+         *
+         * \param search local search the starting point belongs to
+         * \param start index of the starting point
+         */
+        LocalSearchTask(LocalSearch<Ctype, CresultData>& search,
+            size_t const start) : Msearch(search), Mstart(start)
+        { }
+        //! destructor
+        virtual ~LocalSearchTask() { }
+        //! perform the local search of the starting point
+        virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app)
+        {
+          Msearch.search(Mstart, app);
+        }
+
+      private:
+        //! local search
+        LocalSearch<Ctype, CresultData>& Msearch;
+        //! index of the starting point
+        size_t Mstart;
+
+    }; // class template LocalSearchTask
+
+  } // namespace thread
+
+  /* ======================================================================= */
+  /*!
+   * Gradient-free local search seeded from grid results.\n
+   *
+   * A grid search only finds the optimum up to the delta interval of the
+   * grid. Instead of refining the grid this algorithm starts a local search
+   * from the best nodes and evaluates the application at points off the
+   * grid. Either the Nelder-Mead downhill simplex or a compass search is
+   * used. Both methods only compare result data by means of a comparator and
+   * thus don't need gradients. The initial simplex or rather step size is the
+   * delta interval of the parameters and the search of a starting point
+   * terminates as soon as its simplex or step is smaller than the tolerance
+   * (relative to the delta intervals) or the maximum number of evaluations is
+   * reached. Points are clamped to the parameter intervals.\n
+   *
+   * The starting points either are set explicitly (e.g. the best nodes of
+   * another global algorithm's parameter space, see selectBest()) or the
+   * coarse grid of the algorithm is computed first and its best nodes are
+   * used. The starting points are searched independently and in parallel if
+   * the algorithm uses multiple threads (one thread::LocalSearchTask each).
+   * \n
+   *
+   * The points evaluated off the grid are nodes owned by the algorithm. They
+   * don't belong to the parameter space and thus aren't visited by iterators
+   * of the parameter space.
+   *
+   * \note The progress of an execution counts the nodes of the coarse grid
+   * and the starting points searched.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class LocalSearch : public GlobalAlgorithm<Ctype, CresultData>
+  {
+    public:
+      typedef GlobalAlgorithm<Ctype, CresultData> Tbase;
+      //! comparator of result data - returns true if lhs is better than rhs
+      typedef std::function<bool(CresultData const&, CresultData const&)>
+        Tcomparator;
+      //! typedef for coordinates of a point
+      typedef typename std::vector<Ctype> Tcoordinates;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param builder Pointer to a builder of a parameter space.
+       * \param method local search method
+       * \param num_starts number of best nodes of the coarse grid the local
+       * search starts from (if no starting points are set)
+       * \param num_threads Number of threads the algorithm uses for parallel
+       * computation
+       */
+      LocalSearch(
+          std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder,
+          ElocalSearch method=NelderMead, size_t num_starts=1,
+          size_t num_threads=0) :
+#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
+          Tbase(nullptr, std::move(builder)),
+#else
+          Tbase(std::move(builder)),
+#endif
+          Mmethod(method), MnumStarts(num_starts), MnumThreads(num_threads),
+          Mtolerance(1e-3), MmaxEvaluations(1000),
+          Mcomparator(std::less<CresultData>()), Mevaluations(0)
+      {
+        OPTIMIZE_assert(0 < MnumStarts, "Illegal value.");
+      }
+      /*!
+       * constructor
+       *
+       * \param builder Pointer to a builder of a parameter space.
+       * \param parameters STL vector of pointers to parameters.
+       * \param method local search method
+       * \param num_starts number of best nodes of the coarse grid the local
+       * search starts from (if no starting points are set)
+       * \param num_threads Number of threads the algorithm uses for parallel
+       * computation
+       */
+      LocalSearch(
+          std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder,
+          std::vector<std::shared_ptr<Parameter<Ctype> const>> const parameters,
+          ElocalSearch method=NelderMead, size_t num_starts=1,
+          size_t num_threads=0) :
+#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
+          Tbase(nullptr, std::move(builder), parameters),
+#else
+          Tbase(std::move(builder), parameters),
+#endif
+          Mmethod(method), MnumStarts(num_starts), MnumThreads(num_threads),
+          Mtolerance(1e-3), MmaxEvaluations(1000),
+          Mcomparator(std::less<CresultData>()), Mevaluations(0)
+      {
+        OPTIMIZE_assert(0 < MnumStarts, "Illegal value.");
+      }
+      /*!
+       * Construct a parameter space. Before constructing a parameter space for
+       * a global algorithm don't forget to make parameters available.
+       */
+      virtual void constructParameterSpace();
+      /*!
+       * Compute the coarse grid if no starting points are set and perform
+       * the local search of each starting point afterwards.
+       *
+       * \param v Reference to a ParameterSpaceVisitor or rather application.
+       * For further information on how to implement an application for the
+       * parameter space \sa ParameterSpace
+       */
+      virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * Set the comparator of the result data. By default smaller results are
+       * better (std::less).
+       *
+       * \param comp comparator returning true if the first result is better
+       */
+      void setComparator(Tcomparator comp) { Mcomparator = comp; }
+      /*!
+       * Set the starting points of the local search. If no starting points
+       * are set the best nodes of the coarse grid are used.
+       *
+       * \param points coordinates of the starting points
+       */
+      void setStartPoints(std::vector<Tcoordinates> const& points);
+      //! query function for the starting points of the last execution
+      std::vector<Tcoordinates> const& getStartPoints() const
+      {
+        return MstartPoints;
+      }
+      /*!
+       * Set the tolerance. The search of a starting point terminates if the
+       * simplex or rather the step size is smaller than the tolerance times
+       * the delta interval of each parameter.
+       */
+      void setTolerance(double const tol);
+      //! query function for the tolerance
+      double getTolerance() const { return Mtolerance; }
+      //! set the maximum number of evaluations per starting point
+      void setMaxEvaluations(size_t const n);
+      //! query function for the maximum number of evaluations per start
+      size_t getMaxEvaluations() const { return MmaxEvaluations; }
+      /*!
+       * query function for the optimum found from each starting point
+       *
+       * \return nodes sorted by means of the comparator - best node first
+       */
+      std::vector<Node<Ctype, CresultData>*> const& getBestNodes() const
+      {
+        return MbestNodes;
+      }
+      /*!
+       * query function for the number of points the application was applied
+       * to by the local searches of the last execution (the nodes of the
+       * coarse grid are not included)
+       */
+      size_t getEvaluations() const { return Mevaluations; }
+      /*!
+       * Select the coordinates of the best nodes of a parameter space e.g. to
+       * seed a local search with the results of another global algorithm.
+       *
+       * \param space computed parameter space
+       * \param num number of nodes to be selected
+       * \param comp comparator returning true if the first result is better
+       *
+       * \return coordinates of the best nodes - best node first
+       */
+      static std::vector<Tcoordinates> selectBest(
+          GridComponent<Ctype, CresultData> const& space, size_t const num,
+          Tcomparator comp=std::less<CresultData>());
+
+    private:
+      //! typedef for a node owned by the algorithm
+      typedef typename std::unique_ptr<Node<Ctype, CresultData>> Tnode;
+      /*!
+       * Perform the local search of a starting point.
+       *
+       * \param start index of the starting point
+       * \param v application
+       */
+      void search(size_t const start,
+          ParameterSpaceVisitor<Ctype, CresultData>& v);
+      //! Nelder-Mead downhill simplex starting at a point
+      Tnode searchNelderMead(Tcoordinates const& start,
+          ParameterSpaceVisitor<Ctype, CresultData>& v);
+      //! compass search starting at a point
+      Tnode searchCompass(Tcoordinates const& start,
+          ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * Apply the application to a point off the grid.
+       *
+       * \param coordinates coordinates of the point - clamped to the
+       * parameter intervals
+       * \param v application
+       */
+      Tnode evaluate(Tcoordinates coordinates,
+          ParameterSpaceVisitor<Ctype, CresultData>& v);
+      //! returns true if the result of lhs is better than the result of rhs
+      bool isBetter(Tnode const& lhs, Tnode const& rhs) const
+      {
+        return Mcomparator(lhs->getResultData(), rhs->getResultData());
+      }
+
+      friend class thread::LocalSearchTask<Ctype, CresultData>;
+
+    private:
+      //! local search method
+      ElocalSearch Mmethod;
+      //! number of best nodes of the coarse grid used as starting points
+      size_t MnumStarts;
+      //! status variable if algorithm uses multiple threads
+      size_t MnumThreads;
+      //! tolerance relative to the delta intervals of the parameters
+      double Mtolerance;
+      //! maximum number of evaluations per starting point
+      size_t MmaxEvaluations;
+      //! comparator of the result data
+      Tcomparator Mcomparator;
+      //! starting points set by the user
+      std::vector<Tcoordinates> MuserStartPoints;
+      //! starting points of the last execution
+      std::vector<Tcoordinates> MstartPoints;
+      //! optimum found from each starting point
+      std::vector<Tnode> Mresults;
+      //! optimum found from each starting point - best node first
+      std::vector<Node<Ctype, CresultData>*> MbestNodes;
+      //! number of evaluations of the last execution
+      std::atomic<size_t> Mevaluations;
+
+  }; // class template LocalSearch
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void LocalSearch<Ctype, CresultData>::constructParameterSpace()
+  {
+    OPTIMIZE_assert(Tbase::Mparameters.size() != 0, "Missing parameters.");
+    OPTIMIZE_phase(Tbase::Minstrumentation, Instrumentation::Construction);
+    Tbase::MparameterSpaceBuilder->buildParameterSpace();
+    Tbase::MparameterSpaceBuilder->buildGrid(Tbase::Mparameters);
+    Tbase::MparameterSpace =
+      Tbase::MparameterSpaceBuilder->getParameterSpace();
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void LocalSearch<Ctype, CresultData>::setStartPoints(
+      std::vector<Tcoordinates> const& points)
+  {
+    for (auto cit(points.cbegin()); cit != points.cend(); ++cit)
+    {
+      OPTIMIZE_assert(cit->size() == Tbase::Mparameters.size(),
+          "Dimension mismatch.");
+    }
+    MuserStartPoints = points;
+  } // function LocalSearch<Ctype, CresultData>::setStartPoints
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void LocalSearch<Ctype, CresultData>::setTolerance(double const tol)
+  {
+    OPTIMIZE_assert(0 < tol, "Illegal value.");
+    Mtolerance = tol;
+  } // function LocalSearch<Ctype, CresultData>::setTolerance
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void LocalSearch<Ctype, CresultData>::setMaxEvaluations(size_t const n)
+  {
+    OPTIMIZE_assert(0 < n, "Illegal value.");
+    MmaxEvaluations = n;
+  } // function LocalSearch<Ctype, CresultData>::setMaxEvaluations
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::vector<typename LocalSearch<Ctype, CresultData>::Tcoordinates>
+  LocalSearch<Ctype, CresultData>::selectBest(
+      GridComponent<Ctype, CresultData> const& space, size_t const num,
+      Tcomparator comp)
+  {
+    std::vector<Node<Ctype, CresultData> const*> nodes;
+    Iterator<Ctype, CresultData> iter(space.createIterator(ForwardNodeIter));
+    for (iter.first(); !iter.isDone(); ++iter)
+    {
+      nodes.push_back(static_cast<Node<Ctype, CresultData> const*>(*iter));
+    }
+
+    size_t const num_best = std::min(num, nodes.size());
+    std::partial_sort(nodes.begin(), nodes.begin()+num_best, nodes.end(),
+        [&comp](Node<Ctype, CresultData> const* lhs,
+          Node<Ctype, CresultData> const* rhs)
+        {
+          return comp(lhs->getResultData(), rhs->getResultData());
+        });
+
+    std::vector<Tcoordinates> retval;
+    for (size_t i = 0; i < num_best; ++i)
+    {
+      Ctype const* c = nodes[i]->getCoordinateData();
+      retval.push_back(Tcoordinates(c, c+nodes[i]->getDimensions()));
+    }
+    return retval;
+  } // function LocalSearch<Ctype, CresultData>::selectBest
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void LocalSearch<Ctype, CresultData>::execute(
+      ParameterSpaceVisitor<Ctype, CresultData>& visitor)
+  {
+    OPTIMIZE_assert(Tbase::MparameterSpace, "Missing parameter space.");
+    Progress& progress = Tbase::startProgress();
+    ScopedProgress const finish(progress);
+    OPTIMIZE_phase(Tbase::Minstrumentation, Instrumentation::Execution);
+
+    // apply the application through the instrumentation, the result cache
+    // and the skipping of the nodes already computed if any
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> instrumented(
+        Tbase::createInstrumentingVisitor(visitor));
+    ParameterSpaceVisitor<Ctype, CresultData>& measured =
+      instrumented ? *instrumented : visitor;
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> cached(
+        Tbase::createCachingVisitor(measured));
+    ParameterSpaceVisitor<Ctype, CresultData>& lookup =
+      cached ? *cached : measured;
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> incremental(
+        Tbase::createIncrementalVisitor(lookup));
+    ParameterSpaceVisitor<Ctype, CresultData>& v =
+      incremental ? *incremental : lookup;
+
+    // thread pool for parallel computation - shared or of its own
+    std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool;
+    std::unique_ptr<thread::Job<Ctype, CresultData>> job;
+    if (Tbase::isConcurrent(MnumThreads))
+    {
+      pool = Tbase::createThreadPool(MnumThreads);
+      job.reset(new thread::Job<Ctype, CresultData>(*pool, v, progress,
+          Tbase::getJobInstrumentation()));
+    }
+
+    MbestNodes.clear();
+    Mresults.clear();
+    Mevaluations = 0;
+    MstartPoints = MuserStartPoints;
+
+    // compute the coarse grid and start from its best nodes
+    if (MstartPoints.empty())
+    {
+      std::vector<Node<Ctype, CresultData>*> nodes;
+      Iterator<Ctype, CresultData> iter(
+          Tbase::MparameterSpace->createIterator(ForwardNodeIter));
+      for (iter.first(); !iter.isDone(); ++iter)
+      {
+        nodes.push_back(static_cast<Node<Ctype, CresultData>*>(*iter));
+      }
+
+      if (job)
+      {
+        // guided scheduling
+        size_t const num_workers = pool->getNumThreads();
+        Node<Ctype, CresultData>** const end = nodes.data() + nodes.size();
+        for (Node<Ctype, CresultData>** begin = nodes.data(); begin != end; )
+        {
+          size_t const remaining = end - begin;
+          size_t const chunk = std::max<size_t>(1, remaining/(2*num_workers));
+          job->addTask(typename thread::Job<Ctype, CresultData>::Ttask(
+                new thread::NodeRangeTask<Ctype, CresultData>(begin,
+                  begin+chunk)));
+          begin += chunk;
+        }
+        job->wait();
+      } else
+      {
+        for (auto it(nodes.begin());
+            it != nodes.end() && ! progress.isCancelled(); ++it)
+        {
+          (*it)->accept(v);
+          progress.complete(1);
+        }
+      }
+      if (! progress.isCancelled())
+      {
+        MstartPoints = selectBest(*Tbase::MparameterSpace, MnumStarts,
+            Mcomparator);
+      }
+    }
+
+    // local search of each starting point
+    Mresults.resize(MstartPoints.size());
+    if (job)
+    {
+      for (size_t i = 0; i < MstartPoints.size(); ++i)
+      {
+        job->addTask(typename thread::Job<Ctype, CresultData>::Ttask(
+              new thread::LocalSearchTask<Ctype, CresultData>(*this, i)));
+      }
+      job->wait();
+      // merge the workers' clones of the application
+      job->merge();
+    } else
+    {
+      for (size_t i = 0; i < MstartPoints.size() && ! progress.isCancelled();
+          ++i)
+      {
+        search(i, v);
+        progress.complete(1);
+      }
+    }
+
+    // starting points not searched due to cancellation have no result
+    for (auto it(Mresults.begin()); it != Mresults.end(); ++it)
+    {
+      if (*it) { MbestNodes.push_back(it->get()); }
+    }
+    std::stable_sort(MbestNodes.begin(), MbestNodes.end(),
+        [this](Node<Ctype, CresultData> const* lhs,
+          Node<Ctype, CresultData> const* rhs)
+        {
+          return Mcomparator(lhs->getResultData(), rhs->getResultData());
+        });
+  } // function LocalSearch<Ctype, CresultData>::execute
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void LocalSearch<Ctype, CresultData>::search(size_t const start,
+      ParameterSpaceVisitor<Ctype, CresultData>& v)
+  {
+    // each task writes to the result of its own starting point only
+    switch (Mmethod)
+    {
+      case NelderMead:
+        Mresults[start] = searchNelderMead(MstartPoints[start], v);
+        break;
+      case CompassSearch:
+        Mresults[start] = searchCompass(MstartPoints[start], v);
+        break;
+      default:
+        OPTIMIZE_illegal;
+    }
+  } // function LocalSearch<Ctype, CresultData>::search
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  typename LocalSearch<Ctype, CresultData>::Tnode
+  LocalSearch<Ctype, CresultData>::evaluate(Tcoordinates coordinates,
+      ParameterSpaceVisitor<Ctype, CresultData>& v)
+  {
+    for (size_t d = 0; d < coordinates.size(); ++d)
+    {
+      std::shared_ptr<Parameter<Ctype> const> const& p =
+        Tbase::Mparameters[d];
+      Ctype const lower = std::min(p->getStart(), p->getEnd());
+      Ctype const upper = std::max(p->getStart(), p->getEnd());
+      coordinates[d] = std::min(upper, std::max(lower, coordinates[d]));
+    }
+
+    Tnode node(new Node<Ctype, CresultData>(coordinates));
+    // the parameter space provides the coordinate ids
+    node->setParent(Tbase::MparameterSpace.get());
+    node->accept(v);
+    ++Mevaluations;
+    return node;
+  } // function LocalSearch<Ctype, CresultData>::evaluate
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  typename LocalSearch<Ctype, CresultData>::Tnode
+  LocalSearch<Ctype, CresultData>::searchNelderMead(Tcoordinates const& start,
+      ParameterSpaceVisitor<Ctype, CresultData>& v)
+  {
+    size_t const dims = start.size();
+    // standard coefficients of reflection, expansion, contraction and
+    // shrinkage
+    double const alpha = 1., gamma = 2., rho = 0.5, sigma = 0.5;
+
+    // initial simplex spanned by the delta intervals
+    std::vector<Tnode> simplex;
+    simplex.push_back(evaluate(start, v));
+    for (size_t d = 0; d < dims; ++d)
+    {
+      std::shared_ptr<Parameter<Ctype> const> const& p =
+        Tbase::Mparameters[d];
+      Tcoordinates c(simplex[0]->getCoordinates());
+      Ctype const delta = std::abs(p->getDelta());
+      c[d] = c[d]+delta <= std::max(p->getStart(), p->getEnd()) ?
+        c[d]+delta : c[d]-delta;
+      simplex.push_back(evaluate(c, v));
+    }
+    size_t evaluations = dims+1;
+
+    // computes c + factor*(x - c)
+    auto const move = [dims](Ctype const* c, Ctype const* x,
+        double const factor)
+    {
+      Tcoordinates retval(dims);
+      for (size_t d = 0; d < dims; ++d)
+      {
+        retval[d] = c[d] + factor*(x[d]-c[d]);
+      }
+      return retval;
+    };
+
+    while (evaluations < MmaxEvaluations)
+    {
+      std::stable_sort(simplex.begin(), simplex.end(),
+          [this](Tnode const& lhs, Tnode const& rhs)
+          {
+            return isBetter(lhs, rhs);
+          });
+
+      // converged if the simplex is smaller than the tolerance
+      bool converged = true;
+      for (size_t d = 0; d < dims && converged; ++d)
+      {
+        double const tol =
+          Mtolerance*std::abs(Tbase::Mparameters[d]->getDelta());
+        for (size_t i = 1; i <= dims && converged; ++i)
+        {
+          converged = std::abs(simplex[i]->getCoordinateData()[d] -
+              simplex[0]->getCoordinateData()[d]) <= tol;
+        }
+      }
+      if (converged) { break; }
+
+      // centroid of all but the worst vertex
+      Tcoordinates centroid(dims, Ctype(0));
+      for (size_t i = 0; i < dims; ++i)
+      {
+        for (size_t d = 0; d < dims; ++d)
+        {
+          centroid[d] += simplex[i]->getCoordinateData()[d]/dims;
+        }
+      }
+      Tnode& worst = simplex[dims];
+
+      Tnode reflected(evaluate(move(centroid.data(),
+              worst->getCoordinateData(), -alpha), v));
+      ++evaluations;
+      if (isBetter(reflected, simplex[0]))
+      {
+        Tnode expanded(evaluate(move(centroid.data(),
+                reflected->getCoordinateData(), gamma), v));
+        ++evaluations;
+        worst = std::move(isBetter(expanded, reflected) ?
+            expanded : reflected);
+        continue;
+      }
+      if (isBetter(reflected, simplex[dims-1]))
+      {
+        worst = std::move(reflected);
+        continue;
+      }
+
+      // contraction - outside if the reflected point is better than the
+      // worst vertex, inside otherwise
+      bool const outside = isBetter(reflected, worst);
+      Tnode contracted(evaluate(move(centroid.data(), outside ?
+              reflected->getCoordinateData() : worst->getCoordinateData(),
+              rho), v));
+      ++evaluations;
+      if (outside ? ! isBetter(reflected, contracted) :
+          isBetter(contracted, worst))
+      {
+        worst = std::move(contracted);
+        continue;
+      }
+
+      // shrink towards the best vertex
+      for (size_t i = 1; i <= dims; ++i)
+      {
+        simplex[i] = evaluate(move(simplex[0]->getCoordinateData(),
+              simplex[i]->getCoordinateData(), sigma), v);
+        ++evaluations;
+      }
+    }
+
+    return std::move(*std::min_element(simplex.begin(), simplex.end(),
+          [this](Tnode const& lhs, Tnode const& rhs)
+          {
+            return isBetter(lhs, rhs);
+          }));
+  } // function LocalSearch<Ctype, CresultData>::searchNelderMead
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  typename LocalSearch<Ctype, CresultData>::Tnode
+  LocalSearch<Ctype, CresultData>::searchCompass(Tcoordinates const& start,
+      ParameterSpaceVisitor<Ctype, CresultData>& v)
+  {
+    size_t const dims = start.size();
+    Tnode best(evaluate(start, v));
+    size_t evaluations = 1;
+
+    std::vector<double> steps;
+    for (size_t d = 0; d < dims; ++d)
+    {
+      steps.push_back(std::abs(Tbase::Mparameters[d]->getDelta()));
+    }
+
+    while (evaluations < MmaxEvaluations)
+    {
+      // converged if each step is smaller than the tolerance
+      bool converged = true;
+      for (size_t d = 0; d < dims && converged; ++d)
+      {
+        converged = steps[d] <=
+          Mtolerance*std::abs(Tbase::Mparameters[d]->getDelta());
+      }
+      if (converged) { break; }
+
+      // poll the neighbours - move to the first improving one
+      bool improved = false;
+      for (size_t d = 0; d < dims && ! improved &&
+          evaluations < MmaxEvaluations; ++d)
+      {
+        for (int sign = 1; sign >= -1 && ! improved; sign -= 2)
+        {
+          Tcoordinates c(best->getCoordinates());
+          c[d] += sign*steps[d];
+          Tnode candidate(evaluate(c, v));
+          ++evaluations;
+          if (isBetter(candidate, best))
+          {
+            best = std::move(candidate);
+            improved = true;
+          }
+        }
+      }
+      if (! improved)
+      {
+        for (auto it(steps.begin()); it != steps.end(); ++it) { *it /= 2; }
+      }
+    }
+    return best;
+  } // function LocalSearch<Ctype, CresultData>::searchCompass
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF localsearch.h  ----- */
@@ -32,6 +32,21 @@
  * 16/03/2012   V0.1    Daniel Armbruster
  * 18/04/2012   V0.2    Completely use C++0x.
  * 25/04/2012   V0.3    Make use of smart pointers and C++0x.
+ * 14/10/2026   V0.4    Make use of a random access node iterator.
+ * 14/10/2026   V0.5    Make use of the threadpool. Reproducible random number
+ *                       streams.
+ * 14/10/2026   V0.6    Unique, sorted samples within the parameter space.
+ * 14/10/2026   V0.7    Merge per thread clones of the application.
+ * 14/10/2026   V0.8    Checkpoint/resume by means of a checkpoint file.
+ * 14/10/2026   V0.9    Apply the application through a result cache.
+ * 14/10/2026   V0.10   Compute a partition of the parameter space only.
+ * 14/10/2026   V0.11   Progress, cancellation and shared thread pools.
+ * 14/10/2026   V0.12   Optional instrumentation.
+ * 14/10/2026   V0.13   Latin hypercube, Halton and Sobol sampling.
+ * 14/10/2026   V0.14   Skip the nodes already computed.
+ * 14/10/2026   V0.15   Finish the progress of an execution.
+ * 14/10/2026   V0.16   Unique sampling is disabled by default. Equal samples
+ *                       are computed by the same task.
  * 
  * ============================================================================
  */
@@ -40,10 +55,18 @@
 #include <memory>
 #include <random>
 #include <functional>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <string>
 #include <optimizexx/globalalgorithm.h>
 #include <optimizexx/parameter.h>
+#include <optimizexx/threadpool.h>
 #include <optimizexx/error.h>
 #include <optimizexx/iterator.h>
+#include <optimizexx/checkpoint.h>
+#include <optimizexx/sampling.h>
  
 #ifndef _OPTIMIZEXX_MONTECARLO_H_
 #define _OPTIMIZEXX_MONTECARLO_H_
@@ -56,15 +79,72 @@ namespace optimize
   template <typename Ctype> class Parameter;
 
   /* ======================================================================= */
-  //! distribution types
+  /*!
+   * distribution types\n
+   * The probability distributions draw positions of the flattened node
+   * index. The space-filling designs sample each dimension of the parameter
+   * space (see optimize::PointSequence).
+   */
   enum Edistribution
   {
     UniformInt,
     Poisson,
     Exponential,
-    Normal
+    Normal,
+    LatinHypercube, //!< Latin hypercube sampling
+    Halton,         //!< quasi-random Halton sequence
+    Sobol           //!< quasi-random Sobol sequence
   }; // enum Edistribution
 
+  /* ======================================================================= */
+  /*!
+   * Thread pool task of the Monte Carlo algorithm. The task applies the
+   * application to a range of samples i.e. positions of nodes drawn. If a
+   * checkpoint is passed the results are stored into the checkpoint and
+   * nodes already computed according to the checkpoint are skipped.
+   *
+   * \ingroup group_thread
+   */
+  template <typename Ctype, typename CresultData>
+  class MonteCarloTask : public thread::Task<Ctype, CresultData>
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param iter random access node iterator of the parameter space
+       * \param begin pointer to the first position of the range
+       * \param end pointer past the last position of the range
+       * \param checkpoint checkpoint the results are stored into (optional)
+       */
+      MonteCarloTask(Iterator<Ctype, CresultData> const& iter,
+          size_t const* begin, size_t const* end,
+          Checkpoint<CresultData>* checkpoint = 0) :
+        Miter(iter), Mbegin(begin), Mend(end), Mcheckpoint(checkpoint)
+      { }
+      //! destructor
+      virtual ~MonteCarloTask() { }
+      /*!
+       * apply an application to the nodes of the range
+       *
+       * \param app application to be applied
+       */
+      virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app);
+      //! query function for the number of samples of the task
+      virtual size_t getSize() const { return Mend-Mbegin; }
+
+    private:
+      //! random access node iterator (own copy of the task)
+      Iterator<Ctype, CresultData> Miter;
+      //! first position of the range
+      size_t const* Mbegin;
+      //! position past the last position of the range
+      size_t const* Mend;
+      //! checkpoint
+      Checkpoint<CresultData>* Mcheckpoint;
+
+  }; // class template MonteCarloTask
+
   /* ======================================================================= */
   /*!
    * Grid search algorithm.\n
@@ -77,7 +157,40 @@ namespace optimize
    * If compiling the library with \a C++11 support there is the opportunity to
    * select the probability distribution the algorithm will use to generate the
    * random numbers will be generated else only calculating values using the
-   * normal/gaussian distribution will be provided.
+   * normal/gaussian distribution will be provided.\n
+   *
+   * The probability distributions draw positions of the flattened node index.
+   * Hence they cluster the samples within the linear ordering of the nodes
+   * rather than covering the parameter space. The space-filling designs
+   * (LatinHypercube, Halton and Sobol) instead sample each dimension of the
+   * parameter space so that far fewer samples are necessary to cover it. The
+   * quasi-random sequences are shifted randomly according to the seed
+   * (Cranley-Patterson rotation). The space-filling designs require a
+   * parameter space without subgrids.\n
+   *
+   * Samples are drawn in blocks of a fixed size. Each block makes use of its
+   * own random number stream which is seeded deterministically by the seed of
+   * the algorithm and the number of the block. So the samples drawn only
+   * depend on the seed but not on the number of threads in use.\n
+   *
+   * Drawn values outside of the parameter space are discarded. By default a
+   * node may be drawn several times. If unique sampling is enabled (see
+   * setUniqueSampling) nodes which already had been computed are skipped and
+   * if a drawn node already is taken the nearest free node is used instead.
+   * Finally the samples are sorted so that the parameter space is visited in
+   * memory order. Equal samples never are split into different tasks, thus a
+   * node drawn several times is not computed concurrently.\n
+   *
+   * If a checkpoint file is set the results are stored into this file as
+   * soon as the nodes had been computed (see optimize::Checkpoint). When
+   * executing the algorithm once again with the same file and seed, the same
+   * samples are drawn, the results stored are restored and the nodes already
+   * computed are skipped.\n
+   *
+   * If the parameter space is divided into partitions (see
+   * optimize::GlobalAlgorithm::setPartition) the samples are drawn from the
+   * entire parameter space but only the samples of the partition are
+   * computed. Thus all partitions have to make use of the same seed.
    *
    * \ingroup group_global_algos
    */
@@ -93,16 +206,21 @@ namespace optimize
        *
        * \param builder Pointer to a builder of a parameter space.
        * \param distr type of probability distribution
+       * \param percent percentage of nodes to be computed
+       * \param num_threads Number of threads the algorithm uses for parallel
+       * computation
        */
       MonteCarlo(
           std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder,
-          Edistribution distr=Normal, float const percent=5) : 
+          Edistribution distr=Normal, float const percent=5,
+          size_t num_threads=0) : 
 #if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
           Tbase(nullptr, std::move(builder)), Mdistribution(distr),
 #else
           Tbase(std::move(builder)), Mdistribution(distr),
 #endif
-          Mpercentage(percent)
+          Mpercentage(percent), MnumThreads(num_threads),
+          Mseed(std::random_device()()), Munique(false)
       { 
         OPTIMIZE_assert(Mpercentage > 0 && Mpercentage <= 100.,
             "Illegal value.");
@@ -114,17 +232,22 @@ namespace optimize
        * Default is a StandardParameterSpaceBuilder.
        * \param parameters STL vector of parameters.
        * \param distr type of probability distribution
+       * \param percent percentage of nodes to be computed
+       * \param num_threads Number of threads the algorithm uses for parallel
+       * computation
        */
       MonteCarlo(
           std::unique_ptr<ParameterSpaceBuilder<Ctype, CresultData>> builder,
           std::vector<std::shared_ptr<Parameter<Ctype> const>> const parameters,
-          Edistribution distr=Normal, float const percent=5) :
+          Edistribution distr=Normal, float const percent=5,
+          size_t num_threads=0) :
 #if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
           Tbase(nullptr, std::move(builder), parameters), Mdistribution(distr),
 #else
           Tbase(std::move(builder), parameters), Mdistribution(distr),
 #endif
-          Mpercentage(percent)
+          Mpercentage(percent), MnumThreads(num_threads),
+          Mseed(std::random_device()()), Munique(false)
       { 
         OPTIMIZE_assert(Mpercentage > 0 && Mpercentage <= 100.,
             "Illegal value.");
@@ -142,20 +265,95 @@ namespace optimize
        * parameter space \sa ParameterSpace
        */
       virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * Set the seed of the random number streams. Executing the algorithm
+       * twice with the same seed computes the same nodes. By default the
+       * seed is obtained from std::random_device.
+       *
+       * \param seed seed
+       */
+      void setSeed(unsigned int seed) { Mseed = seed; }
+      //! query function for the seed of the random number streams
+      unsigned int getSeed() const { return Mseed; }
+      /*!
+       * Enable or disable unique sampling. If enabled no node is drawn twice
+       * and nodes which already had been computed are skipped. Unique
+       * sampling is disabled by default.
+       *
+       * \param unique sampling mode flag
+       */
+      void setUniqueSampling(bool unique) { Munique = unique; }
+      //! query function if unique sampling is enabled
+      bool isUniqueSampling() const { return Munique; }
+      /*!
+       * Set the checkpoint file the results are stored into.
+       *
+       * \param filename name of the checkpoint file - an empty name disables
+       * checkpointing
+       */
+      void setCheckpointFile(std::string const& filename)
+      {
+        McheckpointFile = filename;
+      }
+      //! query function for the name of the checkpoint file
+      std::string const& getCheckpointFile() const { return McheckpointFile; }
 
     private:
+      /*!
+       * Create the random number generator of a block of samples.
+       *
+       * \param block number of the block
+       * \param num_nodes number of nodes of the parameter space
+       * \return random number generator
+       */
+      std::function<double()> createGenerator(size_t const block,
+          size_t const num_nodes) const;
+      /*!
+       * Draw the samples (positions of nodes) to be computed.
+       *
+       * \param iter random access node iterator of the parameter space
+       * \return sorted positions of the nodes
+       */
+      std::vector<size_t> drawSamples(Iterator<Ctype, CresultData>& iter)
+        const;
+      /*!
+       * Draw samples by means of a space-filling design.
+       *
+       * \param num_samples number of samples to be drawn
+       * \param taken nodes which must not be drawn - updated
+       * \param samples samples drawn
+       */
+      void drawSpaceFillingSamples(size_t const num_samples,
+          std::vector<bool>& taken, std::vector<size_t>& samples) const;
+
+    private:
+      //! number of samples drawn by a single random number stream
+      static size_t const MsamplesPerBlock = 256;
       //! probability distribution
       Edistribution Mdistribution;
       //! percentage of how many nodes in a grid will be computed
       float Mpercentage;
+      //! status variable if algorithm uses multiple threads
+      size_t MnumThreads;
+      //! seed of the random number streams
+      unsigned int Mseed;
+      //! sampling mode flag
+      bool Munique;
+      //! name of the checkpoint file
+      std::string McheckpointFile;
 
   }; // class template MonteCarlo
   
   /* ======================================================================= */
   template <typename Ctype, typename CresultData>
+  size_t const MonteCarlo<Ctype, CresultData>::MsamplesPerBlock;
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
   void MonteCarlo<Ctype, CresultData>::constructParameterSpace()
   {
     OPTIMIZE_assert(Tbase::Mparameters.size() != 0, "Missing parameters.");
+    OPTIMIZE_phase(Tbase::Minstrumentation, Instrumentation::Construction);
     Tbase::MparameterSpaceBuilder->buildParameterSpace();
     Tbase::MparameterSpaceBuilder->buildGrid(Tbase::Mparameters);
     Tbase::MparameterSpace = 
@@ -165,32 +363,275 @@ namespace optimize
   /* ----------------------------------------------------------------------- */
   template <typename Ctype, typename CresultData>
   void MonteCarlo<Ctype, CresultData>::execute(
-      ParameterSpaceVisitor<Ctype, CresultData>& v)
+      ParameterSpaceVisitor<Ctype, CresultData>& visitor)
   {
     OPTIMIZE_assert(Tbase::MparameterSpace, "Missing parameter space.");
+    Progress& progress = Tbase::startProgress();
+    ScopedProgress const finish(progress);
+    OPTIMIZE_phase(Tbase::Minstrumentation, Instrumentation::Execution);
 
+    // apply the application through the instrumentation, the result cache
+    // and the skipping of the nodes already computed if any
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> instrumented(
+        Tbase::createInstrumentingVisitor(visitor));
+    ParameterSpaceVisitor<Ctype, CresultData>& measured =
+      instrumented ? *instrumented : visitor;
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> cached(
+        Tbase::createCachingVisitor(measured));
+    ParameterSpaceVisitor<Ctype, CresultData>& lookup =
+      cached ? *cached : measured;
+    std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> incremental(
+        Tbase::createIncrementalVisitor(lookup));
+    ParameterSpaceVisitor<Ctype, CresultData>& v =
+      incremental ? *incremental : lookup;
+
+    // random access - advance() is done in constant time
     Iterator<Ctype, CresultData> iter(
-        Tbase::MparameterSpace->createIterator(ForwardNodeIter));
-    iter.first();
-    Iterator<Ctype, CresultData> iter_last(
-        Tbase::MparameterSpace->createIterator(ForwardNodeIter));
-    iter_last.back();
+        Tbase::MparameterSpace->createIterator(RandomAccessNodeIter));
+
+    std::vector<size_t> const samples = drawSamples(iter);
+    // samples of the partition - samples are sorted
+    size_t first = 0;
+    size_t last = 0;
+    Tbase::getPartitionRange(iter.getSize(), first, last);
+    size_t const* const begin = samples.data() + (std::lower_bound(
+          samples.cbegin(), samples.cend(), first) - samples.cbegin());
+    size_t const* const end = samples.data() + (std::lower_bound(
+          samples.cbegin(), samples.cend(), last) - samples.cbegin());
+
+    // restore results of a previous execution
+    std::unique_ptr<Checkpoint<CresultData>> checkpoint;
+    if (! McheckpointFile.empty())
+    {
+      OPTIMIZE_assert(1 == Tbase::getPartitionCount(),
+          "Partitions do not support checkpointing.");
+      checkpoint.reset(new Checkpoint<CresultData>(McheckpointFile,
+            iter.getSize()));
+      checkpoint->restore(iter);
+    }
+
+    // simple single threading execution - block by block to be cancelable
+    if (! Tbase::isConcurrent(MnumThreads))
+    {
+      progress.submit(end-begin);
+      for (size_t const* block = begin; block != end; )
+      {
+        size_t const chunk = std::min<size_t>(MsamplesPerBlock, end-block);
+        if (progress.isCancelled())
+        {
+          progress.discard(end-block);
+          break;
+        }
+        MonteCarloTask<Ctype, CresultData> task(iter, block, block+chunk,
+            checkpoint.get());
+        progress.begin(chunk);
+        task.execute(v);
+        progress.end(chunk);
+        block += chunk;
+      }
+    } else
+    {
+      // thread pool for parallel computation - shared or of its own
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool(
+          Tbase::createThreadPool(MnumThreads));
+      thread::Job<Ctype, CresultData> job(*pool, v, progress,
+          Tbase::getJobInstrumentation());
+
+      // add tasks (blocks of samples) to pool task queue - equal samples
+      // are kept within the same block so that no node is computed
+      // concurrently
+      for (size_t const* block = begin; block != end; )
+      {
+        size_t const* next =
+          block+std::min<size_t>(MsamplesPerBlock, end-block);
+        while (next != end && *next == *(next-1)) { ++next; }
+        job.addTask(typename thread::Job<Ctype, CresultData>::Ttask(
+              new MonteCarloTask<Ctype, CresultData>(iter, block,
+                next, checkpoint.get())));
+        block = next;
+      }
+
+      // wait until all tasks had been completed
+      job.wait();
+      // merge the workers' clones of the application
+      job.merge();
+    }
+    if (checkpoint) { checkpoint->sync(); }
+  } // function MonteCarlo<Ctype, CresultData>::execute()
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::vector<size_t> MonteCarlo<Ctype, CresultData>::drawSamples(
+      Iterator<Ctype, CresultData>& iter) const
+  {
+    size_t const num_nodes = iter.getSize();
+    size_t num_samples = (Mpercentage/100.)*num_nodes;
+
+    // nodes which must not be drawn (anymore)
+    std::vector<bool> taken(num_nodes, false);
+    if (Munique)
+    {
+      size_t num_free = num_nodes;
+      for (iter.first(); !iter.isDone(); ++iter)
+      {
+        if ((*iter)->isComputed())
+        {
+          taken[iter.getPosition()] = true;
+          --num_free;
+        }
+      }
+      num_samples = std::min(num_samples, num_free);
+    }
 
-    unsigned int num_elements =
-      distance<Iterator<Ctype, CresultData>, Iterator<Ctype, CresultData>>(
-          iter, iter_last);
+    std::vector<size_t> samples;
+    samples.reserve(num_samples);
+    if (LatinHypercube == Mdistribution || Halton == Mdistribution ||
+        Sobol == Mdistribution)
+    {
+      drawSpaceFillingSamples(num_samples, taken, samples);
+    } else
+    {
+      for (size_t block = 0; samples.size() < num_samples; ++block)
+      {
+        std::function<double()> generator(createGenerator(block, num_nodes));
+        for (size_t i = 0;
+            i < MsamplesPerBlock && samples.size() < num_samples; ++i)
+        {
+          double const value = std::round(generator());
+          // discard values outside of the parameter space
+          if (value < 0 || value >= num_nodes) { continue; }
+          size_t pos = value;
+          if (Munique && taken[pos])
+          {
+            // search the nearest free node
+            for (size_t d = 1; ; ++d)
+            {
+              if (pos+d < num_nodes && !taken[pos+d]) { pos += d; break; }
+              if (pos >= d && !taken[pos-d]) { pos -= d; break; }
+            }
+          }
+          taken[pos] = true;
+          samples.push_back(pos);
+        }
+      }
+    }
 
-    std::vector<unsigned int> indices((Mpercentage/100.)*num_elements);
+    // visit the parameter space in memory order
+    std::sort(samples.begin(), samples.end());
+    return samples;
+  } // function MonteCarlo<Ctype, CresultData>::drawSamples
 
-    // generate vector with random numbers
-    unsigned int mean = num_elements/2;
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void MonteCarlo<Ctype, CresultData>::drawSpaceFillingSamples(
+      size_t const num_samples, std::vector<bool>& taken,
+      std::vector<size_t>& samples) const
+  {
+    size_t const num_nodes = taken.size();
+    size_t const dims = Tbase::Mparameters.size();
+    // number of nodes per dimension - the first coordinate varies fastest
+    std::vector<size_t> sizes;
+    size_t num = 1;
+    for (auto cit(Tbase::Mparameters.cbegin());
+        cit != Tbase::Mparameters.cend(); ++cit)
+    {
+      sizes.push_back((*cit)->getSamples());
+      num *= sizes.back();
+    }
+    OPTIMIZE_assert(num == num_nodes,
+        "Space-filling designs require a parameter space without subgrids.");
+
+    std::unique_ptr<PointSequence> sequence;
+    std::unique_ptr<LatinHypercubeSequence> lhs;
+    if (LatinHypercube == Mdistribution)
+    {
+      lhs.reset(new LatinHypercubeSequence(dims, num_samples, Mseed));
+    } else
+    if (Halton == Mdistribution)
+    {
+      sequence.reset(new HaltonSequence(dims));
+    } else
+    {
+      sequence.reset(new SobolSequence(dims));
+    }
+
+    // random shift of the quasi-random sequences
+    std::vector<double> shift(dims, 0.);
+    if (! lhs)
+    {
+      std::seed_seq seq{static_cast<std::uint_least32_t>(Mseed),
+        static_cast<std::uint_least32_t>(dims)};
+      std::mt19937 engine(seq);
+      std::uniform_real_distribution<double> ud(0., 1.);
+      for (auto it(shift.begin()); it != shift.end(); ++it)
+      {
+        *it = ud(engine);
+      }
+    }
+
+    std::vector<double> point;
+    // size of the current batch of the Latin hypercube
+    size_t batch = num_samples;
+    // attempts before falling back to the nearest free node
+    size_t const max_attempts = 64*num_nodes;
+    for (size_t attempt = 0, i = 0; samples.size() < num_samples;
+        ++attempt, ++i)
+    {
+      if (lhs)
+      {
+        // batches cover the number of samples still missing
+        if (i == batch)
+        {
+          batch = num_samples-samples.size();
+          lhs->setBatchSize(batch);
+          i = 0;
+        }
+        lhs->next(point);
+      } else
+      {
+        sequence->next(point);
+      }
+      size_t pos = 0;
+      size_t stride = 1;
+      for (size_t d = 0; d < dims; ++d)
+      {
+        double u = point[d]+shift[d];
+        if (1. <= u) { u -= 1.; }
+        pos += std::min<size_t>(u*sizes[d], sizes[d]-1)*stride;
+        stride *= sizes[d];
+      }
+      if (Munique && taken[pos])
+      {
+        if (attempt < max_attempts) { continue; }
+        // search the nearest free node
+        for (size_t d = 1; ; ++d)
+        {
+          if (pos+d < num_nodes && !taken[pos+d]) { pos += d; break; }
+          if (pos >= d && !taken[pos-d]) { pos -= d; break; }
+        }
+      }
+      taken[pos] = true;
+      samples.push_back(pos);
+    }
+  } // function MonteCarlo<Ctype, CresultData>::drawSpaceFillingSamples
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::function<double()> MonteCarlo<Ctype, CresultData>::createGenerator(
+      size_t const block, size_t const num_nodes) const
+  {
+    // random number stream of the block
+    std::seed_seq seq{static_cast<std::uint_least32_t>(Mseed),
+      static_cast<std::uint_least32_t>(block)};
+    std::mt19937 engine(seq);
+
+    unsigned int const last = num_nodes-1;
+    unsigned int const mean = num_nodes/2;
 
     std::function<double()> generator;
-    std::random_device generate_seed;
-    std::mt19937 engine(generate_seed());
     if (UniformInt == Mdistribution)
     {
-      std::uniform_int_distribution<unsigned int> ui(0,num_elements);
+      std::uniform_int_distribution<unsigned int> ui(0,last);
       generator = std::bind(ui, engine);
     } else
     if (Poisson == Mdistribution)
@@ -207,19 +648,32 @@ namespace optimize
       std::normal_distribution<float> nd(mean, mean/3.);
       generator = std::bind(nd, engine);
     }
+    return generator;
+  } // function MonteCarlo<Ctype, CresultData>::createGenerator
 
-    for (size_t i = 0; i < indices.size(); ++i)
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void MonteCarloTask<Ctype, CresultData>::execute(
+      ParameterSpaceVisitor<Ctype, CresultData>& app)
+  {
+    for (size_t const* pos = Mbegin; pos != Mend; ++pos)
     {
-      indices[i] = std::round(generator()); 
+      if (Mcheckpoint && Mcheckpoint->isComputedAt(*pos)) { continue; }
+      Miter.first();
+      Miter.advance(*pos);
+      (*Miter)->accept(app);
+      if (Mcheckpoint)
+      {
+        (*Miter)->setComputed();
+        Mcheckpoint->setResultDataAt(*pos, (*Miter)->getResultData());
+      }
     }
-
-    for (auto cit(indices.cbegin()); cit != indices.cend(); ++cit)
+    // samples are sorted
+    if (Mcheckpoint && Mbegin != Mend)
     {
-      iter.first();
-      advance<Iterator<Ctype, CresultData>>(iter, *cit);
-      (*iter)->accept(v);
+      Mcheckpoint->flush(*Mbegin, *(Mend-1)+1);
     }
-  } // function MonteCarlo<Ctype, CresultData>::execute()
+  } // function MonteCarloTask<Ctype, CresultData>::execute
 
   /* ----------------------------------------------------------------------- */
 
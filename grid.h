@@ -30,17 +30,23 @@
  * 
  * REVISIONS and CHANGES 
  * 29/02/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Grids own the arena their components are allocated from.
+ * 14/10/2026  V0.3  Constant time insertion of grid components.
+ * 14/10/2026  V0.4  Release the children of a grid.
+ * 14/10/2026  V0.5  Children stored contiguously; skip the destruction of
+ *                   trivially disposable children.
+ * 14/10/2026  V0.6  Document the invalidation of iterators.
  * 
  * ============================================================================
  */
 
-#include <list>
 #include <string>
 #include <vector>
 #include <ostream>
 #include <algorithm>
 #include <memory>
 #include <optimizexx/gridcomponent.h>
+#include <optimizexx/arena.h>
 
 #ifndef _OPTIMIZEXX_GRID_H_
 #define _OPTIMIZEXX_GRID_H_
@@ -59,10 +65,21 @@ namespace optimize
    * could contain subgrids and nodes.
    * Composite class of the composite design pattern (GoF p.163).\n
    *
+   * The children are stored contiguously. If all of them are trivially
+   * disposable (see optimize::TriviallyDisposable) and allocated from an
+   * arena the destructor of the grid does not visit them at all.\n
+   *
+   * Since the children are stored contiguously, adding or removing children
+   * invalidates all iterators over the children of the grid, i.e. the
+   * iterators returned by begin(), end(), rbegin() and rend() as well as
+   * parameter space iterators (optimize::Iterator) and their iteration
+   * states passing the grid. Pointers to the children remain valid. Thus
+   * create new iterators after modifying a grid.\n
+   *
    * IMPORTANT NOTE:\n
    * The solution to add the typdef Titer to class GridComponent isn't really
    * convenient because in case a new composite class would be created storing
-   * its children in a different container than a list I would get into
+   * its children in a different container than a vector I would get into
    * trouble.\n
    * \b Solution?
    * 
@@ -84,9 +101,20 @@ namespace optimize
 
     public:
       //! constructor
-      Grid() : Tbase(0, false) { }
+      Grid() : Tbase(0, false), MnumDestructed(0) { }
       //! constructor
-      Grid(std::vector<std::string> const coordIds) : Tbase(0, false) { }
+      Grid(std::vector<std::string> const coordIds) : Tbase(0, false),
+        MnumDestructed(0)
+      { }
+      /*!
+       * constructor
+       *
+       * \param arena arena the components of the grid should be allocated
+       * from
+       */
+      Grid(std::shared_ptr<Arena> arena) : Tbase(0, false),
+        MnumDestructed(0), Marena(arena)
+      { }
       //! destructor
       virtual ~Grid();
       /*! 
@@ -108,17 +136,41 @@ namespace optimize
       virtual Iterator<Ctype, CresultData> createIterator(
           EiteratorType iter_type, EiterationMode iter_mode=PostOrder) const;
       /*!
-       * Add a gridcomponent to the grid composite.
+       * Add a gridcomponent to the grid composite. Adding a component which
+       * already is a child of the grid has no effect. Insertion is done in
+       * constant time since a child is recognized by its parent.\n
+       * Adding a component invalidates the iterators over the children of
+       * the grid. Afterwards rbegin() refers to the component added.
        * 
        * \param gridcomponent Component which will be added to the grid.
        */
       virtual void add(Tbase_ptr gridcomponent);
       /*!
-       * Remove a gridcomponent of the grid composite.
+       * Add a range of grid components to the grid composite. Components
+       * which already are children of the grid are skipped. Adding
+       * components invalidates the iterators over the children of the grid.
+       *
+       * \param first pointer to the first component of the range
+       * \param last pointer past the last component of the range
+       */
+      virtual void addRange(Tbase_ptr const* first, Tbase_ptr const* last);
+      /*!
+       * Remove a gridcomponent of the grid composite. Removing a component
+       * invalidates the iterators over the children of the grid.
        * 
        * \param gridcomponent Component which will be removed of the grid.
        */
       virtual void remove(Tbase_ptr gridcomponent);
+      /*!
+       * Detach all children of the grid without destroying them. The
+       * ownership of the children passes to the caller who either adds them
+       * to a grid again or destroys them (see GridComponent::destroy()).
+       * Children allocated from the arena of the grid must not outlive the
+       * grid.
+       *
+       * \param children vector the children are appended to in order
+       */
+      void releaseChildren(std::vector<Tbase_ptr>& children);
       //! query function for coordinate Ids
       virtual std::vector<std::string> const& getCoordinateId() const;
       //! Set coordinate Ids of the grid
@@ -154,14 +206,21 @@ namespace optimize
        * composite.
        */
       virtual Treverse_iter rend() { return Mchildren.rend(); }
+      //! query function for the arena the components should be allocated from
+      virtual std::shared_ptr<Arena> getArena() const { return Marena; }
+      /*!
+       * Set the arena the components of the grid should be allocated from.
+       * The grid keeps the arena alive as long as it exists.
+       */
+      void setArena(std::shared_ptr<Arena> arena) { Marena = arena; }
 
     private:
       //! Constant iterator for children.
-      typedef typename 
-        std::list<GridComponent<Ctype, CresultData>* >::const_iterator 
-        Tconst_iter;
-      //! List to store grids' children.
-      std::list<Tbase_ptr> Mchildren;
+      typedef typename Tbase::Tconst_iter Tconst_iter;
+      //! Vector to store grids' children.
+      std::vector<Tbase_ptr> Mchildren;
+      //! number of children which require destruction
+      size_t MnumDestructed;
       /*!
        * Vector to store coordinate ids.
        * Notice, that a grid caches this information for all of its children,
@@ -169,6 +228,11 @@ namespace optimize
        * coordinate ids.
        */
       std::vector<std::string> McoordinateIds;
+      /*!
+       * Arena of the grid components. Notice that the arena is destroyed
+       * after the children had been destroyed.
+       */
+      std::shared_ptr<Arena> Marena;
 
   }; // class template Grid
 
@@ -176,11 +240,12 @@ namespace optimize
   template <typename Ctype, typename CresultData>
   Grid<Ctype, CresultData>::~Grid()
   {
+    // the memory of trivially disposable children is released by the arena
+    if (0 == MnumDestructed) { return; }
     for (Titer it(Mchildren.begin()); it != Mchildren.end(); ++it)
     {
-      delete *it;
+      Tbase::destroy(*it);
     }
-    Mchildren.clear(); 
   }
 
   /* ----------------------------------------------------------------------- */
@@ -199,11 +264,27 @@ namespace optimize
   template <typename Ctype, typename CresultData>
   void Grid<Ctype, CresultData>::add(Tbase_ptr gridcomponent)
   {
-    Titer iter = find(Mchildren.begin(), Mchildren.end(), gridcomponent);
-    if (Mchildren.end() == iter)
+    // children know their parent - no need to search the children
+    if (this != gridcomponent->getParent())
     {
       gridcomponent->setParent(this);
       Mchildren.push_back(gridcomponent);
+      if (Tbase::requiresDestruction(gridcomponent)) { ++MnumDestructed; }
+      Tbase::Mcomputed = false;
+    }
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void Grid<Ctype, CresultData>::addRange(Tbase_ptr const* first,
+      Tbase_ptr const* last)
+  {
+    for (; first != last; ++first)
+    {
+      if (this == (*first)->getParent()) { continue; }
+      (*first)->setParent(this);
+      Mchildren.push_back(*first);
+      if (Tbase::requiresDestruction(*first)) { ++MnumDestructed; }
       Tbase::Mcomputed = false;
     }
   }
@@ -216,11 +297,28 @@ namespace optimize
     if (Mchildren.end() != iter)
     {
       gridcomponent->setParent(0);
-      delete *iter;
+      if (Tbase::requiresDestruction(gridcomponent)) { --MnumDestructed; }
+      Tbase::destroy(*iter);
       Mchildren.erase(iter);
     }
   }
 
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void Grid<Ctype, CresultData>::releaseChildren(
+      std::vector<Tbase_ptr>& children)
+  {
+    children.reserve(children.size() + Mchildren.size());
+    for (Titer it(Mchildren.begin()); it != Mchildren.end(); ++it)
+    {
+      (*it)->setParent(0);
+      children.push_back(*it);
+    }
+    Mchildren.clear();
+    MnumDestructed = 0;
+    Tbase::Mcomputed = false;
+  }
+
   /* ----------------------------------------------------------------------- */
   template <typename Ctype, typename CresultData>
   std::vector<std::string> const& 
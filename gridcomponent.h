@@ -30,16 +30,28 @@
  * 
  * REVISIONS and CHANGES 
  * 20/02/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation of grid components from an arena.
+ * 14/10/2026  V0.3  Bulk insertion of grid components.
+ * 14/10/2026  V0.4  Construction within memory allocated in advance.
+ * 14/10/2026  V0.5  Coordinates are returned by value.
+ * 14/10/2026  V0.6  Children are stored contiguously; trivially disposable
+ *                   components.
+ * 14/10/2026  V0.7  Recycling of arena memory.
+ * 14/10/2026  V0.8  Coordinates are returned by reference again.
  * 
  * ============================================================================
  */
 
 #include <ostream>
 #include <vector>
-#include <list>
 #include <string>
 #include <memory>
+#include <utility>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
 #include <optimizexx/application.h>
+#include <optimizexx/arena.h>
 #include <optimizexx/parameter.h>
 #include <optimizexx/iterator.h>
 #include <optimizexx/iterator/iteratorstrategyfactory.h>
@@ -50,6 +62,24 @@
 
 namespace optimize
 {
+  /* ======================================================================= */
+  /*!
+   * Trait if the destructor of a grid component allocated from an arena
+   * might be skipped because it does not release any resources (e.g. a
+   * optimize::FixedNode of trivial types). The memory of such components is
+   * released by the arena only so that disposing a large grid does not have
+   * to touch its nodes at all. Specialize the trait for components which
+   * are trivially disposable.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ccomponent>
+  struct TriviallyDisposable
+  {
+    //! status variable
+    static bool const value = false;
+  }; // struct TriviallyDisposable
+
   /* ======================================================================= */
   //! \defgroup group_grid grid modul
   /*! 
@@ -60,7 +90,11 @@ namespace optimize
    * interface.
    * By default several functions throw Exceptions at runtime if a function of
    * a component is called which had not been redefined by an inherited grid
-   * component.
+   * component.\n
+   *
+   * Grid components either are allocated by \c new or from an arena (see
+   * create()). In both cases a composite owns its children and disposes them
+   * by means of destroy().
    *
    * \ingroup group_grid
    */
@@ -75,17 +109,17 @@ namespace optimize
         Composite
       };
       //! Usual iterator for the children of a composite.
-      typedef typename std::list<GridComponent<Ctype, CresultData>*>::iterator
-        Titer;
+      typedef typename
+        std::vector<GridComponent<Ctype, CresultData>*>::iterator Titer;
       //! Constant iterator for the children of a composite.
       typedef typename
-        std::list<GridComponent<Ctype, CresultData>*>::const_iterator
+        std::vector<GridComponent<Ctype, CresultData>*>::const_iterator
         Tconst_iter;
       //! Reverse iterator for children of a composite.
-      typedef typename std::list<
+      typedef typename std::vector<
         GridComponent<Ctype, CresultData>*>::reverse_iterator Treverse_iter;
       //! Constant reverse iterator for children of a composite.
-      typedef typename std::list<
+      typedef typename std::vector<
         GridComponent<Ctype, CresultData>*>::const_reverse_iterator
         Tconst_reverse_iter;
 
@@ -101,6 +135,14 @@ namespace optimize
       virtual void accept(ParameterSpaceVisitor<Ctype, CresultData>& v) = 0;
       //! Add a grid component to a composite.
       virtual void add(GridComponent<Ctype, CresultData>* gridcomponent);
+      /*!
+       * Add a range of grid components to a composite.
+       *
+       * \param first pointer to the first component of the range
+       * \param last pointer past the last component of the range
+       */
+      virtual void addRange(GridComponent<Ctype, CresultData>* const* first,
+          GridComponent<Ctype, CresultData>* const* last);
       //! Remove a grid component from a composite.
       virtual void remove(GridComponent<Ctype, CresultData>* gridcomponent);
       /*!
@@ -157,12 +199,78 @@ namespace optimize
       void setParent(GridComponent<Ctype, CresultData>* p) { Mparent = p; }
       //! Query function for the parent of the grid component.
       GridComponent<Ctype, CresultData>* getParent() const;
+      /*!
+       * Query function for the arena children of the grid component should
+       * be allocated from.
+       *
+       * \return arena - empty if children are allocated by \c new
+       */
+      virtual std::shared_ptr<Arena> getArena() const
+      {
+        return std::shared_ptr<Arena>();
+      }
+      /*!
+       * Create a grid component within an arena.
+       *
+       * \param arena arena the grid component is allocated from
+       * \param args arguments passed to the constructor of the component
+       * \return pointer to the grid component
+       */
+      template <typename Ccomponent, typename... Cargs>
+      static Ccomponent* create(Arena& arena, Cargs&&... args);
+      /*!
+       * Construct a grid component within memory which had been allocated
+       * from an arena in advance (e.g. for a batch of nodes).
+       *
+       * \param memory memory of at least \c sizeof(Ccomponent) bytes
+       * allocated from an arena
+       * \param args arguments passed to the constructor of the component
+       * \return pointer to the grid component
+       */
+      template <typename Ccomponent, typename... Cargs>
+      static Ccomponent* construct(void* memory, Cargs&&... args);
+      /*!
+       * Dispose a grid component no matter if it had been allocated by \c
+       * new or from an arena. The memory of the latter is released in bulk
+       * by the arena. The destructor of a trivially disposable component
+       * (see optimize::TriviallyDisposable) allocated from an arena is
+       * skipped.
+       *
+       * \param comp grid component to be disposed
+       */
+      static void destroy(GridComponent<Ctype, CresultData>* comp);
+      /*!
+       * Dispose a grid component and hand back its memory to the arena it
+       * had been allocated from if the grid component is of type \c
+       * Ccomponent, such that a subsequent optimize::GridComponent::create
+       * of a \c Ccomponent reuses the memory (see
+       * optimize::Arena::deallocate). Other grid components are disposed
+       * by means of destroy().
+       *
+       * \param comp grid component to be disposed
+       * \param arena arena the grid component had been allocated from if it
+       * is arena allocated
+       */
+      template <typename Ccomponent>
+      static void recycle(GridComponent<Ctype, CresultData>* comp,
+          Arena& arena);
 
     protected:
       //! constructor
       GridComponent(GridComponent<Ctype, CresultData>* parent=0,
-          bool computed=false) : Mparent(parent), Mcomputed(computed)
+          bool computed=false) : Mparent(parent), Mcomputed(computed),
+          MarenaAllocated(false), MtriviallyDisposable(false)
       { }
+      /*!
+       * query function if destroy() has to be called for a grid component,
+       * i.e. if it either had been allocated by \c new or its destructor
+       * releases any resources
+       */
+      static bool requiresDestruction(
+          GridComponent<Ctype, CresultData> const* comp)
+      {
+        return ! (comp->MarenaAllocated && comp->MtriviallyDisposable);
+      }
 
     protected:
       //! Pointer to the parent grid component.
@@ -173,6 +281,12 @@ namespace optimize
        */
       bool Mcomputed;
 
+    private:
+      //! flag if the grid component had been allocated from an arena
+      bool MarenaAllocated;
+      //! flag if the destructor of the grid component might be skipped
+      bool MtriviallyDisposable;
+
   }; // class GridComponent
 
   /* ----------------------------------------------------------------------- */
@@ -183,6 +297,15 @@ namespace optimize
     OPTIMIZE_illegal;
   }
 
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GridComponent<Ctype, CresultData>::addRange(
+      GridComponent<Ctype, CresultData>* const* first,
+      GridComponent<Ctype, CresultData>* const* last)
+  {
+    OPTIMIZE_illegal;
+  }
+
   /* ----------------------------------------------------------------------- */
   template <typename Ctype, typename CresultData>
   void GridComponent<Ctype, CresultData>::remove(
@@ -223,6 +346,65 @@ namespace optimize
     return Mparent;
   }
 
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  template <typename Ccomponent, typename... Cargs>
+  Ccomponent* GridComponent<Ctype, CresultData>::create(Arena& arena,
+      Cargs&&... args)
+  {
+    void* memory = arena.allocate(sizeof(Ccomponent),
+        std::alignment_of<Ccomponent>::value);
+    return construct<Ccomponent>(memory, std::forward<Cargs>(args)...);
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  template <typename Ccomponent, typename... Cargs>
+  Ccomponent* GridComponent<Ctype, CresultData>::construct(void* memory,
+      Cargs&&... args)
+  {
+    Ccomponent* comp = new (memory) Ccomponent(std::forward<Cargs>(args)...);
+    GridComponent<Ctype, CresultData>* base =
+      static_cast<GridComponent<Ctype, CresultData>*>(comp);
+    base->MarenaAllocated = true;
+    base->MtriviallyDisposable = TriviallyDisposable<Ccomponent>::value;
+    return comp;
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void GridComponent<Ctype, CresultData>::destroy(
+      GridComponent<Ctype, CresultData>* comp)
+  {
+    if (0 == comp) { return; }
+    if (comp->MarenaAllocated)
+    {
+      if (! comp->MtriviallyDisposable) { comp->~GridComponent(); }
+    } else
+    {
+      delete comp;
+    }
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  template <typename Ccomponent>
+  void GridComponent<Ctype, CresultData>::recycle(
+      GridComponent<Ctype, CresultData>* comp, Arena& arena)
+  {
+    if (0 == comp) { return; }
+    if (comp->MarenaAllocated && typeid(*comp) == typeid(Ccomponent))
+    {
+      Ccomponent* const derived = static_cast<Ccomponent*>(comp);
+      destroy(comp);
+      arena.deallocate(derived, sizeof(Ccomponent),
+          std::alignment_of<Ccomponent>::value);
+    } else
+    {
+      destroy(comp);
+    }
+  }
+
   /* ----------------------------------------------------------------------- */
   template <typename Ctype, typename CresultData>
   Iterator<Ctype, CresultData> 
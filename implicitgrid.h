@@ -0,0 +1,147 @@
+/*! \file implicitgrid.h
+ * \brief Declaration of an implicit structured parameter space grid.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Declaration of an implicit structured parameter space grid.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <optimizexx/indexedgrid.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_IMPLICITGRID_H_
+#define _OPTIMIZEXX_IMPLICITGRID_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Implicit structured parameter space grid.\n
+   *
+   * The grid only stores the start value, the delta interval and the number
+   * of samples of each dimension. Coordinates of a grid point are computed on
+   * demand from its linear index so that the memory an implicit grid
+   * requires does not depend on the number of grid points at all.\n
+   *
+   * \note Since there are no node objects result data set by an application
+   * is only kept by the flyweight node until the node is moved to the next
+   * grid point. Applications which are interested in the results have to
+   * keep them on their own (e.g. the best result found so far).
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData>
+  class ImplicitGrid : public IndexedGrid<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef IndexedGrid<Ctype, CresultData> Tbase; 
+      //! typedef for coordinates
+      typedef typename Tbase::Tcoordinates Tcoordinates;
+
+    public:
+      //! constructor
+      ImplicitGrid() : Msize(1) { }
+      //! destructor
+      virtual ~ImplicitGrid() { }
+      /*!
+       * Append a dimension to the grid.
+       *
+       * \param start start value of the dimension
+       * \param delta delta interval of the dimension
+       * \param samples number of samples of the dimension
+       */
+      void addDimension(Ctype const start, Ctype const delta,
+          size_t const samples);
+      //! query function for the number of grid points
+      virtual size_t size() const { return Mstart.empty() ? 0 : Msize; }
+      //! query function for the number of dimensions
+      virtual size_t getDimensions() const { return Mstart.size(); }
+      /*!
+       * Compute the coordinates of a grid point.
+       *
+       * \param index linear index of the grid point
+       * \param coordinates vector the coordinates are written to
+       */
+      virtual void getCoordinatesAt(size_t const index,
+          Tcoordinates& coordinates) const;
+
+    private:
+      //! start values of the dimensions
+      std::vector<Ctype> Mstart;
+      //! delta intervals of the dimensions
+      std::vector<Ctype> Mdelta;
+      //! number of samples of the dimensions
+      std::vector<size_t> Msamples;
+      //! number of grid points
+      size_t Msize;
+
+  }; // class template ImplicitGrid
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void ImplicitGrid<Ctype, CresultData>::addDimension(Ctype const start,
+      Ctype const delta, size_t const samples)
+  {
+    OPTIMIZE_assert(0 < samples, "Illegal number of samples.");
+    Mstart.push_back(start);
+    Mdelta.push_back(delta);
+    Msamples.push_back(samples);
+    Msize *= samples;
+    Tbase::Mcomputed = false;
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void ImplicitGrid<Ctype, CresultData>::getCoordinatesAt(size_t const index,
+      Tcoordinates& coordinates) const
+  {
+    OPTIMIZE_assert(index < size(), "Index out of range.");
+    coordinates.resize(Mstart.size());
+    // the first coordinate varies fastest
+    size_t rest = index;
+    for (size_t d = 0; d < Mstart.size(); ++d)
+    {
+      coordinates[d] = Mstart[d] + static_cast<Ctype>(rest % Msamples[d])*
+        Mdelta[d];
+      rest /= Msamples[d];
+    }
+  } // function ImplicitGrid<Ctype, CresultData>::getCoordinatesAt
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF implicitgrid.h  ----- */
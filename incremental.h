@@ -0,0 +1,228 @@
+/*! \file incremental.h
+ * \brief Incremental executions of global algorithms.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Decorator of applications skipping the nodes already computed
+ * so that an execution following an incremental rebuild of the parameter
+ * space computes the nodes added only.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Incremental executions of batch applications.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <memory>
+#include <optimizexx/application.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/node.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_INCREMENTAL_H_
+#define _OPTIMIZEXX_INCREMENTAL_H_
+
+namespace optimize
+{
+  /* ======================================================================= */
+  /*!
+   * Application decorating an application (decorator design pattern - GoF
+   * p.175) such that nodes which had been computed already are skipped.
+   * Nodes visited by the decorated application are marked as computed.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class IncrementalVisitor : public ParameterSpaceVisitor<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef ParameterSpaceVisitor<Ctype, CresultData> Tbase;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param app decorated application
+       */
+      IncrementalVisitor(Tbase& app) : Mapp(app) { }
+      //! destructor
+      virtual ~IncrementalVisitor() { }
+      //! Visit function for a grid.
+      virtual void operator()(Grid<Ctype, CresultData>* grid) { Mapp(grid); }
+      //! Visit function for a node.
+      virtual void operator()(Node<Ctype, CresultData>* node)
+      {
+        if (node->isComputed()) { return; }
+        Mapp(node);
+        node->setComputed();
+      }
+      //! create a clone decorating a clone of the decorated application
+      virtual std::unique_ptr<Tbase> clone() const;
+      //! merge a clone into the decorated application
+      virtual void merge(Tbase& clone)
+      {
+        Mapp.merge(static_cast<IncrementalVisitor&>(clone).Mapp);
+      }
+
+    private:
+      //! constructor of a clone
+      IncrementalVisitor(std::unique_ptr<Tbase> app) : Mapp(*app),
+        Mclone(std::move(app))
+      { }
+
+    private:
+      //! decorated application
+      Tbase& Mapp;
+      //! clone of the decorated application owned by a clone
+      std::unique_ptr<Tbase> Mclone;
+
+  }; // class template IncrementalVisitor
+
+  /* ======================================================================= */
+  /*!
+   * Batch application decorating a batch application (decorator design
+   * pattern - GoF p.175) such that grid points which had been computed
+   * already are skipped. Ranges of nodes are filtered before their
+   * coordinates are gathered. Index addressed grids skip the grid points
+   * computed themselves (see skipsComputed()).
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class IncrementalBatchVisitor :
+    public BatchParameterSpaceVisitor<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef BatchParameterSpaceVisitor<Ctype, CresultData> Tbase;
+      //! Application base class.
+      typedef ParameterSpaceVisitor<Ctype, CresultData> Tvisitor;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param app decorated batch application
+       */
+      IncrementalBatchVisitor(Tbase& app) : Mapp(app)
+      {
+        Tbase::setBlockSize(app.getBlockSize());
+      }
+      //! destructor
+      virtual ~IncrementalBatchVisitor() { }
+      //! Visit function for a block of grid points.
+      virtual void operator()(CoordinateBlock<Ctype, CresultData> const&
+          block)
+      {
+        Mapp(block);
+      }
+      //! Visit function for a grid.
+      virtual void operator()(Grid<Ctype, CresultData>* grid) { Mapp(grid); }
+      //! Visit function for a node.
+      virtual void operator()(Node<Ctype, CresultData>* node)
+      {
+        if (! node->isComputed()) { Tbase::operator()(node); }
+      }
+      //! Visit function for a contiguous range of nodes.
+      virtual void operator()(Node<Ctype, CresultData>** begin,
+          Node<Ctype, CresultData>** end);
+      //! grid points already computed are skipped
+      virtual bool skipsComputed() const { return true; }
+      //! create a clone decorating a clone of the decorated application
+      virtual std::unique_ptr<Tvisitor> clone() const;
+      //! merge a clone into the decorated application
+      virtual void merge(Tvisitor& clone)
+      {
+        Mapp.merge(static_cast<IncrementalBatchVisitor&>(clone).Mapp);
+      }
+
+    private:
+      //! constructor of a clone
+      IncrementalBatchVisitor(Tbase& app, std::unique_ptr<Tvisitor> clone) :
+        Mapp(app), Mclone(std::move(clone))
+      {
+        Tbase::setBlockSize(app.getBlockSize());
+      }
+
+    private:
+      //! decorated batch application
+      Tbase& Mapp;
+      //! clone of the decorated application owned by a clone
+      std::unique_ptr<Tvisitor> Mclone;
+
+  }; // class template IncrementalBatchVisitor
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  IncrementalVisitor<Ctype, CresultData>::clone() const
+  {
+    std::unique_ptr<Tbase> app(Mapp.clone());
+    // the decorated application is shared by the workers if not cloneable
+    if (! app) { return std::unique_ptr<Tbase>(); }
+    return std::unique_ptr<Tbase>(new IncrementalVisitor<Ctype, CresultData>(
+          std::move(app)));
+  } // function IncrementalVisitor<Ctype, CresultData>::clone
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void IncrementalBatchVisitor<Ctype, CresultData>::operator()(
+      Node<Ctype, CresultData>** begin, Node<Ctype, CresultData>** end)
+  {
+    std::vector<Node<Ctype, CresultData>*> pending;
+    pending.reserve(end-begin);
+    for (; begin != end; ++begin)
+    {
+      if (! (*begin)->isComputed()) { pending.push_back(*begin); }
+    }
+    Tbase::operator()(pending.data(), pending.data()+pending.size());
+  } // function IncrementalBatchVisitor<Ctype, CresultData>::operator()
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  IncrementalBatchVisitor<Ctype, CresultData>::clone() const
+  {
+    std::unique_ptr<Tvisitor> app(Mapp.clone());
+    // the decorated application is shared by the workers if not cloneable
+    if (! app) { return std::unique_ptr<Tvisitor>(); }
+    Tbase* batch = dynamic_cast<Tbase*>(app.get());
+    OPTIMIZE_assert(batch, "Clone is not a batch application.");
+    return std::unique_ptr<Tvisitor>(
+        new IncrementalBatchVisitor<Ctype, CresultData>(*batch,
+          std::move(app)));
+  } // function IncrementalBatchVisitor<Ctype, CresultData>::clone
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF incremental.h  ----- */
@@ -0,0 +1,263 @@
+/*! \file indexedgrid.h
+ * \brief Declaration of an index addressed parameter space grid.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Declaration of an index addressed parameter space grid.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Hooks for grids storing result data.
+ * 14/10/2026  V0.3  Random access node iteration.
+ * 14/10/2026  V0.4  Bulk insertion is illegal, too.
+ * 14/10/2026  V0.5  Visiting ranges of grid points by batch applications.
+ * 14/10/2026  V0.6  Skip grid points already computed if requested.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <optimizexx/grid.h>
+#include <optimizexx/indexednode.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/iterator/indexediterator.h>
+#include <optimizexx/iterator/nulliterator.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_INDEXEDGRID_H_
+#define _OPTIMIZEXX_INDEXEDGRID_H_
+
+namespace optimize
+{
+
+  // forward declaration
+  template <typename Ctype, typename CresultData> class ParameterSpaceVisitor;
+
+  /* ======================================================================= */
+  /*!
+   * Abstract base class for structured parameter space grids whose grid
+   * points are addressed by a linear index instead of being stored as node
+   * objects.\n
+   *
+   * Grid points are enumerated in the same order
+   * optimize::StandardParameterSpaceBuilder generates nodes i.e. the first
+   * coordinate varies fastest. Visiting the grid is done by means of
+   * flyweight nodes (optimize::IndexedNode) so that the grid does not
+   * allocate any memory per grid point.\n
+   *
+   * \note An index addressed grid has no children. It is meant to be used as
+   * root of a parameter space. Adding components is illegal.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData>
+  class IndexedGrid : public Grid<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef Grid<Ctype, CresultData> Tbase; 
+      //! Pointer to grid component.
+      typedef GridComponent<Ctype, CresultData>* Tcomp_ptr; 
+      //! typedef for coordinates
+      typedef typename std::vector<Ctype> Tcoordinates;
+
+    public:
+      //! destructor
+      virtual ~IndexedGrid() { }
+      /*! 
+       * Visitor acceptance function for a parameter space visitor.
+       * Note that here the visitor design pattern is in use (GoF p.315)
+       *
+       * \param v The application which visits the grid points and the grid
+       * afterwards.
+       */
+      virtual void accept(ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * Overriding parameterized factory method (GoF p. 111)
+       * Factory method design pattern in use (GoF p.107)\n
+       * Node and usual iterators traverse the grid points both in forward
+       * and reverse direction. Since an index addressed grid has no subgrids
+       * grid iterators are degenerated. The iteration mode is meaningless.
+       *
+       * \param iter_type Iteration type.
+       * \param iter_mode Iteration mode.
+       * \return The corresponding composite iterator (product).
+       */
+      virtual Iterator<Ctype, CresultData> createIterator(
+          EiteratorType iter_type, EiterationMode iter_mode=PostOrder) const;
+      //! Adding components to an index addressed grid is illegal.
+      virtual void add(Tcomp_ptr gridcomponent) { OPTIMIZE_illegal; }
+      //! Adding components to an index addressed grid is illegal.
+      virtual void addRange(Tcomp_ptr const* first, Tcomp_ptr const* last)
+      {
+        OPTIMIZE_illegal;
+      }
+      //! Removing components of an index addressed grid is illegal.
+      virtual void remove(Tcomp_ptr gridcomponent) { OPTIMIZE_illegal; }
+      //! query function for the number of grid points
+      virtual size_t size() const = 0;
+      //! query function for the number of dimensions
+      virtual size_t getDimensions() const = 0;
+      /*!
+       * Compute the coordinates of a grid point.
+       *
+       * \param index linear index of the grid point
+       * \param coordinates vector the coordinates are written to
+       */
+      virtual void getCoordinatesAt(size_t const index,
+          Tcoordinates& coordinates) const = 0;
+      /*!
+       * query function for the result data of a grid point\n
+       * By default an index addressed grid does not store result data.
+       *
+       * \param index linear index of the grid point
+       * \return result data of the grid point
+       */
+      virtual CresultData getResultDataAt(size_t const index) const
+      {
+        return CresultData();
+      }
+      /*!
+       * Set the result data of a grid point. Does nothing by default.
+       *
+       * \param index linear index of the grid point
+       * \param data result data
+       */
+      virtual void setResultDataAt(size_t const index,
+          CresultData const& data) { }
+      //! query function if the grid point had been computed
+      virtual bool isComputedAt(size_t const index) const { return false; }
+      //! Set the computed flag of a grid point. Does nothing by default.
+      virtual void setComputedAt(size_t const index) { }
+      /*!
+       * Apply a batch application to a range of grid points. By default the
+       * coordinates are gathered block by block by means of
+       * getCoordinatesAt() and the results are stored by means of
+       * setResultDataAt() afterwards. Grid points already computed are
+       * skipped if the application requests so (see
+       * BatchParameterSpaceVisitor::skipsComputed).
+       *
+       * \param v batch application
+       * \param first linear index of the first grid point
+       * \param last linear index past the last grid point
+       */
+      virtual void visitRange(
+          BatchParameterSpaceVisitor<Ctype, CresultData>& v, size_t first,
+          size_t const last);
+
+    protected:
+      //! constructor
+      IndexedGrid() { }
+
+  }; // class template IndexedGrid
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void IndexedGrid<Ctype, CresultData>::accept(
+      ParameterSpaceVisitor<Ctype, CresultData>& v)
+  {
+    IndexedNode<Ctype, CresultData> node(this);
+    for (size_t i = 0; i < size(); ++i)
+    {
+      node.setIndex(i);
+      v(&node);
+    }
+    v(this);
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void IndexedGrid<Ctype, CresultData>::visitRange(
+      BatchParameterSpaceVisitor<Ctype, CresultData>& v, size_t first,
+      size_t const last)
+  {
+    OPTIMIZE_assert(first <= last && last <= size(), "Index out of range.");
+    if (first == last) { return; }
+    size_t const dims = getDimensions();
+    BlockBuffer<Ctype, CresultData> buffer(dims,
+        std::min(v.getBlockSize(), last-first));
+    bool const skip = v.skipsComputed();
+    // indices of the grid points gathered
+    std::vector<size_t> indices;
+    indices.reserve(buffer.getCapacity());
+    Tcoordinates c;
+
+    while (first != last)
+    {
+      indices.clear();
+      for (; first != last && indices.size() < buffer.getCapacity(); ++first)
+      {
+        if (skip && isComputedAt(first)) { continue; }
+        getCoordinatesAt(first, c);
+        for (size_t d = 0; d < dims; ++d)
+        {
+          buffer.getColumn(d)[indices.size()] = c[d];
+        }
+        indices.push_back(first);
+      }
+      if (indices.empty()) { continue; }
+      v(buffer.getBlock(indices.size()));
+      CresultData const* results = buffer.getResults();
+      for (size_t i = 0; i < indices.size(); ++i)
+      {
+        setResultDataAt(indices[i], results[i]);
+        setComputedAt(indices[i]);
+      }
+    }
+  } // function IndexedGrid<Ctype, CresultData>::visitRange
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  Iterator<Ctype, CresultData> IndexedGrid<Ctype,CresultData>::createIterator(
+          EiteratorType iter_type, EiterationMode iter_mode) const
+  {
+    typedef typename Iterator<Ctype, CresultData>::Tstrategy Tstrategy;
+
+    if (ForwardIter == iter_type || ForwardNodeIter == iter_type ||
+        RandomAccessNodeIter == iter_type)
+    {
+      return Iterator<Ctype, CresultData>(Tstrategy(
+            new iterator::IndexedIterator<Ctype, CresultData>(this, false)));
+    } else
+    if (ReverseIter == iter_type || ReverseNodeIter == iter_type)
+    {
+      return Iterator<Ctype, CresultData>(Tstrategy(
+            new iterator::IndexedIterator<Ctype, CresultData>(this, true)));
+    }
+    return Iterator<Ctype, CresultData>(Tstrategy(
+          new iterator::NullIterator<Ctype, CresultData>(
+            const_cast<IndexedGrid<Ctype, CresultData>*>(this))));
+  } // function IndexedGrid<Ctype, CresultData>::createIterator
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF indexedgrid.h  ----- */
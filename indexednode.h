@@ -0,0 +1,144 @@
+/*! \file indexednode.h
+ * \brief Declaration of a flyweight node of an index addressed parameter space
+ * grid.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Declaration of a flyweight node of an index addressed parameter
+ * space grid.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Write result data through to the grid.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <optimizexx/node.h>
+
+#ifndef _OPTIMIZEXX_INDEXEDNODE_H_
+#define _OPTIMIZEXX_INDEXEDNODE_H_
+
+namespace optimize
+{
+
+  // forward declaration
+  template <typename Ctype, typename CresultData> class IndexedGrid;
+
+  /* ======================================================================= */
+  /*!
+   * Flyweight node of an optimize::IndexedGrid (GoF p.195).\n
+   *
+   * An index addressed grid does not store any node objects. Instead its
+   * iterators and tasks keep a single IndexedNode which is moved to the
+   * linear index of the grid point currently visited. The node's extrinsic
+   * state (coordinates, result data) is provided by the grid then. Result
+   * data set by an application is passed through to the grid so that grids
+   * storing results (e.g. optimize::ArrayGrid) keep it.\n
+   *
+   * Notice that a pointer to an IndexedNode is only valid until the node is
+   * moved to another index. Applications must not keep node pointers.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData>
+  class IndexedNode : public Node<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef Node<Ctype, CresultData> Tbase;
+      //! typedef for coordinates
+      typedef typename Tbase::Tcoordinates Tcoordinates;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param grid Index addressed grid the node belongs to.
+       */
+      IndexedNode(IndexedGrid<Ctype, CresultData> const* grid) :
+        Tbase(Tcoordinates()),
+        Mgrid(const_cast<IndexedGrid<Ctype, CresultData>*>(grid)), Mindex(0)
+      {
+        Tbase::setParent(Mgrid);
+      }
+      //! destructor
+      virtual ~IndexedNode() { }
+      /*!
+       * Move the flyweight to another grid point.
+       *
+       * \param index linear index of the grid point
+       */
+      void setIndex(size_t const index);
+      //! query function for the linear index of the grid point
+      size_t getIndex() const { return Mindex; }
+      //! Set the computed flag of both the node and the grid point.
+      virtual void setComputed();
+      //! Set the result data of both the node and the grid point.
+      virtual void setResultData(CresultData const data);
+
+    private:
+      //! grid the node belongs to
+      IndexedGrid<Ctype, CresultData>* Mgrid;
+      //! linear index of the grid point
+      size_t Mindex;
+
+  }; // class template IndexedNode
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void IndexedNode<Ctype, CresultData>::setIndex(size_t const index)
+  {
+    Mindex = index;
+    Mgrid->getCoordinatesAt(index, Tbase::Mcoordinates);
+    Tbase::MresultData = Mgrid->getResultDataAt(index);
+    Tbase::Mcomputed = Mgrid->isComputedAt(index);
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void IndexedNode<Ctype, CresultData>::setComputed()
+  {
+    Tbase::setComputed();
+    Mgrid->setComputedAt(Mindex);
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void IndexedNode<Ctype, CresultData>::setResultData(CresultData const data)
+  {
+    Tbase::setResultData(data);
+    Mgrid->setResultDataAt(Mindex, data);
+  }
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF indexednode.h  ----- */
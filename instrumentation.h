@@ -0,0 +1,508 @@
+/*! \file instrumentation.h
+ * \brief Optional instrumentation of global algorithms.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Optional instrumentation of global algorithms recording per-phase
+ * wall times, per-worker task counts, queue wait times and a latency
+ * histogram of visitor calls. The instrumentation is compiled out
+ * unless OPTIMIZE_INSTRUMENTATION is defined.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Instrumentation of batch applications.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optimizexx/application.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_INSTRUMENTATION_H_
+#define _OPTIMIZEXX_INSTRUMENTATION_H_
+
+/*!
+ * \def OPTIMIZE_phase(I,P)
+ * Record the wall time of the enclosing scope as phase \c P of the
+ * optimize::Instrumentation \c I. Expands to nothing unless
+ * OPTIMIZE_INSTRUMENTATION is defined.
+ *
+ * \ingroup group_global_algos
+ */
+#ifdef OPTIMIZE_INSTRUMENTATION
+#define OPTIMIZE_phase_name_(L) optimize_scoped_phase_ ## L
+#define OPTIMIZE_phase_line_(I,P,L) \
+  optimize::ScopedPhase const OPTIMIZE_phase_name_(L)(I, P)
+#define OPTIMIZE_phase(I,P) OPTIMIZE_phase_line_(I, P, __LINE__)
+#else
+#define OPTIMIZE_phase(I,P)
+#endif
+
+namespace optimize
+{
+  /* ======================================================================= */
+  /*!
+   * Statistics of the executions of a global algorithm to spot load
+   * imbalance and scheduler overhead. Recorded are
+   *  - the wall time of the phases of the executions (see Ephase)
+   *  - the number of tasks and nodes each worker of a thread pool computed
+   *    and the time the worker was busy with them
+   *  - the time tasks waited within the queues of the thread pool
+   *  - a latency histogram of the calls of the application (visitor)
+   *
+   * Recording is compiled out unless OPTIMIZE_INSTRUMENTATION is defined
+   * (see isEnabled()). All counters are updated lock-free. The statistics
+   * accumulate across executions until reset() is called.
+   *
+   * \note Query the statistics per worker after an execution had finished.
+   *
+   * \ingroup group_global_algos
+   */
+  class Instrumentation
+  {
+    public:
+      //! clock of the instrumentation
+      typedef std::chrono::high_resolution_clock Tclock;
+      //! point in time
+      typedef Tclock::time_point Ttime;
+
+      //! phases of an execution
+      enum Ephase
+      {
+        Construction, //!< construction of the parameter space
+        Execution,    //!< execution (including the phases below)
+        Submission,   //!< queueing the tasks of thread pool jobs
+        Waiting,      //!< waiting for the tasks of thread pool jobs
+        NumPhases     //!< number of phases
+      }; // enum Ephase
+
+      /*!
+       * number of buckets of the latency histogram - bucket \c i counts the
+       * calls with a latency within [2^i, 2^(i+1)) nanoseconds (bucket zero
+       * additionally counts calls below one nanosecond, the last bucket all
+       * calls above)
+       */
+      static size_t const NumBuckets = 40;
+
+    public:
+      //! constructor
+      Instrumentation() { reset(); }
+      //! query function if the instrumentation had been compiled in
+      static bool isEnabled()
+      {
+#ifdef OPTIMIZE_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+      }
+      //! current point in time
+      static Ttime now() { return Tclock::now(); }
+      //! nanoseconds elapsed since \c start
+      static std::uint64_t getElapsed(Ttime const& start)
+      {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            now()-start).count();
+      }
+      //! reset all statistics
+      void reset();
+      /*!
+       * Provide statistics for the workers of a thread pool. Must not be
+       * called while tasks are executed.
+       *
+       * \param num_workers number of workers
+       */
+      void prepare(size_t const num_workers);
+      //! add the wall time of a phase in nanoseconds
+      void addPhase(Ephase const phase, std::uint64_t const ns)
+      {
+        Mphases[phase] += ns;
+      }
+      /*!
+       * add a task computed by a worker
+       *
+       * \param worker index of the worker
+       * \param nodes number of nodes of the task
+       * \param wait nanoseconds the task waited within the queues
+       * \param busy nanoseconds the worker computed the task
+       */
+      void addTask(size_t const worker, size_t const nodes,
+          std::uint64_t const wait, std::uint64_t const busy);
+      //! add a call of the application with a latency in nanoseconds
+      void addVisit(std::uint64_t const ns);
+
+      //! wall time of a phase in seconds
+      double getPhaseTime(Ephase const phase) const
+      {
+        return Mphases[phase]*1e-9;
+      }
+      //! query function for the number of workers statistics are kept for
+      size_t getNumWorkers() const { return Mworkers.size(); }
+      //! number of tasks computed by a worker
+      size_t getTaskCount(size_t const worker) const
+      {
+        return Mworkers[worker]->Mtasks;
+      }
+      //! number of nodes computed by a worker
+      size_t getNodeCount(size_t const worker) const
+      {
+        return Mworkers[worker]->Mnodes;
+      }
+      //! time in seconds a worker was busy
+      double getBusyTime(size_t const worker) const
+      {
+        return Mworkers[worker]->Mbusy*1e-9;
+      }
+      //! number of tasks taken from the queues
+      size_t getQueuedTaskCount() const { return MqueuedTasks; }
+      //! total time in seconds tasks waited within the queues
+      double getQueueWaitTime() const { return MqueueWait*1e-9; }
+      //! longest time in seconds a task waited within the queues
+      double getMaxQueueWaitTime() const { return MmaxQueueWait*1e-9; }
+      //! number of calls of the application
+      size_t getVisitCount() const { return Mvisits; }
+      //! total time in seconds spent within the application
+      double getVisitTime() const { return MvisitTime*1e-9; }
+      //! latency histogram of the calls of the application (see NumBuckets)
+      std::vector<size_t> getLatencyHistogram() const;
+
+    private:
+      //! not copyable
+      Instrumentation(Instrumentation const&);
+      //! not assignable
+      Instrumentation& operator=(Instrumentation const&);
+
+      //! statistics of a worker
+      struct Worker
+      {
+        //! constructor
+        Worker() : Mtasks(0), Mnodes(0), Mbusy(0) { }
+        //! number of tasks
+        std::atomic<size_t> Mtasks;
+        //! number of nodes
+        std::atomic<size_t> Mnodes;
+        //! busy time in nanoseconds
+        std::atomic<std::uint64_t> Mbusy;
+      }; // struct Worker
+
+    private:
+      //! wall time of the phases in nanoseconds
+      std::atomic<std::uint64_t> Mphases[NumPhases];
+      //! statistics of the workers
+      std::vector<std::unique_ptr<Worker>> Mworkers;
+      //! number of tasks taken from the queues
+      std::atomic<size_t> MqueuedTasks;
+      //! total queue wait time in nanoseconds
+      std::atomic<std::uint64_t> MqueueWait;
+      //! longest queue wait time in nanoseconds
+      std::atomic<std::uint64_t> MmaxQueueWait;
+      //! number of calls of the application
+      std::atomic<size_t> Mvisits;
+      //! total time spent within the application in nanoseconds
+      std::atomic<std::uint64_t> MvisitTime;
+      //! latency histogram
+      std::atomic<size_t> Mhistogram[NumBuckets];
+
+  }; // class Instrumentation
+
+  /* ======================================================================= */
+  /*!
+   * Record the wall time of a scope as a phase of an instrumentation. Use
+   * the OPTIMIZE_phase macro to have it compiled out if the instrumentation
+   * is disabled.
+   *
+   * \ingroup group_global_algos
+   */
+  class ScopedPhase
+  {
+    public:
+      //! constructor - starts the timing
+      ScopedPhase(Instrumentation& instrumentation,
+          Instrumentation::Ephase const phase) :
+        Minstrumentation(instrumentation), Mphase(phase),
+        Mstart(Instrumentation::now())
+      { }
+      //! destructor - records the phase
+      ~ScopedPhase()
+      {
+        Minstrumentation.addPhase(Mphase,
+            Instrumentation::getElapsed(Mstart));
+      }
+
+    private:
+      //! not copyable
+      ScopedPhase(ScopedPhase const&);
+      //! not assignable
+      ScopedPhase& operator=(ScopedPhase const&);
+
+    private:
+      //! instrumentation
+      Instrumentation& Minstrumentation;
+      //! phase
+      Instrumentation::Ephase const Mphase;
+      //! start of the phase
+      Instrumentation::Ttime const Mstart;
+
+  }; // class ScopedPhase
+
+  /* ======================================================================= */
+  /*!
+   * Application decorating another application with a measurement of the
+   * latency of its calls. Note that the decorator design pattern is in use
+   * (GoF p.175). Clones (see optimize::ParameterSpaceVisitor::clone)
+   * decorate the clones of the decorated application.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class InstrumentingVisitor : public ParameterSpaceVisitor<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef ParameterSpaceVisitor<Ctype, CresultData> Tbase;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param app decorated application
+       * \param instrumentation instrumentation the calls are recorded by
+       */
+      InstrumentingVisitor(Tbase& app, Instrumentation& instrumentation) :
+        Mapp(app), Minstrumentation(instrumentation)
+      { }
+      //! destructor
+      virtual ~InstrumentingVisitor() { }
+      //! Visit function for a grid.
+      virtual void operator()(Grid<Ctype, CresultData>* grid) { Mapp(grid); }
+      //! Visit function for a node.
+      virtual void operator()(Node<Ctype, CresultData>* node)
+      {
+        Instrumentation::Ttime const start(Instrumentation::now());
+        Mapp(node);
+        Minstrumentation.addVisit(Instrumentation::getElapsed(start));
+      }
+      //! create a clone decorating a clone of the decorated application
+      virtual std::unique_ptr<Tbase> clone() const;
+      //! merge a clone into the decorated application
+      virtual void merge(Tbase& clone)
+      {
+        Mapp.merge(static_cast<InstrumentingVisitor&>(clone).Mapp);
+      }
+
+    private:
+      //! constructor of a clone
+      InstrumentingVisitor(std::unique_ptr<Tbase> app,
+          Instrumentation& instrumentation) : Mapp(*app),
+        Minstrumentation(instrumentation), Mclone(std::move(app))
+      { }
+
+    private:
+      //! decorated application
+      Tbase& Mapp;
+      //! instrumentation
+      Instrumentation& Minstrumentation;
+      //! clone of the decorated application owned by a clone
+      std::unique_ptr<Tbase> Mclone;
+
+  }; // class template InstrumentingVisitor
+
+  /* ======================================================================= */
+  /*!
+   * Batch application decorating a batch application with a measurement of
+   * the latency of its calls. Each block is recorded as a single call.
+   * Note that the decorator design pattern is in use (GoF p.175).
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class InstrumentingBatchVisitor :
+    public BatchParameterSpaceVisitor<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef BatchParameterSpaceVisitor<Ctype, CresultData> Tbase;
+      //! Application base class.
+      typedef ParameterSpaceVisitor<Ctype, CresultData> Tvisitor;
+      using Tbase::operator();
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param app decorated batch application
+       * \param instrumentation instrumentation the calls are recorded by
+       */
+      InstrumentingBatchVisitor(Tbase& app,
+          Instrumentation& instrumentation) : Mapp(app),
+        Minstrumentation(instrumentation)
+      {
+        Tbase::setBlockSize(app.getBlockSize());
+      }
+      //! destructor
+      virtual ~InstrumentingBatchVisitor() { }
+      //! Visit function for a block of grid points.
+      virtual void operator()(CoordinateBlock<Ctype, CresultData> const&
+          block)
+      {
+        Instrumentation::Ttime const start(Instrumentation::now());
+        Mapp(block);
+        Minstrumentation.addVisit(Instrumentation::getElapsed(start));
+      }
+      //! Visit function for a grid.
+      virtual void operator()(Grid<Ctype, CresultData>* grid) { Mapp(grid); }
+      //! query function if grid points already computed are skipped
+      virtual bool skipsComputed() const { return Mapp.skipsComputed(); }
+      //! create a clone decorating a clone of the decorated application
+      virtual std::unique_ptr<Tvisitor> clone() const;
+      //! merge a clone into the decorated application
+      virtual void merge(Tvisitor& clone)
+      {
+        Mapp.merge(static_cast<InstrumentingBatchVisitor&>(clone).Mapp);
+      }
+
+    private:
+      //! constructor of a clone
+      InstrumentingBatchVisitor(Tbase& app, std::unique_ptr<Tvisitor> clone,
+          Instrumentation& instrumentation) : Mapp(app),
+        Minstrumentation(instrumentation), Mclone(std::move(clone))
+      {
+        Tbase::setBlockSize(app.getBlockSize());
+      }
+
+    private:
+      //! decorated batch application
+      Tbase& Mapp;
+      //! instrumentation
+      Instrumentation& Minstrumentation;
+      //! clone of the decorated application owned by a clone
+      std::unique_ptr<Tvisitor> Mclone;
+
+  }; // class template InstrumentingBatchVisitor
+
+  /* ======================================================================= */
+  inline void Instrumentation::reset()
+  {
+    for (size_t i = 0; i < NumPhases; ++i) { Mphases[i] = 0; }
+    for (auto it(Mworkers.begin()); it != Mworkers.end(); ++it)
+    {
+      (*it)->Mtasks = 0;
+      (*it)->Mnodes = 0;
+      (*it)->Mbusy = 0;
+    }
+    MqueuedTasks = 0;
+    MqueueWait = 0;
+    MmaxQueueWait = 0;
+    Mvisits = 0;
+    MvisitTime = 0;
+    for (size_t i = 0; i < NumBuckets; ++i) { Mhistogram[i] = 0; }
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline void Instrumentation::prepare(size_t const num_workers)
+  {
+    while (Mworkers.size() < num_workers)
+    {
+      Mworkers.push_back(std::unique_ptr<Worker>(new Worker));
+    }
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline void Instrumentation::addTask(size_t const worker, size_t const nodes,
+      std::uint64_t const wait, std::uint64_t const busy)
+  {
+    OPTIMIZE_assert(worker < Mworkers.size(), "Worker not prepared.");
+    Worker& w = *Mworkers[worker];
+    ++w.Mtasks;
+    w.Mnodes += nodes;
+    w.Mbusy += busy;
+    ++MqueuedTasks;
+    MqueueWait += wait;
+    std::uint64_t max = MmaxQueueWait;
+    while (max < wait && ! MmaxQueueWait.compare_exchange_weak(max, wait)) { }
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline void Instrumentation::addVisit(std::uint64_t const ns)
+  {
+    ++Mvisits;
+    MvisitTime += ns;
+    size_t bucket = 0;
+    for (std::uint64_t n = ns >> 1; n && bucket+1 < NumBuckets; n >>= 1)
+    {
+      ++bucket;
+    }
+    ++Mhistogram[bucket];
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline std::vector<size_t> Instrumentation::getLatencyHistogram() const
+  {
+    std::vector<size_t> histogram(NumBuckets);
+    for (size_t i = 0; i < NumBuckets; ++i) { histogram[i] = Mhistogram[i]; }
+    return histogram;
+  }
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  InstrumentingVisitor<Ctype, CresultData>::clone() const
+  {
+    std::unique_ptr<Tbase> app(Mapp.clone());
+    // the decorated application is shared by the workers if not cloneable
+    if (! app) { return std::unique_ptr<Tbase>(); }
+    return std::unique_ptr<Tbase>(new InstrumentingVisitor<Ctype, CresultData>(
+          std::move(app), Minstrumentation));
+  } // function InstrumentingVisitor<Ctype, CresultData>::clone
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  InstrumentingBatchVisitor<Ctype, CresultData>::clone() const
+  {
+    std::unique_ptr<Tvisitor> app(Mapp.clone());
+    // the decorated application is shared by the workers if not cloneable
+    if (! app) { return std::unique_ptr<Tvisitor>(); }
+    Tbase* batch = dynamic_cast<Tbase*>(app.get());
+    OPTIMIZE_assert(batch, "Clone is not a batch application.");
+    return std::unique_ptr<Tvisitor>(
+        new InstrumentingBatchVisitor<Ctype, CresultData>(*batch,
+          std::move(app), Minstrumentation));
+  } // function InstrumentingBatchVisitor<Ctype, CresultData>::clone
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF instrumentation.h  ----- */
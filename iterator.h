@@ -30,12 +30,19 @@
  * 
  * REVISIONS and CHANGES 
  * 12/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Compare iterators by means of their strategies.
+ * 14/10/2026  V0.3  Random access node iterator. Constant time advance() and
+ *                   distance() for random access iterators.
+ * 14/10/2026  V0.4  Store copies of iterator strategies inline.
+ * 14/10/2026  V0.5  Document the invalidation of iterators.
  * 
  * ============================================================================
  */
  
 #include <memory>
+#include <type_traits>
 #include <optimizexx/iterator/compositeiterator.h>
+#include <optimizexx/iterator/iterationmemento.h>
 
 #ifndef _OPTIMIZEXX_ITERATOR_H_
 #define _OPTIMIZEXX_ITERATOR_H_
@@ -62,6 +69,7 @@ namespace optimize
     ReverseIter,          //!< reverse iterator
     ReverseGridIter,      //!< only grid reverse iterator
     ReverseNodeIter,      //!< only node reverse iterator
+    RandomAccessNodeIter, //!< only node iterator providing random access
     NullIter              //!< degenerated iterator
   }; // enum EiteratorType
 
@@ -85,11 +93,18 @@ namespace optimize
    * than the number of children in the parameter space grid than \c iter will
    * point to the last element.
    *
+   * \note Random access iterators are advanced in constant time.
+   *
    * \ingroup group_iterator
    */
   template <typename Citerator>
   void advance(Citerator& iter, size_t n)
   {
+    if (iter.isRandomAccess())
+    {
+      iter.advance(n);
+      return;
+    }
     Citerator iter_last(iter);
     iter_last.back();
     while (iter != iter_last && n > 0)
@@ -108,7 +123,8 @@ namespace optimize
    * reachable from \c iter_first.
    *
    * \note In contrast to the STL distance function the function uses
-   * repeatedly the \c next() function of the composite iterator.
+   * repeatedly the \c next() function of the composite iterator. Only the
+   * distance of random access iterators is computed in constant time.
    *
    * \return number of elements between \c iter_first and \c iter_last
    *
@@ -120,6 +136,13 @@ namespace optimize
   template <typename Citer_first, typename Citer_last>
   size_t distance(Citer_first const& iter_first, Citer_last const& iter_last)
   {
+    if (iter_first.isRandomAccess() && iter_last.isRandomAccess())
+    {
+      size_t const first = iter_first.getPosition();
+      size_t const last = iter_last.getPosition();
+      return first <= last ? last-first : iter_first.getSize()-first+last;
+    }
+
     Citer_first iter(iter_first);
 
     size_t retval = 0;
@@ -144,7 +167,17 @@ namespace optimize
    * main advantage of using this approach is encapsulating an iterator strategy
    * so that clients using a parameter space iterator are able to avoid iterator
    * pointers actually. This class corresponds to the \a Context class of the
-   * Strategy design pattern in GoF.
+   * Strategy design pattern in GoF.\n
+   *
+   * Copies of an iterator keep their strategy within inline storage of the
+   * iterator (see optimize::iterator::CompositeIterator::clone(void*,
+   * size_t)) so that copying iterators does not allocate any memory.
+   * Strategies which do not fit into the storage are allocated by \c new.\n
+   *
+   * An iterator keeps iterators over the children of the grids it passes
+   * (see optimize::iterator::IterationState). Adding children to or removing
+   * children of such a grid (see optimize::Grid::add) invalidates the
+   * iterator. Create a new iterator after modifying the parameter space.
    *
    * \ingroup group_iterator
    */
@@ -158,10 +191,13 @@ namespace optimize
 
     public:
       //! constructor
-      Iterator(Tstrategy iter_strategy) : Miter(std::move(iter_strategy))
+      Iterator(Tstrategy iter_strategy) : Miter(iter_strategy.release()),
+        Minline(false)
       { }
       //! copy constructor
       Iterator(Iterator<Ctype, CresultData> const& rhs);
+      //! destructor
+      ~Iterator() { release(); }
       //! assignment operator
       Iterator<Ctype, CresultData>& operator=(
           Iterator<Ctype, CresultData> const& rhs);
@@ -185,20 +221,45 @@ namespace optimize
       bool operator!=(Iterator<Ctype, CresultData> const& rhs) const;
       //! dereference operator
       Tcomp_ptr operator*() { return Miter->currentItem(); }
+      //! query function if iterator provides random access
+      bool isRandomAccess() const { return Miter->isRandomAccess(); }
+      /*!
+       * advance a random access iterator by \c n elements in constant time
+       *
+       * \param n number of elements to be advanced
+       */
+      void advance(size_t const n) { Miter->advance(n); }
+      //! query function for the position of a random access iterator
+      size_t getPosition() const { return Miter->getPosition(); }
+      //! query function for the number of elements of a random access iterator
+      size_t getSize() const { return Miter->getSize(); }
+
+    private:
+      //! copy the strategy of another iterator
+      void copy(Iterator<Ctype, CresultData> const& rhs);
+      //! dispose the strategy
+      void release();
 
     private:
+      //! size of the inline storage for strategies
+      static size_t const MbufferSize =
+        sizeof(iterator::IterationMemento<Ctype, CresultData>) +
+        8*sizeof(void*);
       //! pointer to a concrete iterator strategy
-      typename std::unique_ptr<iterator::CompositeIterator<Ctype, CresultData>>
-        Miter;
+      iterator::CompositeIterator<Ctype, CresultData>* Miter;
+      //! flag if the strategy is stored within the inline storage
+      bool Minline;
+      //! inline storage for strategies
+      typename std::aligned_storage<MbufferSize>::type Mbuffer;
 
   }; // class template Iterator
 
   /* ======================================================================= */
   template <typename Ctype, typename CresultData>
   Iterator<Ctype, CresultData>::Iterator(
-      Iterator<Ctype, CresultData> const& rhs)
+      Iterator<Ctype, CresultData> const& rhs) : Miter(0), Minline(false)
   {
-    this->Miter = rhs.Miter->clone();
+    copy(rhs);
   } // copy constructor
 
   /* ----------------------------------------------------------------------- */
@@ -208,11 +269,37 @@ namespace optimize
   {
     if (this != &rhs)
     {
-      this->Miter = rhs.Miter->clone();
+      release();
+      copy(rhs);
     }
     return *this;
   } // function Iterator<Ctype, CresultData>::operator=
 
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void Iterator<Ctype, CresultData>::copy(
+      Iterator<Ctype, CresultData> const& rhs)
+  {
+    Miter = rhs.Miter->clone(&Mbuffer, MbufferSize);
+    Minline = 0 != Miter;
+    if (! Minline) { Miter = rhs.Miter->clone().release(); }
+  } // function Iterator<Ctype, CresultData>::copy
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void Iterator<Ctype, CresultData>::release()
+  {
+    if (Minline)
+    {
+      Miter->~CompositeIterator();
+    } else
+    {
+      delete Miter;
+    }
+    Miter = 0;
+    Minline = false;
+  } // function Iterator<Ctype, CresultData>::release
+
   /* ----------------------------------------------------------------------- */
   template <typename Ctype, typename CresultData>
   Iterator<Ctype, CresultData>& Iterator<Ctype, CresultData>::operator++()
@@ -234,7 +321,7 @@ namespace optimize
   bool Iterator<Ctype, CresultData>::operator==(
       Iterator<Ctype, CresultData> const& rhs) const
   {
-    return Miter->currentItem() == rhs.Miter->currentItem();
+    return Miter->equals(*rhs.Miter);
   }
 
   /* ----------------------------------------------------------------------- */
@@ -30,11 +30,15 @@
  * 
  * REVISIONS and CHANGES 
  * 20/02/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Virtual comparison of iterator strategies.
+ * 14/10/2026  V0.3  Interface for random access iterator strategies.
+ * 14/10/2026  V0.4  Copy strategies into memory provided by the caller.
  * 
  * ============================================================================
  */
 
 #include <memory>
+#include <new>
 #include <optimizexx/error.h>
  
 #ifndef _OPTIMIZEXX_COMPOSITEITERATOR_H_
@@ -102,6 +106,42 @@ namespace optimize
          * \return a pointer to the current grid component
          */
         virtual Tcomp_ptr currentItem() const = 0;
+        /*!
+         * Compare the position of two iterator strategies. By default two
+         * strategies are equal if they point to the same grid component.
+         *
+         * \param rhs iterator strategy to compare with
+         * \return if both iterators point to the same item
+         */
+        virtual bool equals(CompositeIterator<Ctype, CresultData> const& rhs)
+          const
+        {
+          return currentItem() == rhs.currentItem();
+        }
+        /*!
+         * query function if the strategy provides random access in constant
+         * time\n
+         * Only if so the functions advance(), getPosition() and getSize() may
+         * be used.
+         */
+        virtual bool isRandomAccess() const { return false; }
+        /*!
+         * Advance the iterator by \c n elements in constant time. If \c n is
+         * equal to or greater than the number of remaining elements the
+         * iterator will point to the last element.
+         *
+         * \param n number of elements to be advanced
+         */
+        virtual void advance(size_t const n) { OPTIMIZE_illegal; }
+        /*!
+         * query function for the position of the current element
+         *
+         * \return position of the current element - the number of elements if
+         * the iteration is finished
+         */
+        virtual size_t getPosition() const { OPTIMIZE_illegal; }
+        //! query function for the number of elements of the iteration
+        virtual size_t getSize() const { OPTIMIZE_illegal; }
         //! destructor
         virtual ~CompositeIterator() { }
         /*!
@@ -122,10 +162,41 @@ namespace optimize
          * \return unique pointer to the deep copy of iteratior strategy
          */
         virtual TstrategyPtr clone() const = 0;
+        /*!
+         * Copy the iterator strategy into memory provided by the caller
+         * (e.g. the inline storage of optimize::Iterator) so that copying
+         * does not allocate any memory. The copy is destroyed by calling
+         * its destructor explicitly.
+         *
+         * \param memory suitably aligned memory
+         * \param size size of the memory in bytes
+         * \return pointer to the copy - zero if the memory is insufficient
+         */
+        virtual CompositeIterator<Ctype, CresultData>* clone(void* memory,
+            size_t const size) const
+        {
+          return 0;
+        }
 
       protected:
         //! constructor
         CompositeIterator() { }
+        /*!
+         * Helper function for concrete strategies to implement
+         * clone(void*, size_t).
+         *
+         * \param strategy strategy to be copied
+         * \param memory suitably aligned memory
+         * \param size size of the memory in bytes
+         * \return pointer to the copy - zero if the memory is insufficient
+         */
+        template <typename Cstrategy>
+        static CompositeIterator<Ctype, CresultData>* cloneAt(
+            Cstrategy const& strategy, void* memory, size_t const size)
+        {
+          return sizeof(Cstrategy) <= size ?
+            new (memory) Cstrategy(strategy) : 0;
+        }
 
     }; // class template CompositeIterator
 
@@ -32,28 +32,25 @@
  * 
  * REVISIONS and CHANGES 
  * 12/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free iteration.
  * 
  * ============================================================================
  */
 
-#include <memory>
 #include <optimizexx/iterator/forwarditerator.h>
 #include <optimizexx/error.h>
-
+ 
 #ifndef _OPTIMIZEXX_FORWARDGRIDITERATOR_H_
 #define _OPTIMIZEXX_FORWARDGRIDITERATOR_H_
 
 namespace optimize
 {
-
+  
   namespace iterator
   {
 
     // forward declarations
     template <typename Ctype, typename CresultData> class IterationMemento;
-    template <typename Ctype, typename CresultData> class
-      ForwardIterationState;
-    template <typename Ctype, typename CresultData> class ReverseGridIterator;
 
     /* ===================================================================== */
     /*!
@@ -76,32 +73,11 @@ namespace optimize
       public:
         //! constructor
         ForwardGridIterator(Tcomp_ptr root,
-            typename std::unique_ptr<IterationMemento<Ctype, CresultData>>
-            iter_mode_ptr) : Tbase(root, std::move(iter_mode_ptr))
-        { }
-        /*!
-         * copy constructor
-         * 
-         * \param rhs argument to copy
-         */
-        ForwardGridIterator(ForwardGridIterator<Ctype, CresultData> const& rhs)
-          : Tbase(rhs)
+            IterationMemento<Ctype, CresultData> const& iter_mode) :
+          Tbase(root, iter_mode)
         { }
         //! destructor
         virtual ~ForwardGridIterator() { }
-        //! set iterator to first grid in parameter space composite (grid)
-        virtual void first();
-        //! set iterator to last grid in parameter space composite (grid)
-        virtual void back();
-        //! go to the next grid
-        virtual void next();
-        //! query function if iteration is finished
-        virtual bool isDone() const { return Tbase::MisDone; }
-        //! query function for current grid
-        virtual Tcomp_ptr currentItem() const
-        {
-          return *Tbase::MiterMemento->getCurrentIterator();
-        }
         /*! 
          * perform deep copy of an iterator strategy\n
          * Notice that here the
@@ -115,83 +91,25 @@ namespace optimize
         {
           return TstrategyPtr(new ForwardGridIterator(*this));
         }
-
-    }; // class template ForwardGridIterator
-
-    /* ===================================================================== */
-    template <typename Ctype, typename CresultData>
-    void ForwardGridIterator<Ctype, CresultData>::first()
-    {
-      Tbase::MiterMemento->reset();
-      if (Tbase::Mcomponent->begin() != Tbase::Mcomponent->end())
-      {
-        Tbase::MisDone = false;
-        typename std::unique_ptr<ForwardIterationState<Ctype, CresultData>>
-          state(new ForwardIterationState<Ctype, CresultData>(
-          Tbase::Mcomponent->begin(), Tbase::Mcomponent->end()));
-        Tbase::MiterMemento->pushState(std::move(state));
-        next();
-      } else
-      {
-        Tbase::MisDone = true;
-      }
-    } // function ForwardGridIterator<Ctype, CresultData>::first
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
-    void ForwardGridIterator<Ctype, CresultData>::back()
-    {
-      // not really efficiant but must be done as follows to guarantee
-      // correct behaviour both for pre- and post-order iterators
-      first();
-      
-      ReverseGridIterator<Ctype, CresultData> rev_iter(Tbase::Mcomponent,
-          std::move(Tbase::MiterMemento->create()));
-      rev_iter.first();
-
-      while (! Tbase::MisDone && rev_iter.currentItem() != currentItem())
-      { 
-        next();
-      }
-    } // function ForwardGridIterator<Ctype, CresultData>::back
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
-    void ForwardGridIterator<Ctype, CresultData>::next()
-    {
-      if (! (*Tbase::MiterMemento->getCurrentIterator())->createIterator(
-            ForwardGridIter).isDone())
-      {
-        GridComponent<Ctype, CresultData>* comp_ptr = 
-            *Tbase::MiterMemento->getCurrentIterator();
-        typename std::unique_ptr<ForwardIterationState<Ctype, CresultData>>
-          state(new ForwardIterationState<Ctype, CresultData>(
-          comp_ptr->begin(), comp_ptr->end()));
-        Tbase::MiterMemento->pushState(std::move(state));
-      } else
-      {
-        Tbase::MiterMemento->next();
-          
-        while (! Tbase::MiterMemento->empty() && 
-            Tbase::MiterMemento->iterationStateIsEnd())
+        //! copy the iterator strategy into memory provided by the caller
+        virtual CompositeIterator<Ctype, CresultData>* clone(void* memory,
+            size_t const size) const
         {
-          Tbase::MiterMemento->popState();
-          if (! Tbase::MiterMemento->empty()) { Tbase::MiterMemento->next(); }
+          return CompositeIterator<Ctype, CresultData>::cloneAt(*this,
+              memory, size);
         }
-        if (Tbase::MiterMemento->empty())
+
+      protected:
+        //! only grids are items of the iteration
+        virtual bool isItem(Tcomp_ptr comp) const
         {
-          Tbase::MisDone = true;
+          return GridComponent<Ctype, CresultData>::Composite ==
+            comp->getComponentType();
         }
-      }
-      while (!Tbase::MisDone && 
-          (*Tbase::MiterMemento->getCurrentIterator())->getComponentType() !=
-          GridComponent<Ctype, CresultData>::Composite)
-      {
-        Tbase::MiterMemento->next();
-      }
-    } // function ForwardGridIterator<Ctype, CresultData>::next
 
-    /* --------------------------------------------------------------------- */
+    }; // class template ForwardGridIterator
+
+    /* ===================================================================== */
 
   } // namespace iterator
 
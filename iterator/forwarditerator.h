@@ -30,10 +30,12 @@
  * 
  * REVISIONS and CHANGES 
  * 01/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free iteration by means of a value semantic
+ *                   memento.
  * 
  * ============================================================================
  */
- 
+
 #include <memory>
 #include <optimizexx/iterator/compositeiterator.h>
 #include <optimizexx/iterator/iterationmemento.h>
@@ -55,6 +57,10 @@ namespace optimize
      * optimizexx::iterator::IterationMemento).\n
      *
      * Note, that here the Strategy design pattern is in use (GoF p.315).
+     * The iteration state is captured by a value semantic
+     * optimize::iterator::IterationMemento so that copying and advancing
+     * the iterator do not allocate any memory. Derived strategies restrict
+     * the iteration to certain grid components by overriding isItem().
      *
      * \ingroup group_iterator
      */
@@ -71,19 +77,12 @@ namespace optimize
          * constructor
          *
          * \param root Pointer to the composite creating the iterator.
-         * \param iter_mode_ptr Mode/memento of the iteration.
+         * \param iter_mode Mode/memento of the iteration.
          */
         ForwardIterator(Tcomp_ptr root,
-            typename std::unique_ptr<IterationMemento<Ctype, CresultData>>
-            iter_mode_ptr) : Mcomponent(root), MisDone(false),
-            MiterMemento(std::move(iter_mode_ptr))
+            IterationMemento<Ctype, CresultData> const& iter_mode) :
+            Mcomponent(root), MisDone(true), MiterMemento(iter_mode)
         { }
-        /*!
-         * copy constructor
-         *
-         * \param rhs argument to copy
-         */
-        ForwardIterator(ForwardIterator<Ctype, CresultData> const& rhs);
         //! destructor
         virtual ~ForwardIterator() { }
         //! set iterator to first element in parameter space composite (grid)
@@ -97,7 +96,7 @@ namespace optimize
         //! query function for current item
         virtual Tcomp_ptr currentItem() const
         {
-          return *MiterMemento->getCurrentIterator();
+          return *MiterMemento.getCurrentIterator();
         }
         /*! 
          * perform deep copy of an iterator strategy\n
@@ -112,6 +111,22 @@ namespace optimize
         {
           return TstrategyPtr(new ForwardIterator(*this));
         }
+        //! copy the iterator strategy into memory provided by the caller
+        virtual Tbase* clone(void* memory, size_t const size) const
+        {
+          return Tbase::cloneAt(*this, memory, size);
+        }
+
+      protected:
+        /*!
+         * query function if the iteration stops at a grid component
+         *
+         * \param comp grid component
+         * \return \c true by default - all grid components are visited
+         */
+        virtual bool isItem(Tcomp_ptr comp) const { return true; }
+        //! skip grid components which are not items of the iteration
+        void skip();
 
       protected:
         //! pointer to the root element of the iteration
@@ -124,42 +139,16 @@ namespace optimize
          * iterator stores the memento internally. The functionalism of pre- or
          * rather post-order iteration is delegated to the memento.
          */
-        typename std::unique_ptr<IterationMemento<Ctype, CresultData>>
-          MiterMemento;
+        IterationMemento<Ctype, CresultData> MiterMemento;
 
     }; // class template ForwardIterator
 
     /* ===================================================================== */
     template <typename Ctype, typename CresultData>
-    ForwardIterator<Ctype, CresultData>::ForwardIterator(
-        ForwardIterator<Ctype, CresultData> const& rhs) :
-      Mcomponent(rhs.Mcomponent), MisDone(rhs.MisDone),
-#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
-      MiterMemento(nullptr)
-#else
-      MiterMemento(0)
-#endif
-    {
-      // copy of iteration memento is a deep copy
-      this->MiterMemento = rhs.MiterMemento->clone();
-    } // copy constructor
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
     void ForwardIterator<Ctype, CresultData>::first()
     {
-      MiterMemento->reset();
-      if (Mcomponent->begin() != Mcomponent->end())
-      {
-        MisDone = false;
-        typename std::unique_ptr<ForwardIterationState<Ctype, CresultData>>
-          state(new ForwardIterationState<Ctype, CresultData>(
-          Mcomponent->begin(), Mcomponent->end()));
-        MiterMemento->pushState(std::move(state));
-      } else
-      {
-        MisDone = true;
-      }
+      MiterMemento.first(Mcomponent, false);
+      skip();
     } // function ForwardIterator<Ctype, CresultData>::first
 
     /* --------------------------------------------------------------------- */
@@ -167,60 +156,38 @@ namespace optimize
     void ForwardIterator<Ctype, CresultData>::back()
     {
       // not really effective but must be done as follows to guarantee
-      // correct behaviour both for pre- and post-order iterators
+      // correct behaviour both for pre- and post-order iterators - copying
+      // the memento does not allocate any memory
       first();
+      if (MisDone) { return; }
 
-      if (! MisDone)
+      IterationMemento<Ctype, CresultData> last(MiterMemento);
+      for (next(); ! MisDone; next())
       {
-        while (true)
-        {
-          if (! (*MiterMemento->getCurrentIterator())->createIterator(
-                ForwardIter).isDone())
-          {
-            Tcomp_ptr comp_ptr = *MiterMemento->getCurrentIterator();
-            typename std::unique_ptr<ForwardIterationState<Ctype, CresultData>>
-              state(new ForwardIterationState<Ctype, CresultData>(
-              comp_ptr->begin(), comp_ptr->end()));
-            MiterMemento->pushState(std::move(state));
-          } else
-          {
-            MiterMemento->next();
-            while (! MiterMemento->iterationIsBack() &&
-                MiterMemento->iterationStateIsEnd())
-            {
-              MiterMemento->popState();
-              if (! MiterMemento->iterationIsBack()) { MiterMemento->next(); }
-            }
-            if (MiterMemento->iterationIsBack()) { break; }
-          }
-        }
+        last = MiterMemento;
       }
+      MiterMemento = last;
+      MisDone = false;
     } // function ForwardIterator<Ctype, CresultData>::back
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
     void ForwardIterator<Ctype, CresultData>::next()
     {
-      if (! (*MiterMemento->getCurrentIterator())->createIterator(
-            ForwardIter).isDone())
-      {
-        Tcomp_ptr comp_ptr = *MiterMemento->getCurrentIterator();
-        typename std::unique_ptr<ForwardIterationState<Ctype, CresultData>>
-          state(new ForwardIterationState<Ctype, CresultData>(
-          comp_ptr->begin(), comp_ptr->end()));
-        MiterMemento->pushState(std::move(state));
-      } else
+      MiterMemento.next();
+      skip();
+    } // function ForwardIterator<Ctype, CresultData>::next
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ForwardIterator<Ctype, CresultData>::skip()
+    {
+      while (! MiterMemento.empty() && ! isItem(currentItem()))
       {
-        MiterMemento->next();
-          
-        while (! MiterMemento->empty() && MiterMemento->iterationStateIsEnd())
-        {
-          MiterMemento->popState();
-          if (! MiterMemento->empty()) { MiterMemento->next(); }
-        }
-        if (MiterMemento->empty()) { MisDone = true; }
+        MiterMemento.next();
       }
-    } // function ForwardIterator<Ctype, CresultData>::next
+      MisDone = MiterMemento.empty();
+    } // function ForwardIterator<Ctype, CresultData>::skip
 
     /* --------------------------------------------------------------------- */
 
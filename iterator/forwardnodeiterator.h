@@ -32,11 +32,11 @@
  * 
  * REVISIONS and CHANGES 
  * 12/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free iteration.
  * 
  * ============================================================================
  */
 
-#include <memory>
 #include <optimizexx/iterator/forwarditerator.h>
 #include <optimizexx/error.h>
  
@@ -51,10 +51,6 @@ namespace optimize
 
     // forward declarations
     template <typename Ctype, typename CresultData> class IterationMemento;
-    template <typename Ctype, typename CresultData> class
-      ForwardIterationState;
-    template <typename Ctype, typename CresultData> class ReverseNodeIterator;
-      
 
     /* ===================================================================== */
     /*!
@@ -73,32 +69,11 @@ namespace optimize
       public:
         //! constructor
         ForwardNodeIterator(Tcomp_ptr root,
-            typename std::unique_ptr<IterationMemento<Ctype, CresultData>>
-            iter_mode_ptr) : Tbase(root, std::move(iter_mode_ptr))
-        { }
-        /*!
-         * copy constructor
-         * 
-         * \param rhs argument to copy
-         */
-        ForwardNodeIterator(ForwardNodeIterator<Ctype, CresultData> const& rhs)
-          : Tbase(rhs)
+            IterationMemento<Ctype, CresultData> const& iter_mode) :
+          Tbase(root, iter_mode)
         { }
         //! destructor
         virtual ~ForwardNodeIterator() { }
-        //! set iterator to first node in parameter space composite (grid)
-        virtual void first();
-        //! set iterator to last node in parameter space composite (grid)
-        virtual void back();
-        //! go to the next node
-        virtual void next();
-        //! query function if iteration is finished
-        virtual bool isDone() const { return Tbase::MisDone; }
-        //! query function for current node
-        virtual Tcomp_ptr currentItem() const
-        {
-          return *Tbase::MiterMemento->getCurrentIterator();
-        }
         /*! 
          * perform deep copy of an iterator strategy\n
          * Notice that here the
@@ -112,89 +87,25 @@ namespace optimize
         {
           return TstrategyPtr(new ForwardNodeIterator(*this));
         }
-
-    }; // class template ForwardNodeIterator
-
-    /* ===================================================================== */
-    template <typename Ctype, typename CresultData>
-    void ForwardNodeIterator<Ctype, CresultData>::first()
-    {
-      Tbase::MiterMemento->reset();
-      if (Tbase::Mcomponent->begin() != Tbase::Mcomponent->end())
-      {
-        Tbase::MisDone = false;
-        typename std::unique_ptr<ForwardIterationState<Ctype, CresultData>>
-          state(new ForwardIterationState<Ctype, CresultData>(
-          Tbase::Mcomponent->begin(), Tbase::Mcomponent->end()));
-        Tbase::MiterMemento->pushState(std::move(state));
-        while (!Tbase::MisDone && 
-            (*Tbase::MiterMemento->getCurrentIterator())->getComponentType() !=
-            GridComponent<Ctype, CresultData>::Leaf)
+        //! copy the iterator strategy into memory provided by the caller
+        virtual CompositeIterator<Ctype, CresultData>* clone(void* memory,
+            size_t const size) const
         {
-          next();
+          return CompositeIterator<Ctype, CresultData>::cloneAt(*this,
+              memory, size);
         }
-      } else
-      {
-        Tbase::MisDone = true;
-      }
-    } // function ForwardNodeIterator<Ctype, CresultData>::first
 
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
-    void ForwardNodeIterator<Ctype, CresultData>::back()
-    {
-      // not really efficiant but must be done as follows to guarantee
-      // correct behaviour both for pre- and post-order iterators
-      first();
-      
-      ReverseNodeIterator<Ctype, CresultData> rev_iter(Tbase::Mcomponent,
-          std::move(Tbase::MiterMemento->create()));
-      rev_iter.first();
-
-      while (! Tbase::MisDone && rev_iter.currentItem() != currentItem())
-      { 
-        next();
-      }
-    } // function ForwardNodeIterator<Ctype, CresultData>::back
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
-    void ForwardNodeIterator<Ctype, CresultData>::next()
-    {
-      if (! (*Tbase::MiterMemento->getCurrentIterator())->createIterator(
-            ForwardNodeIter).isDone())
-      {
-        Tcomp_ptr comp_ptr = *Tbase::MiterMemento->getCurrentIterator();
-        typename std::unique_ptr<ForwardIterationState<Ctype, CresultData>>
-          state(new ForwardIterationState<Ctype, CresultData>(
-          comp_ptr->begin(), comp_ptr->end()));
-        Tbase::MiterMemento->pushState(std::move(state));
-      } else
-      {
-        Tbase::MiterMemento->next();
-          
-        while (! Tbase::MiterMemento->empty() && 
-            Tbase::MiterMemento->iterationStateIsEnd())
+      protected:
+        //! only nodes are items of the iteration
+        virtual bool isItem(Tcomp_ptr comp) const
         {
-          Tbase::MiterMemento->popState();
-          if (! Tbase::MiterMemento->empty()) { Tbase::MiterMemento->next(); }
+          return GridComponent<Ctype, CresultData>::Leaf ==
+            comp->getComponentType();
         }
 
-        if (Tbase::MiterMemento->empty())
-        {
-          Tbase::MisDone = true;
-        }
-      }
-
-      while (!Tbase::MisDone && 
-          (*Tbase::MiterMemento->getCurrentIterator())->getComponentType() !=
-          GridComponent<Ctype, CresultData>::Leaf)
-      {
-        Tbase::MiterMemento->next();
-      }
-    } // function ForwardNodeIterator<Ctype, CresultData>::next
+    }; // class template ForwardNodeIterator
 
-    /* --------------------------------------------------------------------- */
+    /* ===================================================================== */
 
   } // namespace iterator
 
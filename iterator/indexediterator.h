@@ -0,0 +1,229 @@
+/*! \file indexediterator.h
+ * \brief Declaration of an iterator strategy traversing index addressed
+ * parameter space grids.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Declaration of an iterator strategy traversing index addressed
+ * parameter space grids.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Provide random access.
+ * 14/10/2026  V0.3  Allocation free copies.
+ * 
+ * ============================================================================
+ */
+
+#include <memory>
+#include <optimizexx/iterator/compositeiterator.h>
+#include <optimizexx/indexednode.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_INDEXEDITERATOR_H_
+#define _OPTIMIZEXX_INDEXEDITERATOR_H_
+
+namespace optimize
+{
+  // forward declarations
+  template <typename Ctype, typename CresultData> class IndexedGrid;
+
+  namespace iterator
+  {
+
+    /* ===================================================================== */
+    /*!
+     * Concrete iterator strategy to traverse the grid points of an
+     * optimize::IndexedGrid either in forward or in reverse direction.\n
+     * Note, that here the Strategy design pattern is in use (GoF p.315).\n
+     *
+     * The iterator does not need an iteration memento. Its state is the
+     * linear index of the current grid point. The item the iterator returns
+     * is a flyweight node owned by the iterator so that the returned pointer
+     * is only valid until the iterator is moved.\n
+     * Since grid points are addressed by their index the iterator provides
+     * random access.
+     *
+     * \ingroup group_iterator
+     */
+    template <typename Ctype, typename CresultData>
+    class IndexedIterator : public CompositeIterator<Ctype, CresultData>
+    {
+      public: 
+        typedef CompositeIterator<Ctype, CresultData> Tbase;
+        typedef typename Tbase::Tcomp_ptr Tcomp_ptr;
+        typedef typename Tbase::TstrategyPtr TstrategyPtr;
+
+      public:
+        /*!
+         * constructor
+         *
+         * \param root Pointer to the grid creating the iterator.
+         * \param reverse Traverse the grid in reverse direction.
+         */
+        IndexedIterator(IndexedGrid<Ctype, CresultData> const* root,
+            bool reverse) : Mgrid(root), Mreverse(reverse), MisDone(true),
+            Mnode(root)
+        { }
+        //! destructor
+        virtual ~IndexedIterator() { }
+        //! set iterator to first grid point
+        virtual void first();
+        //! set iterator to last grid point
+        virtual void back();
+        //! go to the next grid point
+        virtual void next();
+        //! query function if iteration is finished
+        virtual bool isDone() const { return MisDone; }
+        //! query function for current grid point
+        virtual Tcomp_ptr currentItem() const
+        {
+          return const_cast<IndexedNode<Ctype, CresultData>*>(&Mnode);
+        }
+        /*!
+         * Compare the position of two iterator strategies. Flyweight nodes
+         * of different iterators are different objects so that the linear
+         * indices have to be compared.
+         *
+         * \param rhs iterator strategy to compare with
+         * \return if both iterators point to the same grid point
+         */
+        virtual bool equals(Tbase const& rhs) const;
+        //! query function if the strategy provides random access
+        virtual bool isRandomAccess() const { return true; }
+        /*!
+         * Advance the iterator by \c n grid points in constant time.
+         *
+         * \param n number of grid points to be advanced
+         */
+        virtual void advance(size_t const n);
+        //! query function for the position of the current grid point
+        virtual size_t getPosition() const;
+        //! query function for the number of grid points
+        virtual size_t getSize() const { return Mgrid->size(); }
+        /*! 
+         * perform deep copy of an iterator strategy\n
+         * Notice that here the
+         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
+         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
+         * applied.
+         *
+         * \return unique pointer to the deep copy of iterator strategy
+         */
+        virtual TstrategyPtr clone() const
+        {
+          return TstrategyPtr(new IndexedIterator(*this));
+        }
+        //! copy the iterator strategy into memory provided by the caller
+        virtual Tbase* clone(void* memory, size_t const size) const
+        {
+          return Tbase::cloneAt(*this, memory, size);
+        }
+
+      private:
+        //! grid to be traversed
+        IndexedGrid<Ctype, CresultData> const* Mgrid;
+        //! direction of the iteration
+        bool Mreverse;
+        //! variable to save wether iteration is finished
+        bool MisDone;
+        //! flyweight node pointing to the current grid point
+        IndexedNode<Ctype, CresultData> Mnode;
+
+    }; // class template IndexedIterator
+
+    /* ===================================================================== */
+    template <typename Ctype, typename CresultData>
+    void IndexedIterator<Ctype, CresultData>::first()
+    {
+      size_t const num = Mgrid->size();
+      MisDone = 0 == num;
+      if (! MisDone) { Mnode.setIndex(Mreverse ? num-1 : 0); }
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void IndexedIterator<Ctype, CresultData>::back()
+    {
+      size_t const num = Mgrid->size();
+      MisDone = 0 == num;
+      if (! MisDone) { Mnode.setIndex(Mreverse ? 0 : num-1); }
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void IndexedIterator<Ctype, CresultData>::next()
+    {
+      size_t const index = Mnode.getIndex();
+      if (Mreverse ? 0 == index : Mgrid->size() == index+1)
+      {
+        MisDone = true;
+      } else
+      {
+        Mnode.setIndex(Mreverse ? index-1 : index+1);
+      }
+    } // function IndexedIterator<Ctype, CresultData>::next
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    bool IndexedIterator<Ctype, CresultData>::equals(Tbase const& rhs) const
+    {
+      IndexedIterator<Ctype, CresultData> const* iter =
+        dynamic_cast<IndexedIterator<Ctype, CresultData> const*>(&rhs);
+      if (0 == iter || iter->Mgrid != Mgrid) { return false; }
+      if (MisDone || iter->MisDone) { return MisDone == iter->MisDone; }
+      return Mnode.getIndex() == iter->Mnode.getIndex();
+    } // function IndexedIterator<Ctype, CresultData>::equals
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void IndexedIterator<Ctype, CresultData>::advance(size_t const n)
+    {
+      if (MisDone) { return; }
+      size_t const pos = getPosition();
+      size_t const last = Mgrid->size()-1;
+      size_t const new_pos = n < last-pos ? pos+n : last;
+      Mnode.setIndex(Mreverse ? last-new_pos : new_pos);
+    } // function IndexedIterator<Ctype, CresultData>::advance
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    size_t IndexedIterator<Ctype, CresultData>::getPosition() const
+    {
+      size_t const num = Mgrid->size();
+      if (MisDone) { return num; }
+      return Mreverse ? num-1-Mnode.getIndex() : Mnode.getIndex();
+    } // function IndexedIterator<Ctype, CresultData>::getPosition
+
+    /* --------------------------------------------------------------------- */
+
+  } // namespace iterator
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF indexediterator.h  ----- */
@@ -30,13 +30,17 @@
  * 
  * REVISIONS and CHANGES 
  * 23/02/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free value semantic memento.
+ * 14/10/2026  V0.3  Spill iteration states beyond the inline capacity to the
+ *                   heap.
  * 
  * ============================================================================
  */
 
-#include <deque>
-#include <memory>
+#include <algorithm>
+#include <vector>
 #include <optimizexx/iterator/iterationstate.h>
+#include <optimizexx/error.h>
 
 #ifndef _OPTIMIZEXX_ITERATIONMEMENTO_H_
 #define _OPTIMIZEXX_ITERATIONMEMENTO_H_
@@ -48,9 +52,9 @@ namespace optimize
   {
     /* ===================================================================== */
     /*!
-     * Abstract base memento class of the memento design pattern (GoF p.283)
-     * which is  responsible for saving the iterator's internal states. Stored
-     * are instances of IterationState.\n
+     * Memento class of the memento design pattern (GoF p.283) which is
+     * responsible for saving the iterator's internal states. Stored are
+     * instances of IterationState.\n
      * 
      * Note that in this case the memento design pattern is not implemented as
      * suggested in GoF.\n
@@ -61,91 +65,118 @@ namespace optimize
      * memento stores its own state which means that it is its own caretaker,
      * too.\n
      *
+     * The memento is a value type. The iteration states of the first
+     * MinlineDepth levels of nested grids are kept within a stack stored
+     * inline so that copying a memento (and therefore copying an iterator)
+     * and advancing the iteration do not allocate any memory. States of
+     * deeper levels (e.g. a deeply refined optimize::AdaptiveGridSearch)
+     * spill to the heap.\n
+     *
+     * The memento implements the traversal of the parameter space both in
+     * pre-order (a grid is visited before its children) and post-order (a
+     * grid is visited after its children) so that iterator strategies are
+     * independent of the mode of iteration.
+     *
      * \ingroup group_iterator
      */
     template <typename Ctype, typename CresultData>
     class IterationMemento
     {
       public:
-        typedef typename std::unique_ptr<IterationState<Ctype, CresultData>>
-          Tstate;
-        typedef typename std::unique_ptr<IterationMemento<Ctype, CresultData>>
-          TmementoPtr;
+        typedef IterationState<Ctype, CresultData> Tstate;
+        typedef GridComponent<Ctype, CresultData>* Tcomp_ptr;
+        typedef typename Tstate::Titer Titer;
+
+      public:
+        //! depth of nested grids stored without allocating any memory
+        static size_t const MinlineDepth = 16;
 
       public:
-        //! copy constructor
+        /*!
+         * constructor
+         *
+         * \param pre_order mode of iteration - post-order if \c false
+         */
+        explicit IterationMemento(bool pre_order=false) : Msize(0),
+          MpreOrder(pre_order), Mreverse(false)
+        { }
+        //! copy constructor - copies the states in use only
         IterationMemento(IterationMemento<Ctype, CresultData> const& rhs);
-        //! destructor
-        virtual ~IterationMemento() { }
+        //! assignment operator - copies the states in use only
+        IterationMemento<Ctype, CresultData>& operator=(
+            IterationMemento<Ctype, CresultData> const& rhs);
+        /*!
+         * Start an iteration over the descendants of \c root.
+         *
+         * \param root root grid component of the iteration
+         * \param reverse iterate the children of composites in reverse order
+         */
+        void first(Tcomp_ptr root, bool reverse);
+        /*!
+         * Proceed with the iteration to the next grid component. The memento
+         * is empty after the last component had been passed.
+         */
+        void next();
         /*!
          * add a new iteration state
          *
          * \param state iteration state
          */
-        virtual void pushState(Tstate state) = 0;
+        void pushState(Tstate const& state);
         //! delete the current state
-        virtual void popState();
+        void popState();
         /*!
          * query function if last state has finished iteration
          *
          * \return if last iteration state has finished iteration
          */
-        virtual bool iterationStateIsEnd() const;
-        /*!
-         * query function if last iteration has reached last element
-         *
-         * \return status
-         */
-        virtual bool iterationIsBack();
+        bool iterationStateIsEnd() const;
         /*!
          * query function for the current iterator
          *
          * \return current iterator
          */
-        virtual typename IterationState<Ctype, CresultData>::Titer&
-          getCurrentIterator();
-        //! proceed with iteration
-        virtual void next() { MstateStack.back()->next(); }
+        Titer& getCurrentIterator();
+        //! query function for the current iterator
+        Titer const& getCurrentIterator() const;
         //! query function if iteration state container is empty
-        bool empty() const { return MstateStack.empty(); }
+        bool empty() const { return 0 == Msize; }
         //! empty the memento's stack
-        void reset();
-        //! assignment operator
-        virtual IterationMemento<Ctype, CresultData>& operator=(
-            IterationMemento<Ctype, CresultData> const& rhs);
-        /*! 
-         * perform deep copy of an iteration memento\n
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied because C++ does neither support virtual copy constructors
-         * not virtual constructors.
-         *
-         * \return unique pointer to the deep copy of iteration momento
-         */
-        virtual TmementoPtr clone() const = 0;
-        /*!
-         * virtual constructor for an iteration memento
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied because C++ does neither support virtual copy constructors
-         * not virtual constructors.
-         *
-         * \return unique pointer to constructed iteration momento
-         */
-        virtual TmementoPtr create() const = 0;
+        void reset() { Msize = 0; MspilledStates.clear(); }
+        //! query function for the mode of iteration
+        bool isPreOrder() const { return MpreOrder; }
 
-      protected:
-        //! constructor
-        IterationMemento() { }
+      private:
+        //! query function if a component has children to be iterated
+        static bool hasChildren(Tcomp_ptr comp);
+        //! push the iteration state of the children of a composite
+        void pushChildren(Tcomp_ptr comp);
+        //! descend to the first leaf or empty composite (post-order)
+        void descend();
+        //! query function for the iteration state on top of the stack
+        Tstate& top()
+        {
+          return Msize > MinlineDepth ? MspilledStates.back() :
+            MstateStack[Msize-1];
+        }
+        //! query function for the iteration state on top of the stack
+        Tstate const& top() const
+        {
+          return Msize > MinlineDepth ? MspilledStates.back() :
+            MstateStack[Msize-1];
+        }
 
-      protected:
-        /*!
-         *  Iteration state stack which basically is a std::deque to make use of
-         *  both push/pop - back/front functionalism.
-         */
-        typename std::deque<Tstate> MstateStack;
+      private:
+        //! inline iteration state stack - the top is the last element
+        Tstate MstateStack[MinlineDepth];
+        //! iteration states beyond the inline capacity
+        std::vector<Tstate> MspilledStates;
+        //! number of iteration states in use
+        size_t Msize;
+        //! mode of iteration
+        bool MpreOrder;
+        //! direction of the iteration
+        bool Mreverse;
 
     }; // class template IterationMemento
 
@@ -159,52 +190,11 @@ namespace optimize
     class PostIterationMemento : public IterationMemento<Ctype, CresultData>
     {
       public:
-        typedef iterator::IterationMemento<Ctype, CresultData> Tbase;
-        typedef typename Tbase::TmementoPtr TmementoPtr;
+        typedef IterationMemento<Ctype, CresultData> Tbase;
 
       public:
         //! constructor
-        PostIterationMemento() { }
-        //! copy constructor
-        PostIterationMemento(
-            PostIterationMemento<Ctype, CresultData> const& rhs) : Tbase(rhs)
-        { }
-        //! destructor
-        virtual ~PostIterationMemento() { }
-        /*!
-         * add a new iteration state
-         *
-         * \param state iteration state
-         */
-        virtual void pushState(typename Tbase::Tstate state);
-        /*! 
-         * perform deep copy of an iteration memento\n
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied.
-         *
-         * \return unique pointer to the deep copy of iteration momento
-         */
-        virtual TmementoPtr clone() const
-        {
-          return TmementoPtr(
-              new PostIterationMemento<Ctype, CresultData>(*this));
-        }
-        /*!
-         * virtual constructor for an iteration memento
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied because C++ does neither support virtual copy constructors
-         * not virtual constructors.
-         *
-         * \return unique pointer to constructed post iteration momento
-         */
-        virtual TmementoPtr create() const 
-        {
-          return TmementoPtr(new PostIterationMemento<Ctype, CresultData>);
-        }
+        PostIterationMemento() : Tbase(false) { }
 
     }; // class template PostIterationMemento
 
@@ -219,141 +209,171 @@ namespace optimize
     {
       public:
         typedef IterationMemento<Ctype, CresultData> Tbase;
-        typedef typename Tbase::TmementoPtr TmementoPtr;
 
       public:
         //! constructor
-        PreIterationMemento() { }
-        //! copy constructor
-        PreIterationMemento(
-            PreIterationMemento<Ctype, CresultData> const& rhs) : Tbase(rhs)
-        { }
-        //! destructor
-        virtual ~PreIterationMemento() { }
-        /*!
-         * add a new iteration state
-         *
-         * \param state iteration state
-         */
-        virtual void pushState(typename Tbase::Tstate state);
-        /*! 
-         * perform deep copy of an preiteration memento\n
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied.
-         *
-         * \return unique pointer to the deep copy of iteration momento
-         */
-        virtual TmementoPtr clone() const
-        {
-          return TmementoPtr(
-              new PreIterationMemento<Ctype, CresultData>(*this));
-        }
-        /*!
-         * virtual constructor for an preiteration memento
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied because C++ does neither support virtual copy constructors
-         * not virtual constructors.
-         *
-         * \return unique pointer to constructed pre iteration momento
-         */
-        virtual TmementoPtr create() const 
-        {
-          return TmementoPtr(new PreIterationMemento<Ctype, CresultData>);
-        }
+        PreIterationMemento() : Tbase(true) { }
 
     }; // class template PreIterationMemento
 
     /* ===================================================================== */
     // function definitions of IterationMemento
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    size_t const IterationMemento<Ctype, CresultData>::MinlineDepth;
+
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
     IterationMemento<Ctype, CresultData>::IterationMemento(
-    IterationMemento<Ctype, CresultData> const& rhs)
+        IterationMemento<Ctype, CresultData> const& rhs) :
+      MspilledStates(rhs.MspilledStates), Msize(rhs.Msize),
+      MpreOrder(rhs.MpreOrder), Mreverse(rhs.Mreverse)
     {
-      // deep copy of state stack
-      for (typename std::deque<Tstate>::const_iterator cit(
-            rhs.MstateStack.begin()); cit != rhs.MstateStack.end(); ++cit)
+      std::copy(rhs.MstateStack,
+          rhs.MstateStack+std::min(Msize, MinlineDepth), MstateStack);
+    } // copy constructor
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    IterationMemento<Ctype, CresultData>&
+    IterationMemento<Ctype, CresultData>::operator=(
+        IterationMemento<Ctype, CresultData> const& rhs)
+    {
+      if (this != &rhs)
       {
-        this->MstateStack.push_back((*cit)->clone());
+        Msize = rhs.Msize;
+        MpreOrder = rhs.MpreOrder;
+        Mreverse = rhs.Mreverse;
+        std::copy(rhs.MstateStack,
+            rhs.MstateStack+std::min(Msize, MinlineDepth), MstateStack);
+        MspilledStates = rhs.MspilledStates;
       }
-    } // copy constructor
+      return *this;
+    }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
-    typename IterationState<Ctype, CresultData>::Titer&
-    IterationMemento<Ctype, CresultData>::getCurrentIterator()
+    void IterationMemento<Ctype, CresultData>::first(Tcomp_ptr root,
+        bool reverse)
+    {
+      reset();
+      Mreverse = reverse;
+      if (hasChildren(root))
+      {
+        pushChildren(root);
+        if (! MpreOrder) { descend(); }
+      }
+    } // function IterationMemento<Ctype, CresultData>::first
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void IterationMemento<Ctype, CresultData>::next()
+    {
+      if (MpreOrder)
+      {
+        Tcomp_ptr comp = *getCurrentIterator();
+        if (hasChildren(comp))
+        {
+          pushChildren(comp);
+          return;
+        }
+        top().next();
+        while (! empty() && iterationStateIsEnd())
+        {
+          // the parent composite had been visited before its children
+          popState();
+          if (! empty()) { top().next(); }
+        }
+      } else
+      {
+        top().next();
+        if (iterationStateIsEnd())
+        {
+          // visit the parent composite after its children
+          popState();
+        } else
+        {
+          descend();
+        }
+      }
+    } // function IterationMemento<Ctype, CresultData>::next
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void IterationMemento<Ctype, CresultData>::pushState(Tstate const& state)
     {
-      return MstateStack.back()->getIterator();
+      if (Msize < MinlineDepth)
+      {
+        MstateStack[Msize] = state;
+      } else
+      {
+        MspilledStates.push_back(state);
+      }
+      ++Msize;
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
     void IterationMemento<Ctype, CresultData>::popState()
     { 
-      MstateStack.pop_back();
+      if (Msize > MinlineDepth) { MspilledStates.pop_back(); }
+      --Msize;
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
     bool IterationMemento<Ctype, CresultData>::iterationStateIsEnd() const
     { 
-      return MstateStack.back()->isEnd();
+      return top().isEnd();
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
-    bool IterationMemento<Ctype, CresultData>::iterationIsBack()
+    typename IterationMemento<Ctype, CresultData>::Titer&
+    IterationMemento<Ctype, CresultData>::getCurrentIterator()
     {
-      return 1 == MstateStack.size() && MstateStack.back()->isBack();
+      return top().getIterator();
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
-    void IterationMemento<Ctype, CresultData>::reset()
+    typename IterationMemento<Ctype, CresultData>::Titer const&
+    IterationMemento<Ctype, CresultData>::getCurrentIterator() const
     {
-      MstateStack.clear();
+      return const_cast<Tstate&>(top()).getIterator();
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
-    IterationMemento<Ctype, CresultData>&
-    IterationMemento<Ctype, CresultData>::operator=(
-        IterationMemento<Ctype, CresultData> const& rhs)
+    bool IterationMemento<Ctype, CresultData>::hasChildren(Tcomp_ptr comp)
     {
-      if (this != &rhs)
-      {
-        // deep copy of state stack
-        for (typename std::deque<Tstate>::const_iterator cit(
-              rhs.MstateStack.begin()); cit != rhs.MstateStack.end(); ++cit)
-        {
-          this->MstateStack.push_back((*cit)->clone());
-        }
-      }
-      return *this;
+      return GridComponent<Ctype, CresultData>::Composite ==
+        comp->getComponentType() && comp->begin() != comp->end();
     }
 
-    /* ===================================================================== */
-    // function definitions of PostIterationMemento
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
-    void PostIterationMemento<Ctype, CresultData>::pushState(typename
-        Tbase::Tstate state)
+    void IterationMemento<Ctype, CresultData>::pushChildren(Tcomp_ptr comp)
     {
-      Tbase::MstateStack.push_front(std::move(state));
+      if (Mreverse)
+      {
+        pushState(ReverseIterationState<Ctype, CresultData>(
+              comp->rbegin(), comp->rend()));
+      } else
+      {
+        pushState(ForwardIterationState<Ctype, CresultData>(
+              comp->begin(), comp->end()));
+      }
     }
 
-    /* ===================================================================== */
-    // function definitions of PreIterationMemento
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
-    void PreIterationMemento<Ctype, CresultData>::pushState(typename
-        Tbase::Tstate state)
+    void IterationMemento<Ctype, CresultData>::descend()
     {
-      Tbase::MstateStack.push_back(std::move(state));
+      while (hasChildren(*getCurrentIterator()))
+      {
+        pushChildren(*getCurrentIterator());
+      }
     }
 
     /* --------------------------------------------------------------------- */
@@ -30,11 +30,12 @@
  * 
  * REVISIONS and CHANGES 
  * 31/03/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Value semantic iteration states.
+ * 14/10/2026  V0.3  Document the invalidation of iteration states.
  * 
  * ============================================================================
  */
 
-#include <memory>
 #include <optimizexx/error.h>
 
 #ifndef _OPTIMIZEXX_ITERATIONSTATE_H_
@@ -51,7 +52,20 @@ namespace optimize
   {
     /* ===================================================================== */
     /*!
-     * Abstract base class for iteration states.
+     * Iteration state of a single level of the parameter space i.e. the
+     * position within the children of a composite.\n
+     *
+     * An iteration state is a plain value consisting of container iterators
+     * only. It is copied without allocating any memory so that
+     * optimize::iterator::IterationMemento is able to store the states
+     * inline. Both the forward and the reverse iteration state keep usual
+     * (forward) container iterators. The reverse state moves them backwards.
+     * Derived classes merely provide constructors and must not add any data
+     * members.\n
+     *
+     * Since the children of a grid are stored contiguously (see
+     * optimize::Grid) adding children to or removing children of the
+     * composite invalidates its iteration states.
      *
      * \todo IMPORTANT NOTE: Due to reasons of an increased transparancy and to
      * have an iterator for any kind of grid composite it would be more
@@ -68,34 +82,41 @@ namespace optimize
         typedef typename GridComponent<Ctype, CresultData>::Titer Titer;
         typedef typename GridComponent<Ctype, CresultData>::Treverse_iter
           Treverse_iter;
-        typedef typename std::unique_ptr<IterationState<Ctype, CresultData>>
-          TiterStatePtr; 
 
       public:
-        //! destructor
-        virtual ~IterationState() { }
+        //! constructor of an empty iteration state
+        IterationState() : Mreverse(false) { }
         //! query function for the iterator in the current iteration state
-        virtual Titer& getIterator() = 0;
+        Titer& getIterator() { return Miter; }
         //! test if iteration is finished
-        virtual bool isEnd() const = 0;
+        bool isEnd() const { return Miter == Mend; }
         //! test if iteration has reached last element
-        virtual bool isBack() = 0;
+        bool isBack() const;
         //! increment iterator in the current iteration state
-        virtual void next() = 0;
+        void next();
+
+      protected:
         /*!
-         * perform a deep copy of the iteration state\n
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied.
+         * constructor
          *
-         * \return unique pointer to new iteration state
+         * \param begin iterator to the first child of the composite
+         * \param iter iterator to the current child
+         * \param end iterator past the last child of the composite
+         * \param reverse direction of the iteration
          */
-        virtual TiterStatePtr clone() const = 0;
+        IterationState(Titer begin, Titer iter, Titer end, bool reverse) :
+          Mbegin(begin), Miter(iter), Mend(end), Mreverse(reverse)
+        { }
 
-      protected:
-        //! constructor
-        IterationState() { }
+      private:
+        //! iterator to the first child
+        Titer Mbegin;
+        //! iterator which will be changed
+        Titer Miter;
+        //! iterator which marks the end of the container
+        Titer Mend;
+        //! direction of the iteration
+        bool Mreverse;
 
     }; // class template IterationState
 
@@ -114,43 +135,12 @@ namespace optimize
         //! typedef to base class
         typedef IterationState<Ctype, CresultData> Tbase;
         typedef typename Tbase::Titer Titer;
-        typedef typename Tbase::TiterStatePtr TiterStatePtr;
 
       public:
         //! constructor
-        ForwardIterationState(Titer iter, Titer end_iter) : Miter(iter),
-          Mend_iter(end_iter)
+        ForwardIterationState(Titer iter, Titer end_iter) :
+          Tbase(iter, iter, end_iter, false)
         { }
-        //! destructor
-        virtual ~ForwardIterationState() { }
-        //! query function for the iterator in the current iteration state
-        virtual Titer& getIterator() { return Miter; }
-        //! test if iteration is finished
-        virtual bool isEnd() const { return Miter == Mend_iter; }
-        //! test if iteration has reached last element
-        virtual bool isBack() { Titer tmp(Mend_iter); return Miter == --tmp; }
-        //! increment iterator in the current iteration state
-        virtual void next() { ++Miter; }
-        /*!
-         * perform a deep copy of the iteration state\n
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied.
-         *
-         * \return unique pointer to new iteration state
-         */
-        virtual TiterStatePtr clone() const
-        {
-          return TiterStatePtr(
-              new ForwardIterationState<Ctype, CresultData>(*this));
-        }
-
-      private:
-        //! iterator which will be changed
-        Titer Miter;
-        //! iterator which marks the end of the container
-        Titer Mend_iter;
 
     }; // class template ForwardIterationState
 
@@ -159,7 +149,13 @@ namespace optimize
      * Provides a data structure to save a reverse iteration state. Iteration
      * states are handled by optimize::IterationMemento. Note that any iterator
      * of the parameter space grid container direcly works on the iteration
-     * state.
+     * state.\n
+     *
+     * The state is constructed from STL reverse iterators but stores the
+     * corresponding usual iterators (see \c base function of STL reverse
+     * iterators and http://drdobbs.com/184401406) so that
+     * IterationState::getIterator() returns a reference to an iterator
+     * pointing to the current element itself.
      *
      * \ingroup group_iterator
      */
@@ -171,63 +167,45 @@ namespace optimize
         typedef IterationState<Ctype, CresultData> Tbase;
         typedef typename Tbase::Treverse_iter Treverse_iter;
         typedef typename Tbase::Titer Titer;
-        typedef typename Tbase::TiterStatePtr TiterStatePtr;
 
       public:
         //! constructor
         ReverseIterationState(Treverse_iter iter, Treverse_iter end_iter) :
-          Miter(iter), Mend_iter(end_iter)
+          Tbase(end_iter.base(), getCurrent(iter, end_iter), iter.base(),
+              true)
         { }
-        //! destructor
-        virtual ~ReverseIterationState() { }
-        /*!
-         * query function for the iterator in the current iteration state
-         * 
-         * Makes use of \c base function of STL reverse iterator to return a
-         * common STL iterator. See also: http://drdobbs.com/184401406
-         *
-         * \note
-         * \code
-         *    return --Miter.base();
-         * \endcode
-         * might not compile with STL vectors or strings.
-         *
-         */
-        virtual Titer& getIterator() { return --Miter.base(); }
-        //! test if iteration is finished
-        virtual bool isEnd() const { return Miter == Mend_iter; }
-        //! test if iteration has reached last element
-        virtual bool isBack();
-        //! increment iterator in the current iteration state
-        virtual void next() { ++Miter; }
-        /*!
-         * perform a deep copy of the iteration state\n
-         * Notice that here the
-         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
-         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
-         * applied.
-         *
-         * \return unique pointer to new iteration state
-         */
-        virtual TiterStatePtr clone() const
-        {
-          return TiterStatePtr(
-              new ReverseIterationState<Ctype, CresultData>(*this));
-        }
 
       private:
-        //! iterator which will be changed
-        Treverse_iter Miter;
-        //! iterator which marks the end of the container
-        Treverse_iter Mend_iter;
+        //! usual iterator pointing to the element \c iter is referring to
+        static Titer getCurrent(Treverse_iter iter, Treverse_iter end_iter)
+        {
+          Titer retval(iter.base());
+          if (iter != end_iter) { --retval; }
+          return retval;
+        }
 
     }; // class template ReverseIterationState
 
     /* ===================================================================== */
     template <typename Ctype, typename CresultData>
-    bool ReverseIterationState<Ctype, CresultData>::isBack()
+    bool IterationState<Ctype, CresultData>::isBack() const
+    { 
+      if (Mreverse) { return Miter == Mbegin; }
+      Titer tmp(Mend); return Miter == --tmp;
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void IterationState<Ctype, CresultData>::next()
     { 
-      Treverse_iter tmp(Mend_iter); return Miter == --tmp;
+      if (! Mreverse)
+      {
+        ++Miter;
+      } else
+      {
+        // the end iterator marks the end of the reverse iteration as well
+        if (Miter == Mbegin) { Miter = Mend; } else { --Miter; }
+      }
     }
 
     /* --------------------------------------------------------------------- */
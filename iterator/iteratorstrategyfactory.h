@@ -32,6 +32,8 @@
  * 
  * REVISIONS and CHANGES 
  * 12/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Random access node iterator strategy.
+ * 14/10/2026  V0.3  Value semantic iteration mementos.
  * 
  * ============================================================================
  */
@@ -45,6 +47,7 @@
 #include <optimizexx/iterator/reverseiterator.h>
 #include <optimizexx/iterator/reversenodeiterator.h>
 #include <optimizexx/iterator/reversegriditerator.h>
+#include <optimizexx/iterator/randomaccessnodeiterator.h>
 #include <optimizexx/iterator/nulliterator.h>
 
 #ifndef _OPTIMIZEXX_ITERATORFACTORY_H_
@@ -95,8 +98,8 @@ namespace optimize
          *
          * \param iter_mode pointer to mode of iteration
          */
-        std::unique_ptr<IterationMemento<Ctype, CresultData>>
-          makeIterationMemento(EiterationMode iter_mode);
+        IterationMemento<Ctype, CresultData> makeIterationMemento(
+            EiterationMode iter_mode);
 
     }; // class template IteratorStrategyFactory
 
@@ -107,8 +110,8 @@ namespace optimize
         EiteratorType iter_type, EiterationMode iter_mode,
         GridComponent<Ctype, CresultData>* grid_comp)
     {
-      std::unique_ptr<IterationMemento<Ctype, CresultData>> mode =
-        makeIterationMemento(iter_mode);
+      IterationMemento<Ctype, CresultData> const mode(
+          makeIterationMemento(iter_mode));
 
       typedef typename std::unique_ptr<CompositeIterator<Ctype, CresultData>>
         TstrategyPtr;
@@ -116,32 +119,37 @@ namespace optimize
       if (EiteratorType::ForwardIter == iter_type)
       {
         return TstrategyPtr(new ForwardIterator<Ctype, CresultData>(
-              grid_comp, std::move(mode)));
+              grid_comp, mode));
       } else
       if (EiteratorType::ForwardNodeIter == iter_type)
       {
         return TstrategyPtr(new ForwardNodeIterator<Ctype, CresultData>(
-              grid_comp, std::move(mode)));
+              grid_comp, mode));
       } else
       if (EiteratorType::ForwardGridIter == iter_type)
       {
         return TstrategyPtr(new ForwardGridIterator<Ctype, CresultData>(
-              grid_comp, std::move(mode)));
+              grid_comp, mode));
       } else
       if (EiteratorType::ReverseIter == iter_type)
       {
         return TstrategyPtr(new ReverseIterator<Ctype, CresultData>(
-              grid_comp, std::move(mode)));
+              grid_comp, mode));
       } else
       if (EiteratorType::ReverseNodeIter == iter_type)
       {
         return TstrategyPtr(new ReverseNodeIterator<Ctype, CresultData>(
-              grid_comp, std::move(mode)));
+              grid_comp, mode));
       } else
       if (EiteratorType::ReverseGridIter == iter_type)
       {
         return TstrategyPtr(new ReverseGridIterator<Ctype, CresultData>(
-              grid_comp, std::move(mode)));
+              grid_comp, mode));
+      } else
+      if (EiteratorType::RandomAccessNodeIter == iter_type)
+      {
+        return TstrategyPtr(new RandomAccessNodeIterator<Ctype, CresultData>(
+              grid_comp, mode));
       } else
       {
         return TstrategyPtr(new NullIterator<Ctype, CresultData>(grid_comp));
@@ -151,18 +159,16 @@ namespace optimize
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
-    std::unique_ptr<IterationMemento<Ctype, CresultData>>
+    IterationMemento<Ctype, CresultData>
     IteratorStrategyFactory<Ctype, CresultData>::makeIterationMemento(
         EiterationMode iter_mode)
     {
       if (EiterationMode::PreOrder == iter_mode)
       {
-        return std::unique_ptr<PreIterationMemento<Ctype, CresultData>>(
-            new PreIterationMemento<Ctype, CresultData>);
+        return PreIterationMemento<Ctype, CresultData>();
       } else
       {
-        return std::unique_ptr<PostIterationMemento<Ctype, CresultData>>(
-            new PostIterationMemento<Ctype, CresultData>);
+        return PostIterationMemento<Ctype, CresultData>();
       }
     } // function IteratorStrategyFactory<Ctype, CresultData>::
     //makeIterationMemento
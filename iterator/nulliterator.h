@@ -30,6 +30,7 @@
  * 
  * REVISIONS and CHANGES 
  * 12/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free copies.
  * 
  * ============================================================================
  */
@@ -61,6 +62,7 @@ namespace optimize
           CompositeIterator<Ctype, CresultData>::Tcomp_ptr Tcomp_ptr;
         typedef typename 
           CompositeIterator<Ctype, CresultData>::TstrategyPtr TstrategyPtr;
+        typedef CompositeIterator<Ctype, CresultData> Tbase;
 
       public:
         //! constructor
@@ -94,6 +96,11 @@ namespace optimize
         {
           return TstrategyPtr(new NullIterator(*this));
         }
+        //! copy the iterator strategy into memory provided by the caller
+        virtual Tbase* clone(void* memory, size_t const size) const
+        {
+          return Tbase::cloneAt(*this, memory, size);
+        }
 
       private:
         //! shared pointer to the component the pointer is pointing to
@@ -0,0 +1,199 @@
+/*! \file randomaccessnodeiterator.h
+ * \brief Declaration of a class template for a random access node iterator
+ * strategy.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Declaration of a class template for a random access node iterator
+ * strategy.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free copies.
+ * 
+ * ============================================================================
+ */
+
+#include <memory>
+#include <vector>
+#include <optimizexx/iterator/compositeiterator.h>
+#include <optimizexx/iterator/forwardnodeiterator.h>
+#include <optimizexx/error.h>
+ 
+#ifndef _OPTIMIZEXX_RANDOMACCESSNODEITERATOR_H_
+#define _OPTIMIZEXX_RANDOMACCESSNODEITERATOR_H_
+
+namespace optimize
+{
+  
+  namespace iterator
+  {
+
+    // forward declarations
+    template <typename Ctype, typename CresultData> class IterationMemento;
+
+    /* ===================================================================== */
+    /*!
+     * Iterator to traverse the nodes of the parameter space providing random
+     * access in constant time.\n
+     *
+     * When constructed the iterator collects the nodes of the parameter space
+     * once in the order a ForwardNodeIterator would visit them. Copies of the
+     * iterator share this node index so that copying the iterator is cheap.
+     * Afterwards advancing the iterator and computing distances is done in
+     * constant time.
+     *
+     * \note The node index is not updated if the parameter space is modified.
+     * Create a new iterator after adding or removing grid components.
+     *
+     * \ingroup group_iterator
+     */
+    template <typename Ctype, typename CresultData>
+    class RandomAccessNodeIterator : public CompositeIterator<Ctype, CresultData>
+    {
+      public: 
+        typedef CompositeIterator<Ctype, CresultData> Tbase;
+        typedef typename Tbase::Tcomp_ptr Tcomp_ptr;
+        typedef typename Tbase::TstrategyPtr TstrategyPtr;
+        //! typedef for the node index
+        typedef typename std::vector<Tcomp_ptr> Tnodes;
+
+      public:
+        /*!
+         * constructor
+         *
+         * \param root Pointer to the root grid component.
+         * \param iter_mode mode of iteration used to collect the nodes
+         */
+        RandomAccessNodeIterator(Tcomp_ptr root,
+            IterationMemento<Ctype, CresultData> const& iter_mode);
+        //! destructor
+        virtual ~RandomAccessNodeIterator() { }
+        //! set iterator to first node in parameter space composite (grid)
+        virtual void first() { Mpos = 0; }
+        //! set iterator to last node in parameter space composite (grid)
+        virtual void back() { Mpos = Mnodes->empty() ? 0 : Mnodes->size()-1; }
+        //! go to the next node
+        virtual void next() { if (! isDone()) { ++Mpos; } }
+        //! query function if iteration is finished
+        virtual bool isDone() const { return Mpos >= Mnodes->size(); }
+        //! query function for current node
+        virtual Tcomp_ptr currentItem() const
+        {
+          OPTIMIZE_assert(! isDone(), "Iteration is finished.");
+          return (*Mnodes)[Mpos];
+        }
+        /*!
+         * Compare the position of two iterator strategies.
+         *
+         * \param rhs iterator strategy to compare with
+         * \return if both iterators point to the same node
+         */
+        virtual bool equals(Tbase const& rhs) const;
+        //! query function if the strategy provides random access
+        virtual bool isRandomAccess() const { return true; }
+        /*!
+         * Advance the iterator by \c n nodes in constant time.
+         *
+         * \param n number of nodes to be advanced
+         */
+        virtual void advance(size_t const n);
+        //! query function for the position of the current node
+        virtual size_t getPosition() const
+        {
+          return isDone() ? Mnodes->size() : Mpos;
+        }
+        //! query function for the number of nodes
+        virtual size_t getSize() const { return Mnodes->size(); }
+        /*! 
+         * perform deep copy of an iterator strategy\n
+         * Notice that here the
+         * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
+         * Virtual_Constructor"> Virtual Constructor idiom</a> had been
+         * applied.
+         *
+         * \return unique pointer to the deep copy of iterator strategy
+         */
+        virtual TstrategyPtr clone() const
+        {
+          return TstrategyPtr(new RandomAccessNodeIterator(*this));
+        }
+        //! copy the iterator strategy into memory provided by the caller
+        virtual Tbase* clone(void* memory, size_t const size) const
+        {
+          return Tbase::cloneAt(*this, memory, size);
+        }
+
+      private:
+        //! node index shared by copies of the iterator
+        std::shared_ptr<Tnodes const> Mnodes;
+        //! position of the current node
+        size_t Mpos;
+
+    }; // class template RandomAccessNodeIterator
+
+    /* ===================================================================== */
+    template <typename Ctype, typename CresultData>
+    RandomAccessNodeIterator<Ctype, CresultData>::RandomAccessNodeIterator(
+        Tcomp_ptr root,
+        IterationMemento<Ctype, CresultData> const& iter_mode) : Mpos(0)
+    {
+      std::shared_ptr<Tnodes> nodes(new Tnodes);
+      ForwardNodeIterator<Ctype, CresultData> iter(root, iter_mode);
+      for (iter.first(); ! iter.isDone(); iter.next())
+      {
+        nodes->push_back(iter.currentItem());
+      }
+      Mnodes = nodes;
+    } // constructor RandomAccessNodeIterator<Ctype, CresultData>
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    bool RandomAccessNodeIterator<Ctype, CresultData>::equals(
+        Tbase const& rhs) const
+    {
+      if (isDone() || rhs.isDone()) { return isDone() == rhs.isDone(); }
+      return currentItem() == rhs.currentItem();
+    } // function RandomAccessNodeIterator<Ctype, CresultData>::equals
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void RandomAccessNodeIterator<Ctype, CresultData>::advance(size_t const n)
+    {
+      if (isDone()) { return; }
+      size_t const last = Mnodes->size()-1;
+      Mpos = n < last-Mpos ? Mpos+n : last;
+    } // function RandomAccessNodeIterator<Ctype, CresultData>::advance
+
+    /* --------------------------------------------------------------------- */
+
+  } // namespace iterator
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF randomaccessnodeiterator.h  ----- */
@@ -32,28 +32,25 @@
  * 
  * REVISIONS and CHANGES 
  * 12/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free iteration.
  * 
  * ============================================================================
  */
- 
-#include <memory>
+
 #include <optimizexx/iterator/reverseiterator.h>
 #include <optimizexx/error.h>
-
+ 
 #ifndef _OPTIMIZEXX_REVERSEGRIDITERATOR_H_
 #define _OPTIMIZEXX_REVERSEGRIDITERATOR_H_
 
 namespace optimize
 {
-
+  
   namespace iterator
   {
 
     // forward declarations
     template <typename Ctype, typename CresultData> class IterationMemento;
-    template <typename Ctype, typename CresultData> class
-      ReverseIterationState;
-    template <typename Ctype, typename CresultData> class ForwardGridIterator;
 
     /* ===================================================================== */
     /*!
@@ -76,121 +73,43 @@ namespace optimize
       public:
         //! constructor
         ReverseGridIterator(Tcomp_ptr root,
-            typename std::unique_ptr<IterationMemento<Ctype, CresultData>>
-            iter_mode_ptr) : Tbase(root, std::move(iter_mode_ptr))
-        { }
-        /*!
-         * copy constructor
-         * 
-         * \param rhs argument to copy
-         */
-        ReverseGridIterator(ReverseGridIterator<Ctype, CresultData> const& rhs)
-          : Tbase(rhs)
+            IterationMemento<Ctype, CresultData> const& iter_mode) :
+          Tbase(root, iter_mode)
         { }
         //! destructor
         virtual ~ReverseGridIterator() { }
-        //! set iterator to last grid in parameter space composite (grid)
-        virtual void first();
-        //! set iterator to first grid in parameter space composite (grid)
-        virtual void back();
-        //! go to the next grid
-        virtual void next();
-        //! query function if iteration is finished
-        virtual bool isDone() const { return Tbase::MisDone; }
-        //! query function for current grid
-        virtual Tcomp_ptr currentItem() const
-        {
-          return *Tbase::MiterMemento->getCurrentIterator();
-        }
         /*! 
-         * perform deep copy of an referse grid iterator strategy\n
+         * perform deep copy of an iterator strategy\n
          * Notice that here the
          * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
          * Virtual_Constructor"> Virtual Constructor idiom</a> had been
          * applied.
          *
-         * \return unique pointer to the deep copy of the iterator strategy
+         * \return unique pointer to the deep copy of iterator strategy
          */
         virtual TstrategyPtr clone() const
         {
           return TstrategyPtr(new ReverseGridIterator(*this));
         }
-
-    }; // class template ReverseGridIterator
-
-    /* ===================================================================== */
-    template <typename Ctype, typename CresultData>
-    void ReverseGridIterator<Ctype, CresultData>::first()
-    {
-      Tbase::MiterMemento->reset();
-      if (Tbase::Mcomponent->rbegin() != Tbase::Mcomponent->rend())
-      {
-        Tbase::MisDone = false;
-        typename std::unique_ptr<IterationState<Ctype, CresultData>> state(
-          new ReverseIterationState<Ctype, CresultData>(
-          Tbase::Mcomponent->rbegin(), Tbase::Mcomponent->rend()));
-        Tbase::MiterMemento->pushState(std::move(state));
-        next();
-      } else
-      {
-        Tbase::MisDone = true;
-      }
-    } // function ReverseGridIterator<Ctype, CresultData>::first
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
-    void ReverseGridIterator<Ctype, CresultData>::back()
-    {
-      // not really efficiant but must be done as follows to guarantee
-      // correct behaviour both for pre- and post-order iterators
-      first();
-
-      ForwardGridIterator<Ctype, CresultData> iter(Tbase::Mcomponent,
-          std::move(Tbase::MiterMemento->create()));
-      iter.first();
-
-      while (! Tbase::MisDone && iter.currentItem() != currentItem())
-      { 
-        next();
-      }
-    } // function ReverseGridIterator<Ctype, CresultData>::back
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
-    void ReverseGridIterator<Ctype, CresultData>::next()
-    {
-      if (! (*Tbase::MiterMemento->getCurrentIterator())->createIterator(
-            ReverseGridIter).isDone())
-      {
-        Tcomp_ptr comp_ptr = *Tbase::MiterMemento->getCurrentIterator();
-        typename std::unique_ptr<IterationState<Ctype, CresultData>> state(
-          new ReverseIterationState<Ctype, CresultData>(
-          comp_ptr->rbegin(), comp_ptr->rend()));
-        Tbase::MiterMemento->pushState(std::move(state));
-      } else
-      {
-        Tbase::MiterMemento->next();
-          
-        while (! Tbase::MiterMemento->empty() && 
-            Tbase::MiterMemento->iterationStateIsEnd())
+        //! copy the iterator strategy into memory provided by the caller
+        virtual CompositeIterator<Ctype, CresultData>* clone(void* memory,
+            size_t const size) const
         {
-          Tbase::MiterMemento->popState();
-          if (! Tbase::MiterMemento->empty()) { Tbase::MiterMemento->next(); }
+          return CompositeIterator<Ctype, CresultData>::cloneAt(*this,
+              memory, size);
         }
-        if (Tbase::MiterMemento->empty())
+
+      protected:
+        //! only grids are items of the iteration
+        virtual bool isItem(Tcomp_ptr comp) const
         {
-          Tbase::MisDone = true;
+          return GridComponent<Ctype, CresultData>::Composite ==
+            comp->getComponentType();
         }
-      }
-      while (!Tbase::MisDone && 
-          (*Tbase::MiterMemento->getCurrentIterator())->getComponentType() !=
-          GridComponent<Ctype, CresultData>::Composite)
-      {
-        Tbase::MiterMemento->next();
-      }
-    } // function ReverseGridIterator<Ctype, CresultData>::next
 
-    /* --------------------------------------------------------------------- */
+    }; // class template ReverseGridIterator
+
+    /* ===================================================================== */
 
   } // namespace iterator
 
@@ -30,6 +30,8 @@
  * 
  * REVISIONS and CHANGES 
  * 01/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free iteration by means of a value semantic
+ *                   memento.
  * 
  * ============================================================================
  */
@@ -51,7 +53,14 @@ namespace optimize
     /* ===================================================================== */
     /*!
      * Iterator to traverse backwards the entire parameter space including
-     * grids and nodes (post- and pre-ordered depending an).
+     * grids and nodes (post- and pre-ordered depending on
+     * optimizexx::iterator::IterationMemento).\n
+     *
+     * Note, that here the Strategy design pattern is in use (GoF p.315).
+     * The iteration state is captured by a value semantic
+     * optimize::iterator::IterationMemento so that copying and advancing
+     * the iterator do not allocate any memory. Derived strategies restrict
+     * the iteration to certain grid components by overriding isItem().
      *
      * \ingroup group_iterator
      */
@@ -68,24 +77,17 @@ namespace optimize
          * constructor
          *
          * \param root Pointer to the composite creating the iterator.
-         * \param type Type of the iteration.
+         * \param iter_mode Mode/memento of the iteration.
          */
         ReverseIterator(Tcomp_ptr root,
-            typename std::unique_ptr<IterationMemento<Ctype, CresultData>>
-            iter_mode_ptr) : Mcomponent(root), MisDone(false),
-            MiterMemento(std::move(iter_mode_ptr))
+            IterationMemento<Ctype, CresultData> const& iter_mode) :
+            Mcomponent(root), MisDone(true), MiterMemento(iter_mode)
         { }
-        /*!
-         * copy constructor
-         * 
-         * \param rhs argument to copy
-         */
-        ReverseIterator(ReverseIterator<Ctype, CresultData> const& rhs);
         //! destructor
         virtual ~ReverseIterator() { }
-        //! set iterator to last element in parameter space composite (grid)
-        virtual void first();
         //! set iterator to first element in parameter space composite (grid)
+        virtual void first();
+        //! set iterator to last element in parameter space composite (grid)
         virtual void back();
         //! go to the next item
         virtual void next();
@@ -94,21 +96,37 @@ namespace optimize
         //! query function for current item
         virtual Tcomp_ptr currentItem() const
         {
-          return *MiterMemento->getCurrentIterator();
+          return *MiterMemento.getCurrentIterator();
         }
         /*! 
-         * perform deep copy of an reverse iterator strategy\n
+         * perform deep copy of an iterator strategy\n
          * Notice that here the
          * <a href="http://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/
          * Virtual_Constructor"> Virtual Constructor idiom</a> had been
          * applied.
          *
-         * \return unique pointer to the deep copy of the iterator strategy
+         * \return unique pointer to the deep copy of iterator strategy
          */
         virtual TstrategyPtr clone() const
         {
           return TstrategyPtr(new ReverseIterator(*this));
         }
+        //! copy the iterator strategy into memory provided by the caller
+        virtual Tbase* clone(void* memory, size_t const size) const
+        {
+          return Tbase::cloneAt(*this, memory, size);
+        }
+
+      protected:
+        /*!
+         * query function if the iteration stops at a grid component
+         *
+         * \param comp grid component
+         * \return \c true by default - all grid components are visited
+         */
+        virtual bool isItem(Tcomp_ptr comp) const { return true; }
+        //! skip grid components which are not items of the iteration
+        void skip();
 
       protected:
         //! pointer to the root element of the iteration
@@ -117,45 +135,20 @@ namespace optimize
         bool MisDone;
         /*!
          * As suggested at GoF p.271 here the memento design pattern is in use
-         * to capture the state of an iteration within a IteratorMemento. The
+         * to capture the state of an iteration within a IterationMemento. The
          * iterator stores the memento internally. The functionalism of pre- or
          * rather post-order iteration is delegated to the memento.
          */
-        std::unique_ptr<IterationMemento<Ctype, CresultData>> MiterMemento;
+        IterationMemento<Ctype, CresultData> MiterMemento;
 
     }; // class template ReverseIterator
 
     /* ===================================================================== */
     template <typename Ctype, typename CresultData>
-    ReverseIterator<Ctype, CresultData>::ReverseIterator(
-        ReverseIterator<Ctype, CresultData> const& rhs) :
-      Mcomponent(rhs.Mcomponent), MisDone(rhs.MisDone),
-#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
-      MiterMemento(nullptr)
-#else
-      MiterMemento(0)
-#endif
-    {
-      // copy of iteration memento is a deep copy
-      this->MiterMemento = rhs.MiterMemento->clone();
-    } // copy constructor
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
     void ReverseIterator<Ctype, CresultData>::first()
     {
-      MiterMemento->reset();
-      if (Mcomponent->rbegin() != Mcomponent->rend())
-      {
-        MisDone = false;
-        typename std::unique_ptr<IterationState<Ctype, CresultData>> state(
-          new ReverseIterationState<Ctype, CresultData>(
-          Mcomponent->rbegin(), Mcomponent->rend()));
-        MiterMemento->pushState(std::move(state));
-      } else
-      {
-        MisDone = true;
-      }
+      MiterMemento.first(Mcomponent, true);
+      skip();
     } // function ReverseIterator<Ctype, CresultData>::first
 
     /* --------------------------------------------------------------------- */
@@ -163,60 +156,38 @@ namespace optimize
     void ReverseIterator<Ctype, CresultData>::back()
     {
       // not really effective but must be done as follows to guarantee
-      // correct behaviour both for pre- and post-order iterators
+      // correct behaviour both for pre- and post-order iterators - copying
+      // the memento does not allocate any memory
       first();
+      if (MisDone) { return; }
 
-      if (! MisDone)
+      IterationMemento<Ctype, CresultData> last(MiterMemento);
+      for (next(); ! MisDone; next())
       {
-        while (true)
-        {
-          if (! (*MiterMemento->getCurrentIterator())->createIterator(
-                ReverseIter).isDone())
-          {
-            Tcomp_ptr comp_ptr = *MiterMemento->getCurrentIterator();
-            typename std::unique_ptr<ForwardIterationState<Ctype, CresultData>>
-              state(new ForwardIterationState<Ctype, CresultData>(
-              comp_ptr->begin(), comp_ptr->end()));
-            MiterMemento->pushState(std::move(state));
-          } else
-          {
-            MiterMemento->next();
-            while (! MiterMemento->iterationIsBack() &&
-                MiterMemento->iterationStateIsEnd())
-            {
-              MiterMemento->popState();
-              if (! MiterMemento->iterationIsBack()) { MiterMemento->next(); }
-            }
-            if (MiterMemento->iterationIsBack()) { break; }
-          }
-        }
+        last = MiterMemento;
       }
-    } // function ForwardIterator<Ctype, CresultData>::back
+      MiterMemento = last;
+      MisDone = false;
+    } // function ReverseIterator<Ctype, CresultData>::back
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
     void ReverseIterator<Ctype, CresultData>::next()
     {
-      if (! (*MiterMemento->getCurrentIterator())->createIterator(
-            ReverseIter).isDone())
-      {
-        Tcomp_ptr comp_ptr = *MiterMemento->getCurrentIterator();
-        typename std::unique_ptr<IterationState<Ctype, CresultData>> state(
-          new ReverseIterationState<Ctype, CresultData>(
-          comp_ptr->rbegin(), comp_ptr->rend()));
-        MiterMemento->pushState(std::move(state));
-      } else
+      MiterMemento.next();
+      skip();
+    } // function ReverseIterator<Ctype, CresultData>::next
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ReverseIterator<Ctype, CresultData>::skip()
+    {
+      while (! MiterMemento.empty() && ! isItem(currentItem()))
       {
-        MiterMemento->next();
-          
-        while (! MiterMemento->empty() && MiterMemento->iterationStateIsEnd())
-        {
-          MiterMemento->popState();
-          if (! MiterMemento->empty()) { MiterMemento->next(); }
-        }
-        if (MiterMemento->empty()) { MisDone = true; }
+        MiterMemento.next();
       }
-    } // function ReverseIterator<Ctype, CresultData>::next
+      MisDone = MiterMemento.empty();
+    } // function ReverseIterator<Ctype, CresultData>::skip
 
     /* --------------------------------------------------------------------- */
 
@@ -226,5 +197,4 @@ namespace optimize
 
 #endif // include guard
 
-
 /* ----- END OF reverseiterator.h  ----- */
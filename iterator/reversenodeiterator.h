@@ -32,11 +32,11 @@
  * 
  * REVISIONS and CHANGES 
  * 12/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Allocation free iteration.
  * 
  * ============================================================================
  */
 
-#include <memory>
 #include <optimizexx/iterator/reverseiterator.h>
 #include <optimizexx/error.h>
  
@@ -45,14 +45,12 @@
 
 namespace optimize
 {
-
+  
   namespace iterator
   {
+
     // forward declarations
     template <typename Ctype, typename CresultData> class IterationMemento;
-    template <typename Ctype, typename CresultData> class
-      ReverseIterationState;
-    template <typename Ctype, typename CresultData> class ForwardNodeIterator;
 
     /* ===================================================================== */
     /*!
@@ -72,32 +70,11 @@ namespace optimize
       public:
         //! constructor
         ReverseNodeIterator(Tcomp_ptr root,
-            typename std::unique_ptr<IterationMemento<Ctype, CresultData>>
-            iter_mode_ptr) : Tbase(root, std::move(iter_mode_ptr))
-        { }
-        /*!
-         * copy constructor
-         * 
-         * \param rhs argument to copy
-         */
-        ReverseNodeIterator(ReverseNodeIterator<Ctype, CresultData> const& rhs)
-          : Tbase(rhs)
+            IterationMemento<Ctype, CresultData> const& iter_mode) :
+          Tbase(root, iter_mode)
         { }
         //! destructor
         virtual ~ReverseNodeIterator() { }
-        //! set iterator to first node in parameter space composite (grid)
-        virtual void first();
-        //! set iterator to first node in parameter space composite (grid)
-        virtual void back();
-        //! go to the next node
-        virtual void next();
-        //! query function if iteration is finished
-        virtual bool isDone() const { return Tbase::MisDone; }
-        //! query function for current node
-        virtual Tcomp_ptr currentItem() const
-        {
-          return *Tbase::MiterMemento->getCurrentIterator();
-        }
         /*! 
          * perform deep copy of an iterator strategy\n
          * Notice that here the
@@ -111,89 +88,25 @@ namespace optimize
         {
           return TstrategyPtr(new ReverseNodeIterator(*this));
         }
-
-    }; // class template ReverseNodeIterator
-
-    /* ===================================================================== */
-    template <typename Ctype, typename CresultData>
-    void ReverseNodeIterator<Ctype, CresultData>::first()
-    {
-      Tbase::MiterMemento->reset();
-      if (Tbase::Mcomponent->rbegin() != Tbase::Mcomponent->rend())
-      {
-        Tbase::MisDone = false;
-        typename std::unique_ptr<IterationState<Ctype, CresultData>> state(
-          new ReverseIterationState<Ctype, CresultData>(
-          Tbase::Mcomponent->rbegin(), Tbase::Mcomponent->rend()));
-        Tbase::MiterMemento->pushState(std::move(state));
-        while (!Tbase::MisDone && 
-            (*Tbase::MiterMemento->getCurrentIterator())->getComponentType() !=
-            GridComponent<Ctype, CresultData>::Leaf)
-        {
-          next();
-        }
-      } else
-      {
-        Tbase::MisDone = true;
-      }
-    } // function ReverseNodeIterator<Ctype, CresultData>::first
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
-    void ReverseNodeIterator<Ctype, CresultData>::back()
-    {
-      // not really efficiant but must be done as follows to guarantee
-      // correct behaviour both for pre- and post-order iterators
-      first();
-
-      ForwardNodeIterator<Ctype, CresultData> iter(Tbase::Mcomponent,
-          std::move(Tbase::MiterMemento->create()));
-      iter.first();
-
-      while (! Tbase::MisDone && iter.currentItem() != currentItem())
-      { 
-        next();
-      }
-    } // function ReverseNodeIterator<Ctype, CresultData>::back
-
-    /* --------------------------------------------------------------------- */
-    template <typename Ctype, typename CresultData>
-    void ReverseNodeIterator<Ctype, CresultData>::next()
-    {
-      if (! (*Tbase::MiterMemento->getCurrentIterator())->createIterator(
-            ReverseNodeIter).isDone())
-      {
-        Tcomp_ptr comp_ptr = *Tbase::MiterMemento->getCurrentIterator();
-        typename std::unique_ptr<IterationState<Ctype, CresultData>> state(
-          new ReverseIterationState<Ctype, CresultData>(
-         comp_ptr->rbegin(), comp_ptr->rend()));
-        Tbase::MiterMemento->pushState(std::move(state));
-      } else
-      {
-        Tbase::MiterMemento->next();
-          
-        while (! Tbase::MiterMemento->empty() && 
-            Tbase::MiterMemento->iterationStateIsEnd())
+        //! copy the iterator strategy into memory provided by the caller
+        virtual CompositeIterator<Ctype, CresultData>* clone(void* memory,
+            size_t const size) const
         {
-          Tbase::MiterMemento->popState();
-          if (! Tbase::MiterMemento->empty()) { Tbase::MiterMemento->next(); }
+          return CompositeIterator<Ctype, CresultData>::cloneAt(*this,
+              memory, size);
         }
 
-        if (Tbase::MiterMemento->empty())
+      protected:
+        //! only nodes are items of the iteration
+        virtual bool isItem(Tcomp_ptr comp) const
         {
-          Tbase::MisDone = true;
+          return GridComponent<Ctype, CresultData>::Leaf ==
+            comp->getComponentType();
         }
-      }
 
-      while (!Tbase::MisDone && 
-          (*Tbase::MiterMemento->getCurrentIterator())->getComponentType() !=
-          GridComponent<Ctype, CresultData>::Leaf)
-      {
-        Tbase::MiterMemento->next();
-      }
-    } // function ReverseNodeIterator<Ctype, CresultData>:next
+    }; // class template ReverseNodeIterator
 
-    /* --------------------------------------------------------------------- */
+    /* ===================================================================== */
 
   } // namespace iterator
 
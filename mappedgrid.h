@@ -0,0 +1,199 @@
+/*! \file mappedgrid.h
+ * \brief Read-only parameter space grid mapped from a binary file.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Read-only parameter space grid mapped from a binary file.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <optimizexx/indexedgrid.h>
+#include <optimizexx/binaryio.h>
+#include <optimizexx/parameter.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_MAPPEDGRID_H_
+#define _OPTIMIZEXX_MAPPEDGRID_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Read-only parameter space grid mapped from a file in binary format (see
+   * optimize::BinaryFormat).\n
+   *
+   * The columns of the file are mapped into memory read-only so that opening
+   * the grid neither runs a builder nor copies any data. Pages are loaded on
+   * demand by the operating system when the grid points are visited.\n
+   *
+   * \note Since the grid is read-only setting result data or computed flags
+   * is illegal. Use the grid for post-processing results only.
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData>
+  class MappedGrid : public IndexedGrid<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef IndexedGrid<Ctype, CresultData> Tbase; 
+      //! typedef for coordinates
+      typedef typename Tbase::Tcoordinates Tcoordinates;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param filename name of a file in binary format
+       */
+      MappedGrid(std::string const& filename);
+      //! destructor
+      virtual ~MappedGrid() { }
+      //! query function for the number of grid points
+      virtual size_t size() const { return Minfo.MnumPoints; }
+      //! query function for the number of dimensions
+      virtual size_t getDimensions() const { return Mcolumns.size(); }
+      /*!
+       * Query the coordinates of a grid point.
+       *
+       * \param index linear index of the grid point
+       * \param coordinates vector the coordinates are written to
+       */
+      virtual void getCoordinatesAt(size_t const index,
+          Tcoordinates& coordinates) const;
+      //! query function for the result data of a grid point
+      virtual CresultData getResultDataAt(size_t const index) const
+      {
+        OPTIMIZE_assert(index < size(), "Index out of range.");
+        return Mresults[index];
+      }
+      //! Setting result data of a read-only grid is illegal.
+      virtual void setResultDataAt(size_t const index,
+          CresultData const& data) { OPTIMIZE_illegal; }
+      //! query function if the grid point had been computed
+      virtual bool isComputedAt(size_t const index) const
+      {
+        OPTIMIZE_assert(index < size(), "Index out of range.");
+        return MisComputed[index];
+      }
+      //! Setting computed flags of a read-only grid is illegal.
+      virtual void setComputedAt(size_t const index) { OPTIMIZE_illegal; }
+      /*!
+       * query function for a coordinate column
+       *
+       * \param dim dimension of the column
+       * \return pointer to the coordinates of all grid points in this
+       * dimension
+       */
+      Ctype const* getColumn(size_t const dim) const
+      {
+        OPTIMIZE_assert(dim < Mcolumns.size(), "Illegal dimension.");
+        return Mcolumns[dim];
+      }
+      //! query function for the result column
+      CresultData const* getResultColumn() const { return Mresults; }
+      //! query function for the parameters the grid had been built of
+      std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+        getParameters() const { return Minfo.Mparameters; }
+
+    private:
+      //! header information of the file
+      BinaryGridInfo<Ctype> Minfo;
+      //! mapping of the file
+      boost::interprocess::file_mapping Mfile;
+      //! mapped memory region
+      boost::interprocess::mapped_region Mregion;
+      //! coordinate columns - one for each dimension
+      std::vector<Ctype const*> Mcolumns;
+      //! result column
+      CresultData const* Mresults;
+      //! computed flags of the grid points
+      char const* MisComputed;
+
+  }; // class template MappedGrid
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  MappedGrid<Ctype, CresultData>::MappedGrid(std::string const& filename) :
+    Mresults(0), MisComputed(0)
+  {
+    typedef BinaryFormat<Ctype, CresultData> Tformat;
+    {
+      std::ifstream ifs(filename.c_str(), std::ios::binary);
+      OPTIMIZE_assert(ifs.good(), "Unable to open binary parameter space.");
+      Minfo = Tformat::readHeader(ifs);
+    }
+
+    Mfile = boost::interprocess::file_mapping(filename.c_str(),
+        boost::interprocess::read_only);
+    Mregion = boost::interprocess::mapped_region(Mfile,
+        boost::interprocess::read_only);
+    OPTIMIZE_assert(Mregion.get_size() >= Tformat::getSize(Minfo),
+        "Corrupt binary parameter space.");
+
+    char const* data = static_cast<char const*>(Mregion.get_address());
+    for (size_t d = 0; d < Minfo.Mparameters.size(); ++d)
+    {
+      Mcolumns.push_back(reinterpret_cast<Ctype const*>(
+            data + Tformat::getColumnOffset(Minfo, d)));
+    }
+    Mresults = reinterpret_cast<CresultData const*>(
+        data + Tformat::getResultOffset(Minfo));
+    MisComputed = data + Tformat::getComputedOffset(Minfo);
+    Tbase::setCoordinateId(Minfo.McoordinateIds);
+  } // function MappedGrid<Ctype, CresultData>::MappedGrid
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void MappedGrid<Ctype, CresultData>::getCoordinatesAt(size_t const index,
+      Tcoordinates& coordinates) const
+  {
+    OPTIMIZE_assert(index < size(), "Index out of range.");
+    coordinates.resize(Mcolumns.size());
+    for (size_t d = 0; d < Mcolumns.size(); ++d)
+    {
+      coordinates[d] = Mcolumns[d][index];
+    }
+  } // function MappedGrid<Ctype, CresultData>::getCoordinatesAt
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF mappedgrid.h  ----- */
@@ -0,0 +1,344 @@
+/*! \file mpiexecutor.h
+ * \brief Distributed execution of global algorithms by means of MPI.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Distributed execution of global algorithms by means of MPI.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <mpi.h>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <limits>
+#include <type_traits>
+#include <optimizexx/globalalgorithm.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+#include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/binaryio.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_MPIEXECUTOR_H_
+#define _OPTIMIZEXX_MPIEXECUTOR_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Executor of global algorithms distributing the computation to the ranks
+   * of an MPI communicator.\n
+   *
+   * Every rank constructs the entire parameter space. The node index space
+   * (see optimize::GlobalAlgorithm::setPartition) is divided into one
+   * partition per rank and each rank computes its partition with the local
+   * thread pool of the algorithm. Applications remain unchanged. Afterwards
+   * the results are either gathered to the root rank (gather()) or written
+   * collectively to a file in optimize::BinaryFormat (write()).\n
+   *
+   * \note MPI must have been initialized (\c MPI_Init) before creating an
+   * executor and is finalized by the user. Result data must be plain old
+   * data since it is transferred bytewise.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class MPIExecutor
+  {
+    static_assert(std::is_pod<CresultData>::value,
+        "MPIExecutor requires plain old data.");
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param comm communicator of the ranks taking part in the computation
+       * \param root rank results are gathered to
+       */
+      MPIExecutor(MPI_Comm comm=MPI_COMM_WORLD, int root=0);
+      //! destructor
+      ~MPIExecutor();
+      /*!
+       * Compute the partition of the calling rank.
+       *
+       * \param algorithm global algorithm whose parameter space had been
+       * constructed already
+       * \param v application
+       */
+      void execute(GlobalAlgorithm<Ctype, CresultData>& algorithm,
+          ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * Compute the partition of the calling rank. The seed of the root rank
+       * is used by all ranks so that all ranks draw the same samples.
+       *
+       * \param algorithm Monte Carlo algorithm whose parameter space had been
+       * constructed already
+       * \param v application
+       */
+      void execute(MonteCarlo<Ctype, CresultData>& algorithm,
+          ParameterSpaceVisitor<Ctype, CresultData>& v);
+      /*!
+       * Gather the results (and computed flags) of all partitions to the
+       * parameter space of the root rank. Collective operation.
+       *
+       * \param algorithm global algorithm executed before
+       */
+      void gather(GlobalAlgorithm<Ctype, CresultData> const& algorithm);
+      /*!
+       * Write the parameter space in binary format (see
+       * optimize::BinaryFormat). The root rank writes the header and the
+       * coordinates. Afterwards each rank writes the results of its
+       * partition by means of MPI-IO. Collective operation.
+       *
+       * \param filename name of the file (on a file system shared by all
+       * ranks)
+       * \param algorithm global algorithm executed before
+       */
+      void write(std::string const& filename,
+          GlobalAlgorithm<Ctype, CresultData> const& algorithm);
+      //! query function for the rank of the calling process
+      int getRank() const { return Mrank; }
+      //! query function for the number of ranks
+      int getSize() const { return Msize; }
+      //! query function for the root rank
+      int getRoot() const { return Mroot; }
+
+    private:
+      //! not copyable
+      MPIExecutor(MPIExecutor const&);
+      //! not assignable
+      MPIExecutor& operator=(MPIExecutor const&);
+      /*!
+       * Copy the results and computed flags of the partition of the calling
+       * rank into buffers.
+       *
+       * \param algorithm global algorithm
+       * \param iter random access node iterator of the parameter space
+       * \param results buffer of the results
+       * \param computed buffer of the computed flags
+       * \return index of the first node of the partition
+       */
+      size_t pack(GlobalAlgorithm<Ctype, CresultData> const& algorithm,
+          Iterator<Ctype, CresultData>& iter,
+          std::vector<CresultData>& results, std::vector<char>& computed)
+        const;
+
+    private:
+      //! communicator
+      MPI_Comm Mcomm;
+      //! root rank
+      int Mroot;
+      //! rank of the calling process
+      int Mrank;
+      //! number of ranks
+      int Msize;
+      //! MPI type of the result data
+      MPI_Datatype MresultType;
+
+  }; // class template MPIExecutor
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  MPIExecutor<Ctype, CresultData>::MPIExecutor(MPI_Comm comm, int root) :
+    Mcomm(comm), Mroot(root), Mrank(0), Msize(1)
+  {
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    OPTIMIZE_assert(initialized, "MPI not initialized.");
+    MPI_Comm_rank(Mcomm, &Mrank);
+    MPI_Comm_size(Mcomm, &Msize);
+    OPTIMIZE_assert(0 <= Mroot && Mroot < Msize, "Illegal root rank.");
+    MPI_Type_contiguous(sizeof(CresultData), MPI_BYTE, &MresultType);
+    MPI_Type_commit(&MresultType);
+  } // constructor MPIExecutor<Ctype, CresultData>
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  MPIExecutor<Ctype, CresultData>::~MPIExecutor()
+  {
+    // the executor might outlive MPI
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (! finalized) { MPI_Type_free(&MresultType); }
+  } // destructor MPIExecutor<Ctype, CresultData>
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void MPIExecutor<Ctype, CresultData>::execute(
+      GlobalAlgorithm<Ctype, CresultData>& algorithm,
+      ParameterSpaceVisitor<Ctype, CresultData>& v)
+  {
+    algorithm.setPartition(Mrank, Msize);
+    algorithm.execute(v);
+  } // function MPIExecutor<Ctype, CresultData>::execute
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void MPIExecutor<Ctype, CresultData>::execute(
+      MonteCarlo<Ctype, CresultData>& algorithm,
+      ParameterSpaceVisitor<Ctype, CresultData>& v)
+  {
+    unsigned int seed = algorithm.getSeed();
+    MPI_Bcast(&seed, 1, MPI_UNSIGNED, Mroot, Mcomm);
+    algorithm.setSeed(seed);
+    execute(static_cast<GlobalAlgorithm<Ctype, CresultData>&>(algorithm), v);
+  } // function MPIExecutor<Ctype, CresultData>::execute
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  size_t MPIExecutor<Ctype, CresultData>::pack(
+      GlobalAlgorithm<Ctype, CresultData> const& algorithm,
+      Iterator<Ctype, CresultData>& iter, std::vector<CresultData>& results,
+      std::vector<char>& computed) const
+  {
+    OPTIMIZE_assert(
+        static_cast<size_t>(Mrank) == algorithm.getPartitionIndex() &&
+        static_cast<size_t>(Msize) == algorithm.getPartitionCount(),
+        "Algorithm not executed by this executor.");
+    size_t first = 0;
+    size_t last = 0;
+    algorithm.getPartitionRange(iter.getSize(), first, last);
+    OPTIMIZE_assert(last-first <=
+        static_cast<size_t>(std::numeric_limits<int>::max()),
+        "Partition too large.");
+
+    results.clear();
+    computed.clear();
+    results.reserve(last-first);
+    computed.reserve(last-first);
+    iter.first();
+    advance(iter, first);
+    for (size_t i = first; i < last; ++i, ++iter)
+    {
+      results.push_back((*iter)->getResultData());
+      computed.push_back((*iter)->isComputed());
+    }
+    return first;
+  } // function MPIExecutor<Ctype, CresultData>::pack
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void MPIExecutor<Ctype, CresultData>::gather(
+      GlobalAlgorithm<Ctype, CresultData> const& algorithm)
+  {
+    Iterator<Ctype, CresultData> iter(
+        algorithm.getParameterSpace().createIterator(RandomAccessNodeIter));
+    std::vector<CresultData> results;
+    std::vector<char> computed;
+    size_t const first = pack(algorithm, iter, results, computed);
+
+    // partitions are contiguous and ordered by rank
+    int count = results.size();
+    std::vector<int> counts(Mrank == Mroot ? Msize : 0);
+    MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, Mroot, Mcomm);
+    std::vector<int> displacements(counts.size(), 0);
+    for (size_t i = 1; i < counts.size(); ++i)
+    {
+      displacements[i] = displacements[i-1] + counts[i-1];
+    }
+    size_t const num = Mrank == Mroot ? iter.getSize() : 0;
+    std::vector<CresultData> all_results(num);
+    std::vector<char> all_computed(num);
+    MPI_Gatherv(results.data(), count, MresultType, all_results.data(),
+        counts.data(), displacements.data(), MresultType, Mroot, Mcomm);
+    MPI_Gatherv(computed.data(), count, MPI_CHAR, all_computed.data(),
+        counts.data(), displacements.data(), MPI_CHAR, Mroot, Mcomm);
+    if (Mrank != Mroot) { return; }
+
+    size_t const last = first + count;
+    size_t i = 0;
+    for (iter.first(); !iter.isDone(); ++iter, ++i)
+    {
+      // skip the partition of the root rank
+      if (first <= i && i < last) { continue; }
+      (*iter)->setResultData(all_results[i]);
+      if (all_computed[i]) { (*iter)->setComputed(); }
+    }
+  } // function MPIExecutor<Ctype, CresultData>::gather
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void MPIExecutor<Ctype, CresultData>::write(std::string const& filename,
+      GlobalAlgorithm<Ctype, CresultData> const& algorithm)
+  {
+    GridComponent<Ctype, CresultData> const& space =
+      algorithm.getParameterSpace();
+    int good = 1;
+    if (Mrank == Mroot)
+    {
+      std::ofstream os(filename.c_str(), std::ios::binary);
+      good = os.good();
+      if (good)
+      {
+        BinaryFormat<Ctype, CresultData>::write(os, space,
+            algorithm.getParameters());
+      }
+    }
+    MPI_Bcast(&good, 1, MPI_INT, Mroot, Mcomm);
+    OPTIMIZE_assert(good, "Unable to write binary parameter space.");
+
+    BinaryGridInfo<Ctype> info;
+    {
+      std::ifstream is(filename.c_str(), std::ios::binary);
+      OPTIMIZE_assert(is.good(), "Unable to read binary parameter space.");
+      info = BinaryFormat<Ctype, CresultData>::readHeader(is);
+    }
+
+    Iterator<Ctype, CresultData> iter(
+        space.createIterator(RandomAccessNodeIter));
+    std::vector<CresultData> results;
+    std::vector<char> computed;
+    size_t const first = pack(algorithm, iter, results, computed);
+
+    MPI_File file;
+    OPTIMIZE_assert(MPI_SUCCESS == MPI_File_open(Mcomm,
+          const_cast<char*>(filename.c_str()), MPI_MODE_WRONLY, MPI_INFO_NULL,
+          &file), "Unable to open binary parameter space.");
+    MPI_Offset const result_offset =
+      BinaryFormat<Ctype, CresultData>::getResultOffset(info) +
+      first*sizeof(CresultData);
+    MPI_File_write_at_all(file, result_offset, results.data(),
+        results.size(), MresultType, MPI_STATUS_IGNORE);
+    MPI_Offset const computed_offset =
+      BinaryFormat<Ctype, CresultData>::getComputedOffset(info) + first;
+    MPI_File_write_at_all(file, computed_offset, computed.data(),
+        computed.size(), MPI_CHAR, MPI_STATUS_IGNORE);
+    MPI_File_close(&file);
+  } // function MPIExecutor<Ctype, CresultData>::write
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF mpiexecutor.h  ----- */
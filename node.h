@@ -30,12 +30,19 @@
  * 
  * REVISIONS and CHANGES 
  * 29/02/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Node data is accessible for derived (flyweight) nodes.
+ * 14/10/2026  V0.3  Raw access to the coordinates.
+ * 14/10/2026  V0.4  Coordinate storage moved to derived nodes
+ *                   (optimize::DynamicNode, optimize::FixedNode).
+ * 14/10/2026  V0.5  Nodes store their coordinates in a vector again.
+ *                   optimize::DynamicNode removed.
  * 
  * ============================================================================
  */
 
 #include <vector>
 #include <ostream>
+#include <utility>
 #include <optimizexx/gridcomponent.h>
 
 
@@ -53,7 +60,13 @@ namespace optimize
    * Declares a node of a parameter space. It's coordinates represent the
    * parameters of the parameter space. Additionally holds the result data
    * after an application had visited the node.
-   * Leaf class of the composite design pattern (GoF p.163).
+   * Leaf class of the composite design pattern (GoF p.163).\n
+   *
+   * A node stores its coordinates in a \c std::vector. Derived nodes might
+   * store their coordinates elsewhere (e.g. optimize::FixedNode) and then
+   * provide them by means of getCoordinateData() and getDimensions() only.
+   * Applications which visit any kind of node should prefer these accessors
+   * to getCoordinates().
    *
    * \ingroup group_grid
    */
@@ -71,7 +84,7 @@ namespace optimize
       /*!
        * \param coordinates The coordinates of the node.
        */
-      Node(Tcoordinates const coordinates);
+      Node(Tcoordinates coordinates);
       //! destructor
       virtual ~Node() { }
       /*! 
@@ -99,6 +112,20 @@ namespace optimize
       {
         return Mcoordinates;
       }
+      /*!
+       * query function for the nodes' coordinates\n
+       * Nodes return their coordinates without any conversion. Applications
+       * knowing the dimension of the parameter space at compile time might
+       * loop over the coordinates with a constant trip count then.
+       *
+       * \return pointer to the first of getDimensions() coordinates
+       */
+      virtual Ctype const* getCoordinateData() const
+      {
+        return Mcoordinates.data();
+      }
+      //! query function for the number of coordinates
+      virtual size_t getDimensions() const { return Mcoordinates.size(); }
       //! query function for coordinate Ids
       virtual std::vector<std::string> const& getCoordinateId() const;
       //! query function for result data
@@ -109,7 +136,14 @@ namespace optimize
         MresultData = data;
       }
 
-    private:
+    protected:
+      /*!
+       * constructor for derived nodes which store their coordinates
+       * themselves
+       */
+      Node() : Tbase(0, false) { }
+
+    protected:
       //! Coordinates of the node.
       Tcoordinates Mcoordinates;
       //! Template parameter to store the results of the calculation.
@@ -119,8 +153,8 @@ namespace optimize
 
   /* ======================================================================= */
   template <typename Ctype, typename CresultData>
-  Node<Ctype, CresultData>::Node(Tcoordinates const coordinates) : 
-    Tbase(0, false), Mcoordinates(coordinates)
+  Node<Ctype, CresultData>::Node(Tcoordinates coordinates) : 
+    Tbase(0, false), Mcoordinates(std::move(coordinates))
   { }
 
   /* ----------------------------------------------------------------------- */
@@ -0,0 +1,211 @@
+/*! \file progress.h
+ * \brief Lock-free progress counters of an execution.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Lock-free progress counters of an execution.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  The start is set once on construction.
+ * 14/10/2026  V0.3  The elapsed time stops as soon as the execution finished.
+ * 
+ * ============================================================================
+ */
+
+#include <atomic>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#ifndef _OPTIMIZEXX_PROGRESS_H_
+#define _OPTIMIZEXX_PROGRESS_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Progress of the execution of a global algorithm.\n
+   *
+   * The counters refer to nodes. Nodes are \em submitted as soon as the task
+   * containing them had been added to a thread pool, \em in-flight while a
+   * worker applies the application to them and \em completed afterwards.
+   * Nodes of tasks discarded due to cancellation are removed from the
+   * submitted nodes again. The counters are atomic so that the progress may
+   * be queried by any thread without locking while the execution is running.
+   * \n
+   *
+   * Additionally the progress carries the cancellation request of an
+   * execution (see optimize::Execution::cancel).\n
+   *
+   * The elapsed time is measured from the construction until the execution
+   * finished (see finish()) so that the throughput of a finished execution
+   * stays constant.
+   *
+   * \ingroup group_global_algos
+   */
+  class Progress
+  {
+    public:
+      //! constructor - starts the progress
+      Progress() :
+        Mstart(boost::posix_time::microsec_clock::universal_time())
+      {
+        reset();
+      }
+      /*!
+       * reset the counters, the cancellation request and the end of the
+       * execution\n
+       * The start is set once on construction. So it is never written while
+       * another thread queries the progress.
+       */
+      void reset();
+      //! query function for the number of submitted nodes
+      size_t getSubmitted() const { return Msubmitted; }
+      //! query function for the number of completed nodes
+      size_t getCompleted() const { return Mcompleted; }
+      //! query function for the number of nodes currently computed
+      size_t getInFlight() const { return MinFlight; }
+      /*!
+       * query function for the time elapsed since the start in seconds -
+       * until the end of the execution if it finished
+       */
+      double getElapsed() const;
+      //! query function for the number of completed nodes per second
+      double getThroughput() const;
+      //! request the cancellation of the execution
+      void cancel() { Mcancelled = true; }
+      //! query function if the cancellation had been requested
+      bool isCancelled() const { return Mcancelled; }
+      /*!
+       * Record the end of the execution, i.e. the point in time its last
+       * task had been completed. Called by the global algorithms (see
+       * optimize::ScopedProgress).
+       */
+      void finish();
+      //! query function if the execution finished
+      bool isFinished() const { return 0 <= Mduration; }
+
+      //! count submitted nodes
+      void submit(size_t const n) { Msubmitted += n; }
+      //! count nodes a worker started to compute
+      void begin(size_t const n) { MinFlight += n; }
+      //! count nodes a worker finished to compute
+      void end(size_t const n) { MinFlight -= n; Mcompleted += n; }
+      //! remove nodes of discarded tasks
+      void discard(size_t const n) { Msubmitted -= n; }
+      //! count nodes computed immediately (single threaded execution)
+      void complete(size_t const n) { Msubmitted += n; Mcompleted += n; }
+
+    private:
+      //! not copyable
+      Progress(Progress const&);
+      //! not assignable
+      Progress& operator=(Progress const&);
+
+    private:
+      //! number of submitted nodes
+      std::atomic<size_t> Msubmitted;
+      //! number of completed nodes
+      std::atomic<size_t> Mcompleted;
+      //! number of nodes currently computed
+      std::atomic<size_t> MinFlight;
+      //! status variable if the cancellation had been requested
+      std::atomic<bool> Mcancelled;
+      //! start of the execution
+      boost::posix_time::ptime const Mstart;
+      //! duration of the finished execution in microseconds - negative before
+      std::atomic<long long> Mduration;
+
+  }; // class Progress
+
+  /* ======================================================================= */
+  /*!
+   * Finish a progress (see optimize::Progress::finish) as soon as the
+   * execution of a global algorithm leaves its scope - no matter if it
+   * returns or throws.
+   *
+   * \ingroup group_global_algos
+   */
+  class ScopedProgress
+  {
+    public:
+      //! constructor
+      explicit ScopedProgress(Progress& progress) : Mprogress(progress) { }
+      //! destructor - finishes the progress
+      ~ScopedProgress() { Mprogress.finish(); }
+
+    private:
+      //! not copyable
+      ScopedProgress(ScopedProgress const&);
+      //! not assignable
+      ScopedProgress& operator=(ScopedProgress const&);
+
+    private:
+      //! progress of the execution
+      Progress& Mprogress;
+
+  }; // class ScopedProgress
+
+  /* ======================================================================= */
+  inline void Progress::reset()
+  {
+    Msubmitted = 0;
+    Mcompleted = 0;
+    MinFlight = 0;
+    Mcancelled = false;
+    Mduration = -1;
+  } // function Progress::reset
+
+  /* ----------------------------------------------------------------------- */
+  inline void Progress::finish()
+  {
+    Mduration = (boost::posix_time::microsec_clock::universal_time() -
+        Mstart).total_microseconds();
+  } // function Progress::finish
+
+  /* ----------------------------------------------------------------------- */
+  inline double Progress::getElapsed() const
+  {
+    long long const duration = Mduration;
+    if (0 <= duration) { return duration*1e-6; }
+    return (boost::posix_time::microsec_clock::universal_time() -
+        Mstart).total_microseconds()*1e-6;
+  } // function Progress::getElapsed
+
+  /* ----------------------------------------------------------------------- */
+  inline double Progress::getThroughput() const
+  {
+    double const elapsed = getElapsed();
+    return 0 < elapsed ? Mcompleted/elapsed : 0;
+  } // function Progress::getThroughput
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF progress.h  ----- */
@@ -0,0 +1,295 @@
+/*! \file pruning.h
+ * \brief Early termination and pruning of global algorithms.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Early termination and pruning of global algorithms.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Cancel the execution instead of the thread pool.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <optimizexx/application.h>
+#include <optimizexx/grid.h>
+#include <optimizexx/node.h>
+#include <optimizexx/indexedgrid.h>
+#include <optimizexx/progress.h>
+
+#ifndef _OPTIMIZEXX_PRUNING_H_
+#define _OPTIMIZEXX_PRUNING_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Abstract base class of a pruning policy of a global algorithm (branch
+   * and bound). Note that the strategy design pattern is in use.\n
+   *
+   * terminate() is a predicate on partial results. It is called as soon as
+   * a node had been computed and cancels the rest of the run if it returns
+   * \c true e.g. because the result is good enough. prune() is a bound
+   * function on a (sub)grid. If it returns \c true none of the nodes of the
+   * grid are computed. Use optimize::getBounds to query the box a grid
+   * spans.\n
+   *
+   * \note Both functions are called concurrently by the workers of a
+   * thread pool and must be thread safe.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class Pruner
+  {
+    public:
+      //! destructor
+      virtual ~Pruner() { }
+      /*!
+       * Predicate on the result of a node which had been computed.
+       *
+       * \param node computed node
+       * \return \c true if the rest of the run is to be cancelled
+       */
+      virtual bool terminate(Node<Ctype, CresultData> const* node)
+      {
+        return false;
+      }
+      /*!
+       * Bound function on a grid whose nodes are about to be computed.
+       *
+       * \param grid grid
+       * \return \c true if the nodes of the grid are to be skipped
+       */
+      virtual bool prune(Grid<Ctype, CresultData>* grid) { return false; }
+
+    protected:
+      //! constructor
+      Pruner() { }
+
+  }; // class template Pruner
+
+  /* ======================================================================= */
+  /*!
+   * Query the box spanned by the nodes of a grid. Nodes of subgrids are not
+   * considered. The box of an optimize::IndexedGrid is spanned by its first
+   * and its last grid point.
+   *
+   * \param grid grid
+   * \param lower lower corner of the box
+   * \param upper upper corner of the box
+   * \return \c false if the grid does not possess any nodes
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  bool getBounds(Grid<Ctype, CresultData>* grid, std::vector<Ctype>& lower,
+      std::vector<Ctype>& upper)
+  {
+    typedef GridComponent<Ctype, CresultData> Tcomponent;
+
+    lower.clear();
+    upper.clear();
+    IndexedGrid<Ctype, CresultData>* indexed_grid =
+      dynamic_cast<IndexedGrid<Ctype, CresultData>*>(grid);
+    if (indexed_grid)
+    {
+      if (0 == indexed_grid->size()) { return false; }
+      indexed_grid->getCoordinatesAt(0, lower);
+      indexed_grid->getCoordinatesAt(indexed_grid->size()-1, upper);
+      for (size_t i = 0; i < lower.size(); ++i)
+      {
+        if (upper[i] < lower[i]) { std::swap(lower[i], upper[i]); }
+      }
+      return true;
+    }
+
+    for (auto it(grid->begin()); it != grid->end(); ++it)
+    {
+      if (Tcomponent::Leaf != (*it)->getComponentType()) { continue; }
+      Node<Ctype, CresultData> const* node =
+        static_cast<Node<Ctype, CresultData> const*>(*it);
+      Ctype const* coordinates = node->getCoordinateData();
+      size_t const dimensions = node->getDimensions();
+      if (lower.empty())
+      {
+        lower.assign(coordinates, coordinates+dimensions);
+        upper.assign(coordinates, coordinates+dimensions);
+        continue;
+      }
+      for (size_t i = 0; i < dimensions; ++i)
+      {
+        lower[i] = std::min(lower[i], coordinates[i]);
+        upper[i] = std::max(upper[i], coordinates[i]);
+      }
+    }
+    return ! lower.empty();
+  } // function template getBounds
+
+  /* ======================================================================= */
+  /*!
+   * Application decorating another application with a pruning policy (see
+   * optimize::Pruner). Note that the decorator design pattern is in use
+   * (GoF p.175).\n
+   *
+   * Nodes of pruned grids are not passed to the decorated application. As
+   * soon as the pruning policy terminates the run, nodes are skipped and
+   * the cancellation of the execution (see optimize::Progress) is requested
+   * so that the tasks still queued are discarded. Clones share the state of
+   * the cancellation.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class PruningVisitor : public ParameterSpaceVisitor<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef ParameterSpaceVisitor<Ctype, CresultData> Tbase;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param app decorated application
+       * \param pruner pruning policy
+       */
+      PruningVisitor(Tbase& app, Pruner<Ctype, CresultData>& pruner) :
+        Mapp(app), Mpruner(pruner), Mcancelled(new std::atomic<bool>(false)),
+        Mprogress(0), MlastParent(0), Mskip(false)
+      { }
+      //! destructor
+      virtual ~PruningVisitor() { }
+      //! Visit function for a grid.
+      virtual void operator()(Grid<Ctype, CresultData>* grid) { Mapp(grid); }
+      //! Visit function for a node.
+      virtual void operator()(Node<Ctype, CresultData>* node);
+      //! create a clone sharing the state of the cancellation
+      virtual std::unique_ptr<Tbase> clone() const;
+      //! merge a clone into the decorated application
+      virtual void merge(Tbase& clone);
+      /*!
+       * Set the progress of the execution to be cancelled on termination.
+       * Must be set before clones are created.
+       */
+      void setProgress(Progress* progress) { Mprogress = progress; }
+      /*!
+       * Bound function applied to a grid.
+       *
+       * \return \c true if the run had been terminated or the pruning policy
+       * prunes the grid
+       */
+      bool prune(Grid<Ctype, CresultData>* grid)
+      {
+        return *Mcancelled || Mpruner.prune(grid);
+      }
+      //! query function if the run had been terminated
+      bool isCancelled() const { return *Mcancelled; }
+
+    private:
+      //! constructor of a clone
+      PruningVisitor(PruningVisitor const& original,
+          std::unique_ptr<Tbase> app) : Mapp(app ? *app : original.Mapp),
+        Mpruner(original.Mpruner), Mcancelled(original.Mcancelled),
+        Mprogress(original.Mprogress), MlastParent(0), Mskip(false),
+        Mclone(std::move(app))
+      { }
+
+    private:
+      //! decorated application
+      Tbase& Mapp;
+      //! pruning policy
+      Pruner<Ctype, CresultData>& Mpruner;
+      //! state of the cancellation shared with the clones
+      std::shared_ptr<std::atomic<bool>> Mcancelled;
+      //! progress of the execution to be cancelled
+      Progress* Mprogress;
+      //! parent grid of the node visited last
+      GridComponent<Ctype, CresultData>* MlastParent;
+      //! status variable if the parent grid had been pruned
+      bool Mskip;
+      //! clone of the decorated application owned by a clone
+      std::unique_ptr<Tbase> Mclone;
+
+  }; // class template PruningVisitor
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void PruningVisitor<Ctype, CresultData>::operator()(
+      Node<Ctype, CresultData>* node)
+  {
+    if (*Mcancelled) { return; }
+    // consecutive nodes mostly share their grid
+    GridComponent<Ctype, CresultData>* parent = node->getParent();
+    if (parent != MlastParent)
+    {
+      MlastParent = parent;
+      Mskip = parent &&
+        Mpruner.prune(static_cast<Grid<Ctype, CresultData>*>(parent));
+    }
+    if (Mskip) { return; }
+
+    Mapp(node);
+    if (Mpruner.terminate(node))
+    {
+      *Mcancelled = true;
+      if (Mprogress) { Mprogress->cancel(); }
+    }
+  } // function PruningVisitor<Ctype, CresultData>::operator()
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  PruningVisitor<Ctype, CresultData>::clone() const
+  {
+    // a clone is created even if the decorated application is shared by the
+    // workers since the clone keeps track of the grid visited last
+    return std::unique_ptr<Tbase>(
+        new PruningVisitor<Ctype, CresultData>(*this, Mapp.clone()));
+  } // function PruningVisitor<Ctype, CresultData>::clone
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void PruningVisitor<Ctype, CresultData>::merge(Tbase& clone)
+  {
+    PruningVisitor<Ctype, CresultData>& pruning =
+      static_cast<PruningVisitor<Ctype, CresultData>&>(clone);
+    if (pruning.Mclone) { Mapp.merge(*pruning.Mclone); }
+  } // function PruningVisitor<Ctype, CresultData>::merge
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF pruning.h  ----- */
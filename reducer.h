@@ -0,0 +1,428 @@
+/*! \file reducer.h
+ * \brief Lock-free per thread reduction of result data.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Lock-free per thread reduction of result data.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <boost/thread.hpp>
+#include <optimizexx/threadpool.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_REDUCER_H_
+#define _OPTIMIZEXX_REDUCER_H_
+
+/*!
+ * Size of a cache line in bytes. Reducer slots of different threads are
+ * separated by at least this number of bytes to avoid false sharing.
+ */
+#ifndef OPTIMIZE_CACHE_LINE_SIZE
+#define OPTIMIZE_CACHE_LINE_SIZE 64
+#endif
+
+namespace optimize
+{
+
+  namespace thread
+  {
+
+    /* ===================================================================== */
+    /*!
+     * Abstract base class template of reducers.\n
+     *
+     * A reducer provides a slot to accumulate results for each worker of a
+     * thread pool. A worker only accesses its own slot (see
+     * optimize::thread::getWorkerIndex) so that updating a reducer neither
+     * requires locking nor allocates memory. Slots are padded against false
+     * sharing. Querying the result merges the slots and therefore must be
+     * done after the algorithm had finished its execution.\n
+     *
+     * Usually a reducer is a member of an application (visitor) and updated
+     * from within the application's visit function for nodes.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Cslot>
+    class Reducer
+    {
+      public:
+        //! destructor
+        virtual ~Reducer() { }
+        //! reset the slots of all threads
+        void reset()
+        {
+          for (auto it(Mslots.begin()); it != Mslots.end(); ++it)
+          {
+            it->Mvalue = Minit;
+          }
+        }
+        //! query function for the number of slots
+        size_t getNumSlots() const { return Mslots.size(); }
+
+      protected:
+        /*!
+         * constructor
+         *
+         * \param num_threads number of threads of the thread pool in use - if
+         * zero the number of hardware threads is used (as a thread pool
+         * would)
+         * \param init initial value of a slot
+         */
+        Reducer(size_t num_threads, Cslot const& init) : Minit(init)
+        {
+          if (0 == num_threads)
+          {
+            num_threads = boost::thread::hardware_concurrency();
+          }
+          if (0 == num_threads) { num_threads = 1; }
+          Mslots.resize(num_threads);
+          reset();
+        }
+        //! query function for the slot of the calling thread
+        Cslot& getSlot()
+        {
+          size_t const index = getWorkerIndex();
+          OPTIMIZE_assert(index < Mslots.size(), "Too few reducer slots.");
+          return Mslots[index].Mvalue;
+        }
+
+      private:
+        //! slot padded against false sharing
+        struct PaddedSlot
+        {
+          //! accumulated value
+          Cslot Mvalue;
+          //! padding
+          char Mpadding[OPTIMIZE_CACHE_LINE_SIZE];
+        }; // struct PaddedSlot
+
+      protected:
+        //! initial value of a slot
+        Cslot Minit;
+        //! slots of the threads
+        std::vector<PaddedSlot> Mslots;
+
+    }; // class template Reducer
+
+    /* ===================================================================== */
+    /*!
+     * Reducer determining the minimum of result data.\n
+     * The comparator \c Ccompare defines the order of the result data.
+     *
+     * \ingroup group_thread
+     */
+    template <typename CresultData,
+             typename Ccompare = std::less<CresultData>>
+    class MinReducer : public Reducer<std::pair<bool, CresultData>>
+    {
+      public:
+        typedef Reducer<std::pair<bool, CresultData>> Tbase;
+
+      public:
+        /*!
+         * constructor
+         *
+         * \param num_threads number of threads of the thread pool in use
+         * \param comp comparator
+         */
+        MinReducer(size_t num_threads=0, Ccompare comp=Ccompare()) :
+          Tbase(num_threads, std::make_pair(false, CresultData())),
+          Mcompare(comp)
+        { }
+        //! destructor
+        virtual ~MinReducer() { }
+        /*!
+         * Update the slot of the calling thread.
+         *
+         * \param value result data
+         */
+        void update(CresultData const& value)
+        {
+          std::pair<bool, CresultData>& slot = Tbase::getSlot();
+          if (! slot.first || Mcompare(value, slot.second))
+          {
+            slot.first = true;
+            slot.second = value;
+          }
+        }
+        //! query function if any result data had been passed
+        bool hasResult() const;
+        //! query function for the reduced result - merges the slots
+        CresultData getResult() const;
+
+      private:
+        //! comparator
+        Ccompare Mcompare;
+
+    }; // class template MinReducer
+
+    /* ===================================================================== */
+    /*!
+     * Reducer determining the maximum of result data.
+     *
+     * \ingroup group_thread
+     */
+    template <typename CresultData>
+    class MaxReducer : 
+      public MinReducer<CresultData, std::greater<CresultData>>
+    {
+      public:
+        typedef MinReducer<CresultData, std::greater<CresultData>> Tbase;
+
+      public:
+        /*!
+         * constructor
+         *
+         * \param num_threads number of threads of the thread pool in use
+         */
+        MaxReducer(size_t num_threads=0) : Tbase(num_threads) { }
+        //! destructor
+        virtual ~MaxReducer() { }
+
+    }; // class template MaxReducer
+
+    /* ===================================================================== */
+    /*!
+     * Reducer determining the \c K best (smallest) result data.\n
+     * The memory of the slots is reserved in advance so that updating the
+     * reducer does not allocate memory.
+     *
+     * \ingroup group_thread
+     */
+    template <typename CresultData,
+             typename Ccompare = std::less<CresultData>>
+    class TopKReducer : public Reducer<std::vector<CresultData>>
+    {
+      public:
+        typedef Reducer<std::vector<CresultData>> Tbase;
+
+      public:
+        /*!
+         * constructor
+         *
+         * \param k number of result data to be kept
+         * \param num_threads number of threads of the thread pool in use
+         * \param comp comparator
+         */
+        TopKReducer(size_t k, size_t num_threads=0, Ccompare comp=Ccompare());
+        //! destructor
+        virtual ~TopKReducer() { }
+        /*!
+         * Update the slot of the calling thread.
+         *
+         * \param value result data
+         */
+        void update(CresultData const& value);
+        /*!
+         * query function for the reduced result - merges the slots
+         *
+         * \return at most \c K result data - best first
+         */
+        std::vector<CresultData> getResult() const;
+
+      private:
+        //! number of result data to be kept
+        size_t Mk;
+        //! comparator
+        Ccompare Mcompare;
+
+    }; // class template TopKReducer
+
+    /* ===================================================================== */
+    /*!
+     * Reducer determining the mean of result data.\n
+     * \c CresultData must provide the operators \c + and \c / (division by
+     * the number of result data).
+     *
+     * \ingroup group_thread
+     */
+    template <typename CresultData>
+    class MeanReducer : public Reducer<std::pair<CresultData, size_t>>
+    {
+      public:
+        typedef Reducer<std::pair<CresultData, size_t>> Tbase;
+
+      public:
+        /*!
+         * constructor
+         *
+         * \param num_threads number of threads of the thread pool in use
+         * \param zero neutral element of the summation
+         */
+        MeanReducer(size_t num_threads=0, CresultData zero=CresultData()) :
+          Tbase(num_threads, std::make_pair(zero, size_t(0)))
+        { }
+        //! destructor
+        virtual ~MeanReducer() { }
+        /*!
+         * Update the slot of the calling thread.
+         *
+         * \param value result data
+         */
+        void update(CresultData const& value)
+        {
+          std::pair<CresultData, size_t>& slot = Tbase::getSlot();
+          slot.first = slot.first + value;
+          ++slot.second;
+        }
+        //! query function for the number of result data passed
+        size_t getCount() const;
+        //! query function for the reduced result - merges the slots
+        CresultData getResult() const;
+
+    }; // class template MeanReducer
+
+    /* ===================================================================== */
+    template <typename CresultData, typename Ccompare>
+    bool MinReducer<CresultData, Ccompare>::hasResult() const
+    {
+      for (auto cit(Tbase::Mslots.cbegin()); cit != Tbase::Mslots.cend();
+          ++cit)
+      {
+        if (cit->Mvalue.first) { return true; }
+      }
+      return false;
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename CresultData, typename Ccompare>
+    CresultData MinReducer<CresultData, Ccompare>::getResult() const
+    {
+      OPTIMIZE_assert(hasResult(), "No result data available.");
+      std::pair<bool, CresultData> retval(Tbase::Minit);
+      for (auto cit(Tbase::Mslots.cbegin()); cit != Tbase::Mslots.cend();
+          ++cit)
+      {
+        if (cit->Mvalue.first && 
+            (! retval.first || Mcompare(cit->Mvalue.second, retval.second)))
+        {
+          retval = cit->Mvalue;
+        }
+      }
+      return retval.second;
+    } // function MinReducer<CresultData, Ccompare>::getResult
+
+    /* ===================================================================== */
+    template <typename CresultData, typename Ccompare>
+    TopKReducer<CresultData, Ccompare>::TopKReducer(size_t k,
+        size_t num_threads, Ccompare comp) :
+      Tbase(num_threads, std::vector<CresultData>()), Mk(k), Mcompare(comp)
+    {
+      OPTIMIZE_assert(0 < Mk, "Illegal value.");
+      Tbase::Minit.reserve(Mk);
+      for (auto it(Tbase::Mslots.begin()); it != Tbase::Mslots.end(); ++it)
+      {
+        it->Mvalue.reserve(Mk);
+      }
+    } // constructor TopKReducer<CresultData, Ccompare>
+
+    /* --------------------------------------------------------------------- */
+    template <typename CresultData, typename Ccompare>
+    void TopKReducer<CresultData, Ccompare>::update(CresultData const& value)
+    {
+      std::vector<CresultData>& slot = Tbase::getSlot();
+      if (slot.size() < Mk)
+      {
+        slot.push_back(value);
+      } else
+      if (Mcompare(value, slot.back()))
+      {
+        slot.back() = value;
+      } else
+      {
+        return;
+      }
+      // insertion sort step - the slot is kept in order
+      for (size_t i = slot.size()-1; i > 0 && Mcompare(slot[i], slot[i-1]);
+          --i)
+      {
+        std::swap(slot[i], slot[i-1]);
+      }
+    } // function TopKReducer<CresultData, Ccompare>::update
+
+    /* --------------------------------------------------------------------- */
+    template <typename CresultData, typename Ccompare>
+    std::vector<CresultData> TopKReducer<CresultData, Ccompare>::getResult()
+      const
+    {
+      std::vector<CresultData> retval;
+      for (auto cit(Tbase::Mslots.cbegin()); cit != Tbase::Mslots.cend();
+          ++cit)
+      {
+        retval.insert(retval.end(), cit->Mvalue.begin(), cit->Mvalue.end());
+      }
+      std::sort(retval.begin(), retval.end(), Mcompare);
+      if (retval.size() > Mk) { retval.resize(Mk); }
+      return retval;
+    } // function TopKReducer<CresultData, Ccompare>::getResult
+
+    /* ===================================================================== */
+    template <typename CresultData>
+    size_t MeanReducer<CresultData>::getCount() const
+    {
+      size_t retval = 0;
+      for (auto cit(Tbase::Mslots.cbegin()); cit != Tbase::Mslots.cend();
+          ++cit)
+      {
+        retval += cit->Mvalue.second;
+      }
+      return retval;
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename CresultData>
+    CresultData MeanReducer<CresultData>::getResult() const
+    {
+      size_t const count = getCount();
+      OPTIMIZE_assert(0 < count, "No result data available.");
+      CresultData sum(Tbase::Minit.first);
+      for (auto cit(Tbase::Mslots.cbegin()); cit != Tbase::Mslots.cend();
+          ++cit)
+      {
+        sum = sum + cit->Mvalue.first;
+      }
+      return sum / count;
+    } // function MeanReducer<CresultData>::getResult
+
+    /* --------------------------------------------------------------------- */
+
+  } // namespace thread
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF reducer.h  ----- */
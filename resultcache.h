@@ -0,0 +1,557 @@
+/*! \file resultcache.h
+ * \brief Cache of result data keyed by the coordinates of nodes.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Cache of result data keyed by the coordinates of nodes.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Result cache decorating batch applications.
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <memory>
+#include <atomic>
+#include <cmath>
+#include <boost/thread.hpp>
+#include <optimizexx/application.h>
+#include <optimizexx/node.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_RESULTCACHE_H_
+#define _OPTIMIZEXX_RESULTCACHE_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Thread safe cache of result data keyed by coordinates.\n
+   *
+   * The cache memoizes result data of nodes across several runs of global
+   * algorithms e.g. a grid search followed by a Monte Carlo search on
+   * overlapping parameter spaces. Coordinates are quantized with a
+   * resolution so that coordinates which differ less than the resolution
+   * share an entry.\n
+   *
+   * The cache is a hash map divided into shards each protected by its own
+   * mutex to reduce contention of worker threads. Its memory consumption is
+   * bounded by a budget. If the budget is exceeded the least recently used
+   * entries of a shard are evicted.\n
+   *
+   * A cache is shared between global algorithms by means of
+   * optimize::GlobalAlgorithm::setResultCache. The algorithm then applies
+   * the application through an optimize::CachingVisitor.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class ResultCache
+  {
+    public:
+      //! typedef for quantized coordinates
+      typedef std::vector<long long> Tkey;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param resolution resolution coordinates are quantized with
+       * \param budget maximum amount of memory in bytes used by the entries
+       * \param num_shards number of independently locked shards
+       */
+      ResultCache(double resolution, size_t budget=64<<20,
+          size_t num_shards=16);
+      /*!
+       * Look up the result data of coordinates. A hit marks the entry as
+       * most recently used.
+       *
+       * \param coordinates pointer to the coordinates
+       * \param dimensions number of coordinates
+       * \param data result data written if the coordinates are cached
+       * \return \c true if the coordinates are cached
+       */
+      bool lookup(Ctype const* coordinates, size_t const dimensions,
+          CresultData& data);
+      /*!
+       * Insert or update the result data of coordinates.
+       *
+       * \param coordinates pointer to the coordinates
+       * \param dimensions number of coordinates
+       * \param data result data
+       */
+      void insert(Ctype const* coordinates, size_t const dimensions,
+          CresultData const& data);
+      //! remove all entries
+      void clear();
+      //! query function for the number of entries
+      size_t size() const;
+      //! query function for the number of successful lookups
+      size_t getHits() const { return Mhits; }
+      //! query function for the number of failed lookups
+      size_t getMisses() const { return Mmisses; }
+      //! query function for the number of evicted entries
+      size_t getEvictions() const { return Mevictions; }
+      //! query function for the resolution of the coordinates
+      double getResolution() const { return Mresolution; }
+
+    private:
+      //! hash function of quantized coordinates
+      struct KeyHash
+      {
+        size_t operator()(Tkey const& key) const
+        {
+          size_t seed = key.size();
+          for (auto cit(key.cbegin()); cit != key.cend(); ++cit)
+          {
+            seed ^= std::hash<long long>()(*cit) + 0x9e3779b9 + (seed << 6) +
+              (seed >> 2);
+          }
+          return seed;
+        }
+      }; // struct KeyHash
+
+      //! entry of a shard - the front of the list is the most recently used
+      typedef std::list<std::pair<Tkey, CresultData>> Tentries;
+
+      //! independently locked part of the cache
+      struct Shard
+      {
+        //! constructor
+        Shard() : Musage(0) { }
+        //! entries in order of their usage
+        Tentries Mentries;
+        //! index of the entries
+        std::unordered_map<Tkey, typename Tentries::iterator, KeyHash> Mindex;
+        //! memory used by the entries in bytes
+        size_t Musage;
+        //! mutex protecting the shard
+        boost::mutex Mmutex;
+      }; // struct Shard
+
+    private:
+      //! quantize coordinates
+      void quantize(Ctype const* coordinates, size_t const dimensions,
+          Tkey& key) const;
+      //! query function for the shard of a key
+      Shard& getShard(Tkey const& key);
+      //! estimate the memory used by an entry
+      static size_t getEntrySize(size_t const dimensions);
+
+    private:
+      //! resolution coordinates are quantized with
+      double Mresolution;
+      //! memory budget of a shard in bytes
+      size_t MshardBudget;
+      //! shards of the cache
+      std::vector<std::unique_ptr<Shard>> Mshards;
+      //! number of successful lookups
+      std::atomic<size_t> Mhits;
+      //! number of failed lookups
+      std::atomic<size_t> Mmisses;
+      //! number of evicted entries
+      std::atomic<size_t> Mevictions;
+
+  }; // class template ResultCache
+
+  /* ======================================================================= */
+  /*!
+   * Application decorating another application with a result cache.
+   * Note that the decorator design pattern is in use (GoF p.175).\n
+   *
+   * Nodes whose coordinates are cached get their result data from the cache
+   * without visiting the decorated application. Otherwise the decorated
+   * application computes the result data which afterwards is stored in the
+   * cache. Clones (see optimize::ParameterSpaceVisitor::clone) decorate the
+   * clones of the decorated application.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class CachingVisitor : public ParameterSpaceVisitor<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef ParameterSpaceVisitor<Ctype, CresultData> Tbase;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param app decorated application
+       * \param cache result cache
+       */
+      CachingVisitor(Tbase& app, ResultCache<Ctype, CresultData>& cache) :
+        Mapp(app), Mcache(cache)
+      { }
+      //! destructor
+      virtual ~CachingVisitor() { }
+      //! Visit function for a grid.
+      virtual void operator()(Grid<Ctype, CresultData>* grid) { Mapp(grid); }
+      //! Visit function for a node.
+      virtual void operator()(Node<Ctype, CresultData>* node);
+      //! create a clone decorating a clone of the decorated application
+      virtual std::unique_ptr<Tbase> clone() const;
+      //! merge a clone into the decorated application
+      virtual void merge(Tbase& clone);
+
+    private:
+      //! constructor of a clone
+      CachingVisitor(std::unique_ptr<Tbase> app,
+          ResultCache<Ctype, CresultData>& cache) : Mapp(*app),
+        Mcache(cache), Mclone(std::move(app))
+      { }
+
+    private:
+      //! decorated application
+      Tbase& Mapp;
+      //! result cache
+      ResultCache<Ctype, CresultData>& Mcache;
+      //! clone of the decorated application owned by a clone
+      std::unique_ptr<Tbase> Mclone;
+
+  }; // class template CachingVisitor
+
+  /* ======================================================================= */
+  /*!
+   * Batch application decorating a batch application with a result cache.
+   * Note that the decorator design pattern is in use (GoF p.175).\n
+   *
+   * The grid points of a block whose coordinates are cached get their
+   * result data from the cache. The grid points missing are gathered into a
+   * block of their own which is passed to the decorated application.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class CachingBatchVisitor :
+    public BatchParameterSpaceVisitor<Ctype, CresultData>
+  {
+    public:
+      //! Base class.
+      typedef BatchParameterSpaceVisitor<Ctype, CresultData> Tbase;
+      //! Application base class.
+      typedef ParameterSpaceVisitor<Ctype, CresultData> Tvisitor;
+      using Tbase::operator();
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param app decorated batch application
+       * \param cache result cache
+       */
+      CachingBatchVisitor(Tbase& app, ResultCache<Ctype, CresultData>& cache) :
+        Mapp(app), Mcache(cache)
+      {
+        Tbase::setBlockSize(app.getBlockSize());
+      }
+      //! destructor
+      virtual ~CachingBatchVisitor() { }
+      //! Visit function for a block of grid points.
+      virtual void operator()(CoordinateBlock<Ctype, CresultData> const&
+          block);
+      //! Visit function for a grid.
+      virtual void operator()(Grid<Ctype, CresultData>* grid) { Mapp(grid); }
+      //! query function if grid points already computed are skipped
+      virtual bool skipsComputed() const { return Mapp.skipsComputed(); }
+      //! create a clone decorating a clone of the decorated application
+      virtual std::unique_ptr<Tvisitor> clone() const;
+      //! merge a clone into the decorated application
+      virtual void merge(Tvisitor& clone)
+      {
+        Mapp.merge(static_cast<CachingBatchVisitor&>(clone).Mapp);
+      }
+
+    private:
+      //! constructor of a clone
+      CachingBatchVisitor(Tbase& app, std::unique_ptr<Tvisitor> clone,
+          ResultCache<Ctype, CresultData>& cache) : Mapp(app),
+        Mcache(cache), Mclone(std::move(clone))
+      {
+        Tbase::setBlockSize(app.getBlockSize());
+      }
+
+    private:
+      //! decorated batch application
+      Tbase& Mapp;
+      //! result cache
+      ResultCache<Ctype, CresultData>& Mcache;
+      //! clone of the decorated application owned by a clone
+      std::unique_ptr<Tvisitor> Mclone;
+
+  }; // class template CachingBatchVisitor
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  ResultCache<Ctype, CresultData>::ResultCache(double resolution,
+      size_t budget, size_t num_shards) : Mresolution(resolution),
+    MshardBudget(0), Mhits(0), Mmisses(0), Mevictions(0)
+  {
+    OPTIMIZE_assert(0 < resolution, "Illegal resolution.");
+    if (0 == num_shards) { num_shards = 1; }
+    MshardBudget = budget / num_shards;
+    for (size_t i = 0; i < num_shards; ++i)
+    {
+      Mshards.push_back(std::unique_ptr<Shard>(new Shard));
+    }
+  } // constructor ResultCache<Ctype, CresultData>
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  bool ResultCache<Ctype, CresultData>::lookup(Ctype const* coordinates,
+      size_t const dimensions, CresultData& data)
+  {
+    Tkey key;
+    quantize(coordinates, dimensions, key);
+    Shard& shard = getShard(key);
+    {
+      boost::lock_guard<boost::mutex> lock(shard.Mmutex);
+      auto it(shard.Mindex.find(key));
+      if (shard.Mindex.end() != it)
+      {
+        // most recently used
+        shard.Mentries.splice(shard.Mentries.begin(), shard.Mentries,
+            it->second);
+        data = it->second->second;
+        ++Mhits;
+        return true;
+      }
+    }
+    ++Mmisses;
+    return false;
+  } // function ResultCache<Ctype, CresultData>::lookup
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void ResultCache<Ctype, CresultData>::insert(Ctype const* coordinates,
+      size_t const dimensions, CresultData const& data)
+  {
+    size_t const entry_size = getEntrySize(dimensions);
+    if (entry_size > MshardBudget) { return; }
+
+    Tkey key;
+    quantize(coordinates, dimensions, key);
+    Shard& shard = getShard(key);
+    boost::lock_guard<boost::mutex> lock(shard.Mmutex);
+    auto it(shard.Mindex.find(key));
+    if (shard.Mindex.end() != it)
+    {
+      it->second->second = data;
+      shard.Mentries.splice(shard.Mentries.begin(), shard.Mentries,
+          it->second);
+      return;
+    }
+    // evict least recently used entries
+    while (shard.Musage + entry_size > MshardBudget)
+    {
+      shard.Musage -= getEntrySize(shard.Mentries.back().first.size());
+      shard.Mindex.erase(shard.Mentries.back().first);
+      shard.Mentries.pop_back();
+      ++Mevictions;
+    }
+    shard.Mentries.push_front(std::make_pair(key, data));
+    shard.Mindex.insert(std::make_pair(std::move(key),
+          shard.Mentries.begin()));
+    shard.Musage += entry_size;
+  } // function ResultCache<Ctype, CresultData>::insert
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void ResultCache<Ctype, CresultData>::clear()
+  {
+    for (auto it(Mshards.begin()); it != Mshards.end(); ++it)
+    {
+      boost::lock_guard<boost::mutex> lock((*it)->Mmutex);
+      (*it)->Mindex.clear();
+      (*it)->Mentries.clear();
+      (*it)->Musage = 0;
+    }
+  } // function ResultCache<Ctype, CresultData>::clear
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  size_t ResultCache<Ctype, CresultData>::size() const
+  {
+    size_t retval = 0;
+    for (auto cit(Mshards.cbegin()); cit != Mshards.cend(); ++cit)
+    {
+      boost::lock_guard<boost::mutex> lock((*cit)->Mmutex);
+      retval += (*cit)->Mindex.size();
+    }
+    return retval;
+  } // function ResultCache<Ctype, CresultData>::size
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void ResultCache<Ctype, CresultData>::quantize(Ctype const* coordinates,
+      size_t const dimensions, Tkey& key) const
+  {
+    key.resize(dimensions);
+    for (size_t i = 0; i < dimensions; ++i)
+    {
+      key[i] = std::llround(static_cast<double>(coordinates[i])/Mresolution);
+    }
+  } // function ResultCache<Ctype, CresultData>::quantize
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  typename ResultCache<Ctype, CresultData>::Shard&
+  ResultCache<Ctype, CresultData>::getShard(Tkey const& key)
+  {
+    return *Mshards[KeyHash()(key) % Mshards.size()];
+  } // function ResultCache<Ctype, CresultData>::getShard
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  size_t ResultCache<Ctype, CresultData>::getEntrySize(
+      size_t const dimensions)
+  {
+    // list node, hash node and both copies of the key
+    return sizeof(typename Tentries::value_type) + sizeof(Tkey) +
+      sizeof(typename Tentries::iterator) + 4*sizeof(void*) +
+      2*dimensions*sizeof(long long);
+  } // function ResultCache<Ctype, CresultData>::getEntrySize
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void CachingVisitor<Ctype, CresultData>::operator()(
+      Node<Ctype, CresultData>* node)
+  {
+    CresultData data;
+    if (Mcache.lookup(node->getCoordinateData(), node->getDimensions(),
+          data))
+    {
+      node->setResultData(data);
+      return;
+    }
+    Mapp(node);
+    Mcache.insert(node->getCoordinateData(), node->getDimensions(),
+        node->getResultData());
+  } // function CachingVisitor<Ctype, CresultData>::operator()
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  CachingVisitor<Ctype, CresultData>::clone() const
+  {
+    std::unique_ptr<Tbase> app(Mapp.clone());
+    // the decorated application is shared by the workers if not cloneable
+    if (! app) { return std::unique_ptr<Tbase>(); }
+    return std::unique_ptr<Tbase>(
+        new CachingVisitor<Ctype, CresultData>(std::move(app), Mcache));
+  } // function CachingVisitor<Ctype, CresultData>::clone
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void CachingVisitor<Ctype, CresultData>::merge(Tbase& clone)
+  {
+    Mapp.merge(static_cast<CachingVisitor<Ctype, CresultData>&>(clone).Mapp);
+  } // function CachingVisitor<Ctype, CresultData>::merge
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void CachingBatchVisitor<Ctype, CresultData>::operator()(
+      CoordinateBlock<Ctype, CresultData> const& block)
+  {
+    size_t const size = block.getSize();
+    size_t const dims = block.getDimensions();
+    CresultData* const results = block.getResults();
+    std::vector<Ctype> coordinates(dims);
+    // grid points missing in the cache
+    std::vector<size_t> misses;
+    for (size_t i = 0; i < size; ++i)
+    {
+      for (size_t d = 0; d < dims; ++d)
+      {
+        coordinates[d] = block.getColumn(d)[i];
+      }
+      if (! Mcache.lookup(coordinates.data(), dims, results[i]))
+      {
+        misses.push_back(i);
+      }
+    }
+    if (misses.empty()) { return; }
+
+    if (misses.size() == size)
+    {
+      Mapp(block);
+    } else
+    {
+      BlockBuffer<Ctype, CresultData> buffer(dims, misses.size());
+      for (size_t d = 0; d < dims; ++d)
+      {
+        Ctype const* const column = block.getColumn(d);
+        for (size_t i = 0; i < misses.size(); ++i)
+        {
+          buffer.getColumn(d)[i] = column[misses[i]];
+        }
+      }
+      Mapp(buffer.getBlock(misses.size()));
+      for (size_t i = 0; i < misses.size(); ++i)
+      {
+        results[misses[i]] = buffer.getResults()[i];
+      }
+    }
+    for (size_t i = 0; i < misses.size(); ++i)
+    {
+      for (size_t d = 0; d < dims; ++d)
+      {
+        coordinates[d] = block.getColumn(d)[misses[i]];
+      }
+      Mcache.insert(coordinates.data(), dims, results[misses[i]]);
+    }
+  } // function CachingBatchVisitor<Ctype, CresultData>::operator()
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>
+  CachingBatchVisitor<Ctype, CresultData>::clone() const
+  {
+    std::unique_ptr<Tvisitor> app(Mapp.clone());
+    // the decorated application is shared by the workers if not cloneable
+    if (! app) { return std::unique_ptr<Tvisitor>(); }
+    Tbase* batch = dynamic_cast<Tbase*>(app.get());
+    OPTIMIZE_assert(batch, "Clone is not a batch application.");
+    return std::unique_ptr<Tvisitor>(
+        new CachingBatchVisitor<Ctype, CresultData>(*batch, std::move(app),
+          Mcache));
+  } // function CachingBatchVisitor<Ctype, CresultData>::clone
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF resultcache.h  ----- */
@@ -0,0 +1,346 @@
+/*! \file sampling.h
+ * \brief Space-filling point sequences within the unit hypercube.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Space-filling point sequences within the unit hypercube (Latin
+ * hypercube, Halton and Sobol sequences) used by the Monte Carlo
+ * algorithm to sample the parameter space per dimension.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_SAMPLING_H_
+#define _OPTIMIZEXX_SAMPLING_H_
+
+namespace optimize
+{
+  /* ======================================================================= */
+  /*!
+   * Abstract base class of a sequence of points within the unit hypercube
+   * [0,1)^d. Note that the strategy design pattern is in use.
+   *
+   * \ingroup group_global_algos
+   */
+  class PointSequence
+  {
+    public:
+      //! destructor
+      virtual ~PointSequence() { }
+      /*!
+       * generate the next point of the sequence
+       *
+       * \param point coordinates of the point - resized to the dimension
+       */
+      virtual void next(std::vector<double>& point) = 0;
+      //! query function for the dimension of the points
+      size_t getDimension() const { return Mdimension; }
+
+    protected:
+      //! constructor
+      explicit PointSequence(size_t const dimension) : Mdimension(dimension)
+      {
+        OPTIMIZE_assert(0 < dimension, "Illegal dimension.");
+      }
+
+    protected:
+      //! dimension of the points
+      size_t Mdimension;
+
+  }; // class PointSequence
+
+  /* ======================================================================= */
+  /*!
+   * Latin hypercube sampling. The points are generated in batches. Each
+   * dimension of a batch of \c n points is divided into \c n strata of equal
+   * width so that each stratum contains exactly one point of the batch. The
+   * strata are combined by random permutations.
+   *
+   * \ingroup group_global_algos
+   */
+  class LatinHypercubeSequence : public PointSequence
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param dimension dimension of the points
+       * \param batch number of points of a batch
+       * \param seed seed of the random number stream
+       */
+      LatinHypercubeSequence(size_t const dimension, size_t const batch,
+          unsigned int const seed);
+      //! generate the next point of the sequence
+      virtual void next(std::vector<double>& point);
+      /*!
+       * Set the number of points of the subsequent batches. The current
+       * batch is discarded.
+       */
+      void setBatchSize(size_t const batch);
+
+    private:
+      //! draw the permutations of a batch
+      void drawBatch();
+
+    private:
+      //! random number engine
+      std::mt19937 Mengine;
+      //! number of points of a batch
+      size_t Mbatch;
+      //! index of the next point within the batch
+      size_t Mindex;
+      //! permutations of the strata - one for each dimension
+      std::vector<std::vector<size_t>> Mstrata;
+
+  }; // class LatinHypercubeSequence
+
+  /* ======================================================================= */
+  /*!
+   * Halton sequence. Dimension \c k makes use of the radical inverse in
+   * base of the k-th prime number. The point with index zero is skipped.
+   *
+   * \ingroup group_global_algos
+   */
+  class HaltonSequence : public PointSequence
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param dimension dimension of the points
+       */
+      explicit HaltonSequence(size_t const dimension);
+      //! generate the next point of the sequence
+      virtual void next(std::vector<double>& point);
+
+    private:
+      //! bases of the dimensions
+      std::vector<unsigned int> Mbases;
+      //! index of the next point
+      std::uint64_t Mindex;
+
+  }; // class HaltonSequence
+
+  /* ======================================================================= */
+  /*!
+   * Sobol sequence generated in Gray code order (Antonov and Saleev) by
+   * means of the direction numbers of Joe and Kuo. The point with index zero
+   * is skipped.
+   *
+   * \note At most getMaxDimension() dimensions and 2^32 points are
+   * supported.
+   *
+   * \ingroup group_global_algos
+   */
+  class SobolSequence : public PointSequence
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param dimension dimension of the points
+       */
+      explicit SobolSequence(size_t const dimension);
+      //! generate the next point of the sequence
+      virtual void next(std::vector<double>& point);
+      //! query function for the maximum number of dimensions supported
+      static size_t getMaxDimension() { return 16; }
+
+    private:
+      //! number of bits of the direction numbers
+      static size_t const Mbits = 32;
+      //! direction numbers - Mbits for each dimension
+      std::vector<std::uint32_t> Mdirections;
+      //! current point
+      std::vector<std::uint32_t> Mpoint;
+      //! index of the current point
+      std::uint32_t Mindex;
+
+  }; // class SobolSequence
+
+  /* ======================================================================= */
+  inline LatinHypercubeSequence::LatinHypercubeSequence(
+      size_t const dimension, size_t const batch, unsigned int const seed) :
+    PointSequence(dimension), Mbatch(std::max<size_t>(1, batch)), Mindex(0),
+    Mstrata(dimension)
+  {
+    std::seed_seq seq{static_cast<std::uint_least32_t>(seed),
+      static_cast<std::uint_least32_t>(dimension)};
+    Mengine.seed(seq);
+    drawBatch();
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline void LatinHypercubeSequence::setBatchSize(size_t const batch)
+  {
+    Mbatch = std::max<size_t>(1, batch);
+    drawBatch();
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline void LatinHypercubeSequence::drawBatch()
+  {
+    for (auto it(Mstrata.begin()); it != Mstrata.end(); ++it)
+    {
+      it->resize(Mbatch);
+      for (size_t i = 0; i < Mbatch; ++i) { (*it)[i] = i; }
+      // Fisher-Yates shuffle - independent of the STL implementation
+      for (size_t i = Mbatch-1; i > 0; --i)
+      {
+        std::uniform_int_distribution<size_t> pick(0, i);
+        std::swap((*it)[i], (*it)[pick(Mengine)]);
+      }
+    }
+    Mindex = 0;
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline void LatinHypercubeSequence::next(std::vector<double>& point)
+  {
+    if (Mindex == Mbatch) { drawBatch(); }
+    point.resize(Mdimension);
+    std::uniform_real_distribution<double> jitter(0., 1.);
+    for (size_t d = 0; d < Mdimension; ++d)
+    {
+      point[d] = (Mstrata[d][Mindex] + jitter(Mengine)) / Mbatch;
+      // guard against rounding up to one
+      if (1. <= point[d]) { point[d] = std::nextafter(1., 0.); }
+    }
+    ++Mindex;
+  }
+
+  /* ======================================================================= */
+  inline HaltonSequence::HaltonSequence(size_t const dimension) :
+    PointSequence(dimension), Mindex(1)
+  {
+    // the first primes
+    for (unsigned int n = 2; Mbases.size() < dimension; ++n)
+    {
+      bool prime = true;
+      for (auto cit(Mbases.cbegin()); cit != Mbases.cend() && prime; ++cit)
+      {
+        prime = 0 != n % *cit;
+      }
+      if (prime) { Mbases.push_back(n); }
+    }
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline void HaltonSequence::next(std::vector<double>& point)
+  {
+    point.resize(Mdimension);
+    for (size_t d = 0; d < Mdimension; ++d)
+    {
+      // radical inverse of the index
+      double const inv_base = 1./Mbases[d];
+      double factor = inv_base;
+      double value = 0;
+      for (std::uint64_t i = Mindex; i > 0; i /= Mbases[d])
+      {
+        value += (i % Mbases[d]) * factor;
+        factor *= inv_base;
+      }
+      point[d] = value;
+    }
+    ++Mindex;
+  }
+
+  /* ======================================================================= */
+  inline SobolSequence::SobolSequence(size_t const dimension) :
+    PointSequence(dimension), Mdirections(dimension*Mbits),
+    Mpoint(dimension, 0), Mindex(0)
+  {
+    OPTIMIZE_assert(dimension <= getMaxDimension(),
+        "Dimension not supported by the Sobol sequence.");
+    // direction numbers of Joe and Kuo for the dimensions 2 to 16: degree s
+    // and coefficients a of the primitive polynomial, initial values m
+    static unsigned int const s[] = { 1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 6,
+      6, 6 };
+    static unsigned int const a[] = { 0, 1, 1, 2, 1, 4, 2, 4, 7, 11, 13, 14,
+      1, 13, 16 };
+    static unsigned int const m[][6] = { {1}, {1,3}, {1,3,1}, {1,1,1},
+      {1,1,3,3}, {1,3,5,13}, {1,1,5,5,17}, {1,1,5,5,5}, {1,1,7,11,19},
+      {1,1,5,1,1}, {1,1,1,3,11}, {1,3,5,5,31}, {1,3,3,9,7,49},
+      {1,1,1,15,21,21}, {1,3,1,13,27,49} };
+
+    // first dimension: van der Corput sequence in base two
+    for (size_t j = 0; j < Mbits; ++j)
+    {
+      Mdirections[j] = std::uint32_t(1) << (Mbits-1-j);
+    }
+    for (size_t d = 1; d < dimension; ++d)
+    {
+      std::uint32_t* const v = &Mdirections[d*Mbits];
+      size_t const deg = s[d-1];
+      for (size_t j = 0; j < Mbits; ++j)
+      {
+        if (j < deg)
+        {
+          v[j] = std::uint32_t(m[d-1][j]) << (Mbits-1-j);
+          continue;
+        }
+        v[j] = v[j-deg] ^ (v[j-deg] >> deg);
+        for (size_t k = 1; k < deg; ++k)
+        {
+          if ((a[d-1] >> (deg-1-k)) & 1) { v[j] ^= v[j-k]; }
+        }
+      }
+    }
+  }
+
+  /* ----------------------------------------------------------------------- */
+  inline void SobolSequence::next(std::vector<double>& point)
+  {
+    OPTIMIZE_assert(Mindex != ~std::uint32_t(0),
+        "Sobol sequence exhausted.");
+    // index of the rightmost zero bit of the index (Gray code)
+    size_t c = 0;
+    for (std::uint32_t i = Mindex; i & 1; i >>= 1) { ++c; }
+    ++Mindex;
+    point.resize(Mdimension);
+    for (size_t d = 0; d < Mdimension; ++d)
+    {
+      Mpoint[d] ^= Mdirections[d*Mbits+c];
+      point[d] = Mpoint[d] / 4294967296.;
+    }
+  }
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF sampling.h  ----- */
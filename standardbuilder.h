@@ -31,6 +31,14 @@
  * REVISIONS and CHANGES 
  * 29/02/2012   V0.1    Daniel Armbruster
  * 25/04/2012   V0.2    Make use of smart pointers and C++0x.
+ * 14/10/2026   V0.3    Support subgrids.
+ * 14/10/2026   V0.4    Allocate grid components from an arena.
+ * 14/10/2026   V0.5    Add nodes in bulk.
+ * 14/10/2026   V0.6    Parallel construction of nodes.
+ * 14/10/2026   V0.7    Nodes of fixed dimension.
+ * 14/10/2026   V0.8    Incremental rebuild of the grid.
+ * 14/10/2026   V0.9    Reuse arena memory of nodes dropped by a rebuild.
+ * 14/10/2026   V0.10   Parallel construction on a persistent thread pool.
  * 
  * ============================================================================
  */
@@ -39,11 +47,19 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
 #include <cstdlib>
 #include <cmath>
 #include <optimizexx/builder.h>
 #include <optimizexx/grid.h>
 #include <optimizexx/node.h>
+#include <optimizexx/fixednode.h>
+#include <optimizexx/arena.h>
+#include <optimizexx/application.h>
+#include <optimizexx/threadpool.h>
+#include <optimizexx/progress.h>
 #include <optimizexx/error.h>
  
 #ifndef _OPTIMIZEXX_STANDARDBUILDER_H_
@@ -55,35 +71,138 @@ namespace optimize
   template <typename Ctype, typename CresultData> class GridComponent;
   template <typename Ctype> class Parameter;
 
+  namespace thread
+  {
+    /* ===================================================================== */
+    /*!
+     * Thread pool task constructing the nodes of a range of linear indices
+     * of a grid. The first coordinate varies fastest. Nodes are written to
+     * pre-sized storage so that tasks do not need any synchronization.
+     * Nodes are of type optimize::NodeType<Ctype, CresultData, Cdim>::Tnode.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData, size_t Cdim=0>
+    class NodeBuildTask : public Task<Ctype, CresultData>
+    {
+      public:
+        //! typedef for the samples of a dimension
+        typedef typename std::vector<Ctype> Tsamples;
+        //! node type
+        typedef typename NodeType<Ctype, CresultData, Cdim>::Tnode Tnode;
+
+      public:
+        /*!
+         * constructor
+         *
+         * \param samples samples of each dimension
+         * \param nodes storage of the node pointers of all indices
+         * \param memory memory for the nodes of all indices allocated from an
+         * arena - if null nodes are allocated by \c new
+         * \param first first linear index
+         * \param last linear index past the last node
+         */
+        NodeBuildTask(std::vector<Tsamples> const& samples,
+            GridComponent<Ctype, CresultData>** nodes, void* memory,
+            size_t first, size_t last) : Msamples(samples), Mnodes(nodes),
+            Mmemory(static_cast<Tnode*>(memory)),
+            Mfirst(first), Mlast(last)
+        { }
+        //! destructor
+        virtual ~NodeBuildTask() { }
+        //! construct the nodes - the application is not applied
+        virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app);
+
+      private:
+        //! samples of each dimension
+        std::vector<Tsamples> const& Msamples;
+        //! node pointers
+        GridComponent<Ctype, CresultData>** Mnodes;
+        //! memory of the nodes
+        Tnode* Mmemory;
+        //! first linear index
+        size_t Mfirst;
+        //! linear index past the last node
+        size_t Mlast;
+
+    }; // class template NodeBuildTask
+
+    /* ===================================================================== */
+    template <typename Ctype, typename CresultData, size_t Cdim>
+    void NodeBuildTask<Ctype, CresultData, Cdim>::execute(
+        ParameterSpaceVisitor<Ctype, CresultData>& app)
+    {
+      typename Node<Ctype, CresultData>::Tcoordinates coordinates(
+          Msamples.size());
+      for (size_t i = Mfirst; i < Mlast; ++i)
+      {
+        size_t rest = i;
+        for (size_t d = 0; d < Msamples.size(); ++d)
+        {
+          coordinates[d] = Msamples[d][rest % Msamples[d].size()];
+          rest /= Msamples[d].size();
+        }
+        Mnodes[i] = Mmemory ?
+          GridComponent<Ctype, CresultData>::template construct<Tnode>(
+              Mmemory+i, coordinates) :
+          new Tnode(coordinates);
+      }
+    } // function NodeBuildTask<Ctype, CresultData>::execute
+
+  } // namespace thread
+
   /* ======================================================================= */
   /*!
    * Concrete builder class template for a standard parameter space. Note, that
    * here the builder design pattern is in use (GoF p.97).
    *
-   * This builder builds a usual grid only consisting of nodes without the
-   * opportunity to add a subgrid to this grid.\n
+   * This builder builds a usual grid consisting of nodes. Subgrids of nodes
+   * might be added to the grid or to its subgrids afterwards.\n
    *
    * Additionally the builder design pattern is in use (GoF p.151). The abstract
    * class template optimize::ParameterSpaceBuilder corresponds to \c
-   * RefinedAbstraction in GoF.
+   * RefinedAbstraction in GoF.\n
+   *
+   * Nodes and subgrids are allocated from the arena of the grid they are
+   * added to. The root grid owns the arena so that tearing down the
+   * parameter space releases the memory of the components in bulk. The
+   * arena is created by the factory method createArena().\n
+   *
+   * If a number of threads is passed the nodes of a grid are constructed in
+   * parallel by means of the \a liboptimizexx thread pool. The linear index
+   * range of the grid is split across the workers which write the nodes to
+   * pre-sized storage. Nodes are added to the grid in bulk afterwards.\n
+   *
+   * If the dimension \c Cdim of the parameter space is known at compile
+   * time the builder creates optimize::FixedNode nodes storing their
+   * coordinates inline. A dimension of zero (default) creates usual nodes.
    *
    * \ingroup group_builder
    */
-  template<typename Ctype, typename CresultData>
+  template<typename Ctype, typename CresultData, size_t Cdim=0>
   class StandardParameterSpaceBuilder : 
       public ParameterSpaceBuilder<Ctype, CresultData>
   {
     public:
       typedef ParameterSpaceBuilder<Ctype, CresultData> Tbase;
       typedef typename Tbase::Tcomponent Tcomponent;
+      //! node type
+      typedef typename NodeType<Ctype, CresultData, Cdim>::Tnode Tnode;
 
     public:
-      //! constructor
+      /*!
+       * constructor
+       *
+       * \param num_threads Number of threads the builder uses for parallel
+       * construction of the nodes. If zero nodes are constructed by the
+       * calling thread.
+       */
 #if __GNUC__ >= 4 && __GNUC_MINOR__ >= 6
-      StandardParameterSpaceBuilder() : Tbase(nullptr)
+      StandardParameterSpaceBuilder(size_t num_threads=0) : Tbase(nullptr),
 #else
-      StandardParameterSpaceBuilder()
+      StandardParameterSpaceBuilder(size_t num_threads=0) :
 #endif
+        MnumThreads(num_threads)
       { }
       /*!
        * query function for order of parameters the builder will generate the
@@ -104,6 +223,50 @@ namespace optimize
       virtual void buildGrid(
           typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
           parameters);
+      /*!
+       * Build a \c N dimensional subgrid where \c N is the size of the
+       * parameter vector passed and add it to the parameter space.
+       *
+       * \param parameters Parameters of the subgrid.
+       */
+      virtual void buildSubGrid(
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters);
+      /*!
+       * Build a \c N dimensional subgrid where \c N is the size of the
+       * parameter vector passed and add it to \c grid.
+       *
+       * \param grid grid the subgrid will be added to
+       * \param parameters Parameters of the subgrid.
+       */
+      virtual void buildSubGrid(GridComponent<Ctype, CresultData>* grid,
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters);
+      /*!
+       * Rebuild the grid of a parameter space built by this builder after
+       * its parameters had been changed. The nodes of the grid are arranged
+       * in the order a fresh grid would have been built. A node is kept if
+       * each of its coordinates matches a sample of the corresponding new
+       * parameter up to a millionth of the sample interval. Subgrids are
+       * kept and follow the nodes. New nodes are constructed by the calling
+       * thread.\n
+       * If the grid allocates its nodes from an arena, the memory of each
+       * node dropped is handed back to the arena (see
+       * optimize::GridComponent::recycle) and reused by the nodes missing.
+       * Thus a grid rebuilt repeatedly (e.g. by a range moving along a
+       * parameter axis) does not grow its optimize::MonotonicArena beyond
+       * the largest number of nodes it ever held.
+       *
+       * \param parameterspace parameter space to be rebuilt
+       * \param parameters new parameters of the parameter space
+       *
+       * \return false if the dimension or the coordinate ids of the
+       * parameters differ from the ones of the parameter space
+       */
+      virtual bool rebuildGrid(
+          GridComponent<Ctype, CresultData>* parameterspace,
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters);
       //! destructor
       virtual ~StandardParameterSpaceBuilder() { }
       /*!
@@ -114,20 +277,113 @@ namespace optimize
        */
       virtual typename
         std::unique_ptr<GridComponent<Ctype, CresultData>> getParameterSpace();
+      //! Set the number of threads used to construct the nodes.
+      void setNumThreads(size_t num_threads) { MnumThreads = num_threads; }
+      //! query function for the number of threads
+      size_t getNumThreads() const { return MnumThreads; }
+      /*!
+       * Construct the nodes on a persistent thread pool (e.g. the one of the
+       * global algorithm, see optimize::GlobalAlgorithm::setThreadPool)
+       * instead of a pool created for each build. If set, nodes are
+       * constructed in parallel even if the number of threads is zero.
+       *
+       * \param pool initialized thread pool constructed without an
+       * application - empty to create a thread pool per build
+       */
+      virtual void setThreadPool(
+          std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> pool)
+      {
+        OPTIMIZE_assert(! pool || pool->isInitialized(),
+            "Thread pool not initialized.");
+        MthreadPool = pool;
+      }
+      //! query function for the persistent thread pool
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>>
+        getThreadPool() const { return MthreadPool; }
+
+    protected:
+      /*!
+       * Factory method (GoF p.107) creating the arena of a parameter space.
+       * By default a optimize::MonotonicArena is created. Overload this
+       * function to plug in a different arena. Returning an empty pointer
+       * makes the builder allocate grid components by \c new.
+       *
+       * \return arena
+       */
+      virtual std::shared_ptr<Arena> createArena() const
+      {
+        return std::shared_ptr<Arena>(new MonotonicArena);
+      }
+
+    private:
+      /*!
+       * query function for the coordinate ids of a grid
+       *
+       * \param parameters Parameters of the grid.
+       * \return coordinate ids
+       */
+      std::vector<std::string> getCoordinateIds(
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters) const;
+      /*!
+       * Generate the samples of the parameters.
+       *
+       * \param parameters Parameters of the grid.
+       * \return samples of each dimension
+       */
+      std::vector<Tcomponent> getSamples(
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters) const;
+      /*!
+       * Add the nodes spanned by the parameters to a grid.
+       *
+       * \param grid grid the nodes will be added to
+       * \param parameters Parameters of the grid.
+       */
+      void buildNodes(GridComponent<Ctype, CresultData>* grid,
+          typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+          parameters);
+      /*!
+       * Construct the nodes of a grid in parallel and add them to the grid.
+       * The nodes are constructed by a job of the persistent thread pool if
+       * set and by a thread pool created for the build otherwise.
+       *
+       * \param grid grid the nodes will be added to
+       * \param components samples of each dimension
+       */
+      void buildNodesParallel(GridComponent<Ctype, CresultData>* grid,
+          std::vector<Tcomponent> const& components);
+
+    private:
+      //! application of the thread pool - does nothing
+      class NullApplication : public ParameterSpaceVisitor<Ctype, CresultData>
+      {
+        public:
+          virtual void operator()(Grid<Ctype, CresultData>* grid) { }
+          virtual void operator()(Node<Ctype, CresultData>* node) { }
+      }; // class NullApplication
+
+    private:
+      //! number of threads used to construct the nodes
+      size_t MnumThreads;
+      //! persistent thread pool (optional)
+      std::shared_ptr<thread::ThreadPool<Ctype, CresultData>> MthreadPool;
 
   }; // class StandardParameterSpaceBuilder
 
   /* ======================================================================= */
-  template<typename Ctype, typename CresultData> 
-  void StandardParameterSpaceBuilder<Ctype, CresultData>::buildParameterSpace()
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  void
+  StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::buildParameterSpace()
   {
-    Tbase::MparameterSpace.reset(new Grid<Ctype, CresultData>); 
+    Tbase::MparameterSpace.reset(
+        new Grid<Ctype, CresultData>(createArena()));
   }
 
   /* ----------------------------------------------------------------------- */
-  template<typename Ctype, typename CresultData> 
+  template<typename Ctype, typename CresultData, size_t Cdim> 
   std::vector<int> 
-  StandardParameterSpaceBuilder<Ctype, CresultData>::getParameterOrder(
+  StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::getParameterOrder(
       size_t const dims) const
   {
     std::vector<int> retval(dims);
@@ -136,17 +392,142 @@ namespace optimize
   } // function StandardParameterSpaceBuilder::getParameterOrder
 
   /* ----------------------------------------------------------------------- */
-  template<typename Ctype, typename CresultData> 
-  void StandardParameterSpaceBuilder<Ctype, CresultData>::buildGrid(
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  void StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::buildGrid(
       typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
       parameters)
   {
-    size_t dimension = parameters.size();      
+    buildNodes(Tbase::MparameterSpace.get(), parameters);
+  }
 
-    // coordinate ids of parameter space
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  void StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::buildSubGrid(
+      typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+      parameters)
+  {
+    OPTIMIZE_assert(Tbase::MparameterSpace, "Missing parameter space.");
+    buildSubGrid(Tbase::MparameterSpace.get(), parameters);
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  void StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::buildSubGrid(
+      GridComponent<Ctype, CresultData>* grid,
+      typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+      parameters)
+  {
+    OPTIMIZE_assert(0 != grid, "Missing grid.");
+    // the subgrid shares the arena of its parent
+    std::shared_ptr<Arena> const arena(grid->getArena());
+    Grid<Ctype, CresultData>* subgrid = arena ?
+      GridComponent<Ctype, CresultData>::template create<
+        Grid<Ctype, CresultData>>(*arena, arena) :
+      new Grid<Ctype, CresultData>;
+    grid->add(subgrid);
+    buildNodes(subgrid, parameters);
+  }
+
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  bool StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::rebuildGrid(
+      GridComponent<Ctype, CresultData>* parameterspace,
+      typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+      parameters)
+  {
+    OPTIMIZE_assert(0 != parameterspace, "Missing parameter space.");
+    Grid<Ctype, CresultData>* grid =
+      dynamic_cast<Grid<Ctype, CresultData>*>(parameterspace);
+    size_t const dimension = parameters.size();
+    if (! grid || (Cdim != 0 && Cdim != dimension) ||
+        grid->getCoordinateId() != getCoordinateIds(parameters))
+    {
+      return false;
+    }
+    Arena* const arena = grid->getArena().get();
+
+    std::vector<Tcomponent> const components(getSamples(parameters));
+    size_t num = 1;
+    for (auto cit(components.cbegin()); cit != components.cend(); ++cit)
+    {
+      num *= cit->size();
+    }
+
+    // sort the nodes kept by their linear index of the new grid
+    std::vector<GridComponent<Ctype, CresultData>*> children;
+    grid->releaseChildren(children);
+    std::vector<GridComponent<Ctype, CresultData>*> nodes(num, 0);
+    std::vector<GridComponent<Ctype, CresultData>*> subgrids;
+    for (auto cit(children.cbegin()); cit != children.cend(); ++cit)
+    {
+      if (GridComponent<Ctype, CresultData>::Composite ==
+          (*cit)->getComponentType())
+      {
+        subgrids.push_back(*cit);
+        continue;
+      }
+      Node<Ctype, CresultData> const* node =
+        static_cast<Node<Ctype, CresultData> const*>(*cit);
+      Ctype const* const coordinates = node->getCoordinateData();
+      // linear index of the node within the new grid
+      bool sample = node->getDimensions() == dimension;
+      size_t index = 0;
+      size_t stride = 1;
+      for (size_t d = 0; d < dimension && sample; ++d)
+      {
+        double const delta = parameters[d]->getDelta();
+        long const s = std::lround(
+            (coordinates[d] - components[d][0]) / delta);
+        sample = 0 <= s && static_cast<size_t>(s) < components[d].size() &&
+          std::fabs(coordinates[d] - components[d][s]) <=
+          1e-6 * std::fabs(delta);
+        index += s*stride;
+        stride *= components[d].size();
+      }
+      if (sample && ! nodes[index])
+      {
+        nodes[index] = *cit;
+      } else if (arena)
+      {
+        GridComponent<Ctype, CresultData>::template recycle<Tnode>(*cit,
+            *arena);
+      } else
+      {
+        GridComponent<Ctype, CresultData>::destroy(*cit);
+      }
+    }
+
+    // construct the nodes missing
+    typename Node<Ctype, CresultData>::Tcoordinates coordinates(dimension);
+    for (size_t i = 0; i < num; ++i)
+    {
+      if (nodes[i]) { continue; }
+      size_t rest = i;
+      for (size_t d = 0; d < dimension; ++d)
+      {
+        coordinates[d] = components[d][rest % components[d].size()];
+        rest /= components[d].size();
+      }
+      nodes[i] = arena ?
+        GridComponent<Ctype, CresultData>::template create<Tnode>(
+            *arena, coordinates) :
+        new Tnode(coordinates);
+    }
+    grid->addRange(nodes.data(), nodes.data()+nodes.size());
+    grid->addRange(subgrids.data(), subgrids.data()+subgrids.size());
+    return true;
+  } // function StandardParameterSpaceBuilder::rebuildGrid
+
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  std::vector<std::string>
+  StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::getCoordinateIds(
+      typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+      parameters) const
+  {
     std::vector<std::string> coordIds;
-    coordIds.reserve(dimension);
-  for (auto cit(parameters.cbegin()); cit != parameters.cend(); ++cit)
+    coordIds.reserve(parameters.size());
+    for (auto cit(parameters.cbegin()); cit != parameters.cend(); ++cit)
     {
       OPTIMIZE_assert((*cit)->isValid(), "Invalid parameter");
       if (! (*cit)->getId().empty())
@@ -157,11 +538,19 @@ namespace optimize
         coordIds.push_back("Unkown");
       }
     }
-    Tbase::MparameterSpace->setCoordinateId(coordIds);
+    return coordIds;
+  } // function StandardParameterSpaceBuilder::getCoordinateIds
 
-    // generate parameter vectors
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  std::vector<typename StandardParameterSpaceBuilder<Ctype, CresultData,
+    Cdim>::Tcomponent>
+  StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::getSamples(
+      typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+      parameters) const
+  {
     typename std::vector<Tcomponent> components;
-    components.reserve(dimension);
+    components.reserve(parameters.size());
 
     for (auto cit(parameters.cbegin()); cit != parameters.cend(); ++cit)
     {
@@ -180,7 +569,33 @@ namespace optimize
       }
 
       components.push_back(component);
-      component.clear();
+    }
+    return components;
+  } // function StandardParameterSpaceBuilder::getSamples
+
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  void StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::buildNodes(
+      GridComponent<Ctype, CresultData>* grid,
+      typename std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+      parameters)
+  {
+    size_t dimension = parameters.size();      
+    OPTIMIZE_assert(Cdim == 0 || Cdim == dimension,
+        "Dimension of parameter space does not match node dimension.");
+    Arena* const arena = grid->getArena().get();
+
+    // coordinate ids of parameter space
+    grid->setCoordinateId(getCoordinateIds(parameters));
+
+    // generate parameter vectors
+    typename std::vector<Tcomponent> const components(
+        getSamples(parameters));
+
+    if (0 != MnumThreads || MthreadPool)
+    {
+      buildNodesParallel(grid, components);
+      return;
     }
 
     // vector of component iterators
@@ -190,21 +605,32 @@ namespace optimize
       typename Tcomponent::const_iterator i(cit->begin());
       iterators.push_back(i);
     }
+    // nodes of a row (first coordinate varies) - added in bulk
+    std::vector<GridComponent<Ctype, CresultData>*> row;
+    row.reserve(components[0].size());
+    // coordinates of a node - copied by the node
+    Tcomponent coordinates;
+    coordinates.reserve(dimension);
     // add nodes to grid - generate all possible combinations of coordinates
     while (true)
     {
       // generate node
+      row.clear();
       while (iterators[0] != components[0].end())
       {
-        Tcomponent coordinates;
+        coordinates.clear();
         for (auto cit(iterators.cbegin()); cit != iterators.cend(); ++cit)
         {
           coordinates.push_back(**cit);
         }
 
-        Tbase::MparameterSpace->add(new Node<Ctype,CresultData>(coordinates));
+        row.push_back(arena ?
+            GridComponent<Ctype, CresultData>::template create<Tnode>(
+              *arena, coordinates) :
+            new Tnode(coordinates));
         ++iterators[0];
       }
+      grid->addRange(row.data(), row.data()+row.size());
       // reset
       iterators[0] = components[0].begin();
 
@@ -218,12 +644,57 @@ namespace optimize
       }
       if (components.size() == k) { break; }
     }
-  } // function StandardParameterSpaceBuilder<Ctype, CresultData>::buildGrid 
+  } // function StandardParameterSpaceBuilder<Ctype, CresultData>::buildNodes
+
+  /* ----------------------------------------------------------------------- */
+  template<typename Ctype, typename CresultData, size_t Cdim> 
+  void
+  StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::buildNodesParallel(
+      GridComponent<Ctype, CresultData>* grid,
+      std::vector<Tcomponent> const& components)
+  {
+    size_t num = 1;
+    for (auto cit(components.cbegin()); cit != components.cend(); ++cit)
+    {
+      num *= cit->size();
+    }
+    std::vector<GridComponent<Ctype, CresultData>*> nodes(num);
+
+    // memory of all nodes is allocated at once
+    Arena* const arena = grid->getArena().get();
+    void* const memory = arena ?
+      arena->allocate(num*sizeof(Tnode), std::alignment_of<Tnode>::value) : 0;
+
+    // a thread pool of its own only if no persistent pool had been set
+    std::unique_ptr<thread::ThreadPool<Ctype, CresultData>> own_pool;
+    thread::ThreadPool<Ctype, CresultData>* pool = MthreadPool.get();
+    if (! pool)
+    {
+      own_pool.reset(new thread::ThreadPool<Ctype, CresultData>(MnumThreads));
+      own_pool->initialize();
+      pool = own_pool.get();
+    }
+    NullApplication app;
+    Progress progress;
+    thread::Job<Ctype, CresultData> job(*pool, app, progress);
+    typedef typename thread::Job<Ctype, CresultData>::Ttask Ttask;
+    // a few tasks for each worker to balance the load
+    size_t const chunk = std::max<size_t>(1, num / (4*pool->getNumThreads()));
+    for (size_t first = 0; first < num; first += chunk)
+    {
+      job.addTask(Ttask(new thread::NodeBuildTask<Ctype, CresultData, Cdim>(
+              components, nodes.data(), memory, first,
+              std::min(first+chunk, num))));
+    }
+    job.wait();
+
+    grid->addRange(nodes.data(), nodes.data()+nodes.size());
+  } // function StandardParameterSpaceBuilder::buildNodesParallel
 
   /* ----------------------------------------------------------------------- */
-  template<typename Ctype, typename CresultData> 
+  template<typename Ctype, typename CresultData, size_t Cdim> 
   typename std::unique_ptr<GridComponent<Ctype,CresultData>>
-  StandardParameterSpaceBuilder<Ctype, CresultData>::getParameterSpace()
+  StandardParameterSpaceBuilder<Ctype, CresultData, Cdim>::getParameterSpace()
   {
     return std::move(Tbase::MparameterSpace);
   }
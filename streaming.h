@@ -0,0 +1,401 @@
+/*! \file streaming.h
+ * \brief Sinks consuming the results of a streaming execution.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Sinks consuming the results of a streaming execution.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <vector>
+#include <memory>
+#include <ostream>
+#include <algorithm>
+#include <functional>
+#include <boost/thread.hpp>
+#include <optimizexx/application.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/indexedgrid.h>
+#include <optimizexx/indexednode.h>
+#include <optimizexx/parameter.h>
+#include <optimizexx/binaryio.h>
+#include <optimizexx/threadpool.h>
+#include <optimizexx/error.h>
+
+#ifndef _OPTIMIZEXX_STREAMING_H_
+#define _OPTIMIZEXX_STREAMING_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Abstract base class template of sinks consuming the results of a
+   * streaming execution (see optimize::GridSearch::setSink).\n
+   *
+   * A streaming execution does not keep the results in a parameter space.
+   * Instead the grid points are generated and computed tile by tile and each
+   * tile is passed to the sink as soon as it had been computed. A tile
+   * provides the coordinates and the result data of its grid points (see
+   * optimize::CoordinateBlock) which are valid during the call of consume()
+   * only.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class TileSink
+  {
+    public:
+      //! destructor
+      virtual ~TileSink() { }
+      /*!
+       * Called once before the first tile is consumed. Does nothing by
+       * default.
+       *
+       * \param parameters parameters the grid points are generated of
+       * \param num_points total number of grid points
+       */
+      virtual void begin(
+          std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+            parameters, size_t const num_points) { }
+      /*!
+       * Consume a tile of computed grid points. Tiles computed by different
+       * workers of a thread pool are consumed concurrently and not
+       * necessarily in order.
+       *
+       * \param first linear index of the first grid point of the tile
+       * \param tile coordinates and result data of the grid points
+       */
+      virtual void consume(size_t const first,
+          CoordinateBlock<Ctype, CresultData> const& tile) = 0;
+      //! Called once after the last tile. Does nothing by default.
+      virtual void end() { }
+
+    protected:
+      //! constructor
+      TileSink() { }
+
+  }; // class template TileSink
+
+  /* ======================================================================= */
+  /*!
+   * Sink passing the tiles to a user callback. The callback must be thread
+   * safe if the execution uses multiple threads.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class CallbackSink : public TileSink<Ctype, CresultData>
+  {
+    public:
+      //! typedef for the callback
+      typedef std::function<void(size_t,
+          CoordinateBlock<Ctype, CresultData> const&)> Tcallback;
+
+    public:
+      //! constructor
+      CallbackSink(Tcallback callback) : Mcallback(callback) { }
+      //! destructor
+      virtual ~CallbackSink() { }
+      //! pass the tile to the callback
+      virtual void consume(size_t const first,
+          CoordinateBlock<Ctype, CresultData> const& tile)
+      {
+        Mcallback(first, tile);
+      }
+
+    private:
+      //! callback
+      Tcallback Mcallback;
+
+  }; // class template CallbackSink
+
+  /* ======================================================================= */
+  /*!
+   * Sink updating a reducer (e.g. optimize::thread::MinReducer) with the
+   * result data of each grid point. Since a reducer provides a slot for each
+   * worker no locking is required.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData, typename Creducer>
+  class ReducerSink : public TileSink<Ctype, CresultData>
+  {
+    public:
+      /*!
+       * constructor
+       *
+       * \param reducer reducer - must outlive the sink
+       */
+      ReducerSink(Creducer& reducer) : Mreducer(reducer) { }
+      //! destructor
+      virtual ~ReducerSink() { }
+      //! update the reducer with the result data of the tile
+      virtual void consume(size_t const first,
+          CoordinateBlock<Ctype, CresultData> const& tile)
+      {
+        CresultData const* results = tile.getResults();
+        for (size_t i = 0; i < tile.getSize(); ++i)
+        {
+          Mreducer.update(results[i]);
+        }
+      }
+
+    private:
+      //! reducer
+      Creducer& Mreducer;
+
+  }; // class template ReducerSink
+
+  /* ======================================================================= */
+  /*!
+   * Sink writing the grid points to a stream in binary format (see
+   * optimize::BinaryFormat).\n
+   *
+   * The header is written and the stream is extended to the size of the data
+   * when the execution begins. Afterwards each tile is written to its
+   * position within the columns. Thus the stream must be seekable (e.g. a
+   * std::ofstream opened in binary mode). Grid points which had not been
+   * streamed (e.g. of other partitions) keep zero coordinates, results and
+   * computed flags.
+   *
+   * \ingroup group_global_algos
+   */
+  template <typename Ctype, typename CresultData>
+  class BinarySink : public TileSink<Ctype, CresultData>
+  {
+    public:
+      //! typedef for the binary format
+      typedef BinaryFormat<Ctype, CresultData> Tformat;
+
+    public:
+      /*!
+       * constructor
+       *
+       * \param os seekable binary output stream - must outlive the sink
+       */
+      BinarySink(std::ostream& os) : Mos(os) { }
+      //! destructor
+      virtual ~BinarySink() { }
+      //! write the header and extend the stream
+      virtual void begin(
+          std::vector<std::shared_ptr<Parameter<Ctype> const>> const&
+            parameters, size_t const num_points);
+      //! write a tile to the columns
+      virtual void consume(size_t const first,
+          CoordinateBlock<Ctype, CresultData> const& tile);
+      //! flush the stream
+      virtual void end();
+
+    private:
+      //! output stream
+      std::ostream& Mos;
+      //! header information of the data written
+      BinaryGridInfo<Ctype> Minfo;
+      //! mutex serializing the access to the stream
+      boost::mutex Mmutex;
+
+  }; // class template BinarySink
+
+  namespace thread
+  {
+    /* ===================================================================== */
+    /*!
+     * Task computing a tile of the grid points of an optimize::IndexedGrid
+     * and passing it to a sink. The coordinates are gathered into a buffer
+     * which the task owns during its execution only.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData>
+    class TileTask : public Task<Ctype, CresultData>
+    {
+      public:
+        /*!
+         * constructor
+         *
+         * \param grid grid generating the coordinates
+         * \param first linear index of the first grid point
+         * \param last linear index past the last grid point
+         * \param sink sink consuming the tile
+         */
+        TileTask(IndexedGrid<Ctype, CresultData> const* grid, size_t first,
+            size_t last, TileSink<Ctype, CresultData>& sink) : Mgrid(grid),
+            Mfirst(first), Mlast(last), Msink(sink)
+        { }
+        //! destructor
+        virtual ~TileTask() { }
+        //! compute the tile
+        virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app)
+        {
+          BlockBuffer<Ctype, CresultData> buffer(Mgrid->getDimensions(),
+              Mlast-Mfirst);
+          compute(*Mgrid, Mfirst, Mlast, buffer, app, Msink);
+        }
+        //! query function for the number of nodes of the task
+        virtual size_t getSize() const { return Mlast-Mfirst; }
+        /*!
+         * Compute a tile and pass it to a sink. Batch applications are
+         * passed the tile at once, other applications are passed a flyweight
+         * node for each grid point.
+         *
+         * \param grid grid generating the coordinates
+         * \param first linear index of the first grid point
+         * \param last linear index past the last grid point
+         * \param buffer buffer the tile is gathered into
+         * \param app application
+         * \param sink sink consuming the tile
+         */
+        static void compute(IndexedGrid<Ctype, CresultData> const& grid,
+            size_t const first, size_t const last,
+            BlockBuffer<Ctype, CresultData>& buffer,
+            ParameterSpaceVisitor<Ctype, CresultData>& app,
+            TileSink<Ctype, CresultData>& sink);
+
+      private:
+        //! grid generating the coordinates
+        IndexedGrid<Ctype, CresultData> const* Mgrid;
+        //! first grid point
+        size_t Mfirst;
+        //! end of the range
+        size_t Mlast;
+        //! sink consuming the tile
+        TileSink<Ctype, CresultData>& Msink;
+
+    }; // class template TileTask
+
+  } // namespace thread
+
+  /* ======================================================================= */
+  template <typename Ctype, typename CresultData>
+  void BinarySink<Ctype, CresultData>::begin(
+      std::vector<std::shared_ptr<Parameter<Ctype> const>> const& parameters,
+      size_t const num_points)
+  {
+    boost::mutex::scoped_lock lock(Mmutex);
+    Mos.seekp(0);
+    Minfo = Tformat::writeHeader(Mos, parameters, num_points);
+    // extend the stream - the columns are filled with zeros
+    std::uint64_t const size = Tformat::getSize(Minfo);
+    if (Minfo.MdataOffset < size)
+    {
+      Mos.seekp(size-1);
+      Mos.put('\0');
+    }
+    OPTIMIZE_assert(Mos.good(), "Unable to write binary parameter space.");
+  } // function BinarySink<Ctype, CresultData>::begin
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void BinarySink<Ctype, CresultData>::consume(size_t const first,
+      CoordinateBlock<Ctype, CresultData> const& tile)
+  {
+    OPTIMIZE_assert(first+tile.getSize() <= Minfo.MnumPoints &&
+        tile.getDimensions() == Minfo.Mparameters.size(),
+        "Tile out of range.");
+    size_t const num = tile.getSize();
+    std::vector<char> const computed(num, 1);
+
+    boost::mutex::scoped_lock lock(Mmutex);
+    for (size_t d = 0; d < tile.getDimensions(); ++d)
+    {
+      Mos.seekp(Tformat::getColumnOffset(Minfo, d) + first*sizeof(Ctype));
+      Mos.write(reinterpret_cast<char const*>(tile.getColumn(d)),
+          num*sizeof(Ctype));
+    }
+    Mos.seekp(Tformat::getResultOffset(Minfo) + first*sizeof(CresultData));
+    Mos.write(reinterpret_cast<char const*>(tile.getResults()),
+        num*sizeof(CresultData));
+    Mos.seekp(Tformat::getComputedOffset(Minfo) + first);
+    Mos.write(computed.data(), num);
+    OPTIMIZE_assert(Mos.good(), "Unable to write binary parameter space.");
+  } // function BinarySink<Ctype, CresultData>::consume
+
+  /* ----------------------------------------------------------------------- */
+  template <typename Ctype, typename CresultData>
+  void BinarySink<Ctype, CresultData>::end()
+  {
+    boost::mutex::scoped_lock lock(Mmutex);
+    Mos.flush();
+    OPTIMIZE_assert(Mos.good(), "Unable to write binary parameter space.");
+  } // function BinarySink<Ctype, CresultData>::end
+
+  /* ======================================================================= */
+  namespace thread
+  {
+    template <typename Ctype, typename CresultData>
+    void TileTask<Ctype, CresultData>::compute(
+        IndexedGrid<Ctype, CresultData> const& grid, size_t const first,
+        size_t const last, BlockBuffer<Ctype, CresultData>& buffer,
+        ParameterSpaceVisitor<Ctype, CresultData>& app,
+        TileSink<Ctype, CresultData>& sink)
+    {
+      size_t const num = last-first;
+      size_t const dims = grid.getDimensions();
+      OPTIMIZE_assert(num <= buffer.getCapacity(), "Illegal tile size.");
+
+      // generate the coordinates
+      typename IndexedGrid<Ctype, CresultData>::Tcoordinates c;
+      for (size_t i = 0; i < num; ++i)
+      {
+        grid.getCoordinatesAt(first+i, c);
+        for (size_t d = 0; d < dims; ++d) { buffer.getColumn(d)[i] = c[d]; }
+      }
+
+      CoordinateBlock<Ctype, CresultData> const tile(buffer.getBlock(num));
+      BatchParameterSpaceVisitor<Ctype, CresultData>* batch =
+        dynamic_cast<BatchParameterSpaceVisitor<Ctype, CresultData>*>(&app);
+      if (batch)
+      {
+        (*batch)(tile);
+      } else
+      {
+        IndexedNode<Ctype, CresultData> node(&grid);
+        CresultData* results = buffer.getResults();
+        for (size_t i = 0; i < num; ++i)
+        {
+          node.setIndex(first+i);
+          app(&node);
+          results[i] = node.getResultData();
+        }
+      }
+      sink.consume(first, tile);
+    } // function TileTask<Ctype, CresultData>::compute
+
+  } // namespace thread
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF streaming.h  ----- */
@@ -0,0 +1,112 @@
+/*! \file adaptivegridsearchtest.cc
+ * \brief Test adaptive grid search algorithm.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test adaptive grid search algorithm.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/globalalgorithms/adaptivegridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! application calculating the squared distance to a point
+class Distance : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    Distance() : Mcount(0) { }
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& c = node->getCoordinates();
+      node->setResultData((c[0]-0.3)*(c[0]-0.3) + (c[1]+0.45)*(c[1]+0.45));
+      ++Mcount;
+    }
+    //! query function for the number of nodes computed
+    size_t getCount() const { return Mcount; }
+
+  private:
+    std::atomic<size_t> Mcount;
+
+}; // class Distance
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+
+  for (size_t depth = 0; depth < 5; ++depth)
+  {
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::AdaptiveGridSearch<TcoordType, TresultType> search(
+        std::move(builder), params, depth, 2, 2, 4);
+    search.constructParameterSpace();
+
+    Distance app;
+    search.execute(app);
+
+    opt::Node<TcoordType, TresultType> const* best = search.getBestNodes()[0];
+    std::cout << "depth " << depth << ": " << app.getCount() 
+      << " nodes computed, best node ";
+    std::vector<TcoordType> const& c = best->getCoordinates();
+    for (auto cit(c.cbegin()); cit != c.cend(); ++cit)
+    {
+      std::cout << *cit << " ";
+    }
+    std::cout << best->getResultData() << std::endl;
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF adaptivegridsearchtest.cc  ----- */
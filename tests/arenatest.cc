@@ -0,0 +1,246 @@
+/*! \file arenatest.cc
+ * \brief Test the allocation of grid components from an arena.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the allocation of grid components from an arena.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Teardown of trivially disposable nodes.
+ * 14/10/2026  V0.3  Reuse of arena memory by rebuilt grids.
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/arena.h>
+#include <optimizexx/grid.h>
+#include <optimizexx/fixednode.h>
+#include <optimizexx/iterator.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! Builder allocating the grid components by new.
+class HeapBuilder :
+  public opt::StandardParameterSpaceBuilder<TcoordType, TresultType>
+{
+  protected:
+    virtual std::shared_ptr<opt::Arena> createArena() const
+    {
+      return std::shared_ptr<opt::Arena>();
+    }
+}; // class HeapBuilder
+
+//! number of destructor calls of counted nodes
+size_t num_destructed = 0;
+
+//! Node counting the calls of its destructor.
+template <bool Cdisposable>
+class CountedNode : public opt::FixedNode<TcoordType, TresultType, 1>
+{
+  public:
+    //! constructor
+    CountedNode(std::vector<TcoordType> const& coordinates) :
+      opt::FixedNode<TcoordType, TresultType, 1>(coordinates)
+    { }
+    //! destructor
+    virtual ~CountedNode() { ++num_destructed; }
+}; // class template CountedNode
+
+namespace optimize
+{
+  //! pretend the destructor of a counted node might be skipped
+  template <>
+  struct TriviallyDisposable<CountedNode<true>>
+  {
+    //! status variable
+    static bool const value = true;
+  }; // struct TriviallyDisposable
+} // namespace optimize
+
+//! count the destructor calls when disposing a grid of counted nodes
+template <bool Cdisposable>
+size_t countDestructed(size_t const num, bool const mixed)
+{
+  typedef opt::GridComponent<TcoordType, TresultType> Tcomponent;
+  std::shared_ptr<opt::Arena> arena(new opt::MonotonicArena);
+  num_destructed = 0;
+  {
+    opt::Grid<TcoordType, TresultType> grid(arena);
+    for (size_t i = 0; i < num; ++i)
+    {
+      grid.add(Tcomponent::create<CountedNode<Cdisposable>>(*arena,
+            std::vector<TcoordType>(1, i)));
+    }
+    if (mixed)
+    {
+      grid.add(Tcomponent::create<CountedNode<false>>(*arena,
+            std::vector<TcoordType>(1, 0)));
+    }
+  }
+  return num_destructed;
+}
+
+//! count the nodes of a parameter space and its subgrids
+size_t countNodes(opt::GridComponent<TcoordType, TresultType>& space)
+{
+  size_t num = 0;
+  for (auto it(space.begin()); it != space.end(); ++it)
+  {
+    if (opt::GridComponent<TcoordType, TresultType>::Leaf ==
+        (*it)->getComponentType())
+    {
+      ++num;
+    } else
+    {
+      num += countNodes(**it);
+    }
+  }
+  return num;
+}
+
+/*
+ * Rebuild a grid repeatedly with a range moving along a parameter axis and
+ * return the number of memory blocks the arena grew by.
+ */
+size_t countBlocksGrown(size_t const num_rebuilds)
+{
+  typedef std::shared_ptr<opt::Parameter<TcoordType> const> Tparam;
+  std::vector<Tparam> params;
+  params.push_back(Tparam(
+        new opt::StandardParameter<TcoordType>("x",0,99,1)));
+  params.push_back(Tparam(
+        new opt::StandardParameter<TcoordType>("y",0,99,1)));
+
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType> builder;
+  builder.buildParameterSpace();
+  builder.buildGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+      builder.getParameterSpace());
+  std::shared_ptr<opt::MonotonicArena> arena(
+      std::dynamic_pointer_cast<opt::MonotonicArena>(space->getArena()));
+  size_t const num_blocks = arena->getBlockCount();
+
+  for (size_t i = 1; i <= num_rebuilds; ++i)
+  {
+    params[0] = Tparam(new opt::StandardParameter<TcoordType>(
+          "x",10.*i,99+10.*i,1));
+    builder.rebuildGrid(space.get(), params);
+  }
+  return arena->getBlockCount()-num_blocks;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  // parameter space allocated from an arena
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType> builder;
+  builder.buildParameterSpace();
+  builder.buildGrid(params);
+  builder.buildSubGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+      builder.getParameterSpace());
+  std::shared_ptr<opt::MonotonicArena> arena(
+      std::dynamic_pointer_cast<opt::MonotonicArena>(space->getArena()));
+  std::cout << "Arena in use: " << (arena ? "yes" : "no") << "\n"
+    << "Memory blocks: " << arena->getBlockCount() << "\n"
+    << "Nodes: " << countNodes(*space) << std::endl;
+
+  // remove a node and the subgrid
+  space->remove(*space->begin());
+  space->remove(*space->rbegin());
+  std::cout << "Nodes after removal: " << countNodes(*space) << std::endl;
+
+  // parameter space allocated by new
+  HeapBuilder heap_builder;
+  heap_builder.buildParameterSpace();
+  heap_builder.buildGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> heap_space(
+      heap_builder.getParameterSpace());
+  std::cout << "Arena in use: " << (heap_space->getArena() ? "yes" : "no")
+    << "\n" << "Nodes: " << countNodes(*heap_space) << std::endl;
+
+  // compare coordinates
+  size_t num_mismatches = 0;
+  opt::Iterator<TcoordType, TresultType> it(
+      space->createIterator(opt::ForwardNodeIter));
+  opt::Iterator<TcoordType, TresultType> it_heap(
+      heap_space->createIterator(opt::ForwardNodeIter));
+  // the first node had been removed
+  it_heap.first();
+  ++it_heap;
+  for (it.first(); !it.isDone(); ++it, ++it_heap)
+  {
+    if ((*it)->getCoordinates() != (*it_heap)->getCoordinates())
+    {
+      ++num_mismatches;
+    }
+  }
+  std::cout << "Mismatches: " << num_mismatches << std::endl;
+
+  // teardown of an arena grid skips trivially disposable nodes
+  std::cout << "Trivially disposable fixed nodes: "
+    << opt::TriviallyDisposable<
+      opt::FixedNode<TcoordType, TresultType, 3>>::value << "\n"
+    << "Trivially disposable dynamic nodes: "
+    << opt::TriviallyDisposable<
+      opt::Node<TcoordType, TresultType>>::value << "\n"
+    << "Destructors run (disposable nodes): "
+    << countDestructed<true>(100, false) << "\n"
+    << "Destructors run (other nodes): "
+    << countDestructed<false>(100, false) << "\n"
+    << "Destructors run (disposable nodes and another one): "
+    << countDestructed<true>(100, true) << std::endl;
+
+  // nodes dropped by a rebuild hand back their memory
+  std::cout << "Memory blocks grown by 50 rebuilds: " << countBlocksGrown(50)
+    << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF arenatest.cc  ----- */
@@ -0,0 +1,155 @@
+/*! \file arraygridtest.cc
+ * \brief Test parameter space grid storing its data in contiguous arrays.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test parameter space grid storing its data in contiguous arrays.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/arraybuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! simple application calculating the sum of the parameters
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+      node->setComputed();
+    }
+}; // class Sum
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  Sum app;
+
+  // standard parameter space as reference
+  std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> builder(
+    new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> reference(std::move(builder),
+      params);
+  reference.constructParameterSpace();
+  reference.execute(app);
+
+  // array parameter space
+  builder.reset(new opt::ArrayParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+      params, 4);
+  gridsearch.constructParameterSpace();
+
+  std::cout << "-----------------------\n"
+    << "Multiple threads in use\n"
+    << "-----------------------" << std::endl;
+
+  gridsearch.execute(app);
+
+  // compare results using node iterators
+  opt::Iterator<TcoordType, TresultType> it_ref(
+      reference.getParameterSpace().createIterator(opt::ForwardNodeIter));
+  opt::Iterator<TcoordType, TresultType> it(
+      gridsearch.getParameterSpace().createIterator(opt::ForwardNodeIter));
+
+  size_t num_nodes = 0;
+  size_t num_mismatches = 0;
+  size_t num_computed = 0;
+  for (it_ref.first(), it.first(); !it_ref.isDone() && !it.isDone();
+      ++it_ref, ++it, ++num_nodes)
+  {
+    if ((*it_ref)->getCoordinates() != (*it)->getCoordinates() ||
+        (*it_ref)->getResultData() != (*it)->getResultData())
+    {
+      ++num_mismatches;
+    }
+    if ((*it)->isComputed()) { ++num_computed; }
+  }
+  std::cout << "Number of nodes: " << num_nodes << std::endl;
+  std::cout << "Both iterators done: " << std::boolalpha 
+    << (it_ref.isDone() && it.isDone()) << std::endl;
+  std::cout << "Computed nodes: " << num_computed << std::endl;
+  std::cout << "Mismatches: " << num_mismatches << std::endl;
+
+  std::cout << "-------------------------\n"
+    << "Scan of the result column\n"
+    << "-------------------------" << std::endl;
+
+  opt::ArrayGrid<TcoordType, TresultType> const& grid = 
+    dynamic_cast<opt::ArrayGrid<TcoordType, TresultType> const&>(
+        gridsearch.getParameterSpace());
+  std::vector<TresultType> const& results = grid.getResultColumn();
+  size_t const index = std::min_element(results.cbegin(), results.cend()) -
+    results.cbegin();
+  std::cout << "Minimum: " << results[index] << " at ";
+  for (size_t d = 0; d < grid.getDimensions(); ++d)
+  {
+    std::cout << grid.getColumn(d)[index] << " ";
+  }
+  std::cout << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF arraygridtest.cc  ----- */
@@ -0,0 +1,380 @@
+/*! \file asyncexecutiontest.cc
+ * \brief Test asynchronous executions sharing a thread pool.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test asynchronous executions sharing a thread pool.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Poll the progress of the algorithm.
+ * 14/10/2026  V0.3  Resubmit to a cancelled thread pool.
+ * 14/10/2026  V0.4  Cancelling an execution spares the others of the pool.
+ * 14/10/2026  V0.5  Elapsed time of finished executions.
+ * 14/10/2026  V0.6  Enable unique sampling.
+ * 
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <boost/thread.hpp>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/execution.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+/*!
+ * Application calculating the sum of the parameters. The application might
+ * be slowed down and might fail at a certain node.
+ */
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    Sum(size_t delay=0, bool fail=false) : Mdelay(delay), Mfail(fail) { }
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      if (Mdelay)
+      {
+        boost::this_thread::sleep(boost::posix_time::millisec(Mdelay));
+      }
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      if (Mfail && result > 2.5) { throw std::runtime_error("Failed node."); }
+      node->setResultData(result);
+      node->setComputed();
+    }
+    //! create a clone for a worker thread
+    virtual std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+      TresultType>> clone() const
+    {
+      return std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+             TresultType>>(new Sum(Mdelay, Mfail));
+    }
+
+  private:
+    //! delay in milliseconds per node
+    size_t Mdelay;
+    //! status variable if the application fails
+    bool Mfail;
+
+}; // class Sum
+
+//! sum up the results of the computed nodes and count them
+TresultType total(opt::GlobalAlgorithm<TcoordType, TresultType>& algo,
+    size_t& count)
+{
+  TresultType sum = 0;
+  count = 0;
+  opt::Iterator<TcoordType, TresultType> iter(
+      algo.getParameterSpace().createIterator(opt::ForwardNodeIter));
+  for (iter.first(); !iter.isDone(); ++iter)
+  {
+    if ((*iter)->isComputed())
+    {
+      sum += (*iter)->getResultData();
+      ++count;
+    }
+  }
+  return sum;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  typedef opt::StandardParameterSpaceBuilder<TcoordType, TresultType>
+    Tstandard;
+  typedef opt::GridSearch<TcoordType, TresultType> TgridSearch;
+  typedef opt::MonteCarlo<TcoordType, TresultType> TmonteCarlo;
+
+  // thread pool shared by the algorithms
+  std::shared_ptr<opt::thread::ThreadPool<TcoordType, TresultType>> pool(
+      new opt::thread::ThreadPool<TcoordType, TresultType>(4));
+  pool->initialize();
+
+  std::cout << "------------------\n"
+    << "Concurrent executions sharing a thread pool\n"
+    << "------------------" << std::endl;
+  {
+    TgridSearch gridsearch(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    TgridSearch reference(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    TmonteCarlo montecarlo(std::unique_ptr<Tstandard>(new Tstandard),
+        params, opt::UniformInt, 50.);
+    gridsearch.setThreadPool(pool);
+    montecarlo.setThreadPool(pool);
+    montecarlo.setUniqueSampling(true);
+    gridsearch.constructParameterSpace();
+    reference.constructParameterSpace();
+    montecarlo.constructParameterSpace();
+
+    Sum app;
+    Sum app_mc;
+    std::unique_ptr<opt::Execution<TcoordType, TresultType>> gs(
+        gridsearch.executeAsync(app));
+    std::unique_ptr<opt::Execution<TcoordType, TresultType>> mc(
+        montecarlo.executeAsync(app_mc));
+    gs->get();
+    mc->get();
+    Sum app_ref;
+    reference.execute(app_ref);
+
+    size_t count = 0;
+    size_t count_ref = 0;
+    TresultType const sum = total(gridsearch, count);
+    TresultType const sum_ref = total(reference, count_ref);
+    std::cout << "GridSearch computed nodes: " << count << "\n"
+      << "GridSearch progress: " << gs->getProgress().getCompleted() << "/"
+      << gs->getProgress().getSubmitted() << "\n"
+      << "GridSearch in flight: " << gs->getProgress().getInFlight() << "\n"
+      << "GridSearch results equal to serial: " << (sum == sum_ref) << "\n";
+    total(montecarlo, count);
+    std::cout << "MonteCarlo computed samples: " << count << "\n"
+      << "MonteCarlo progress: " << mc->getProgress().getCompleted() << "/"
+      << mc->getProgress().getSubmitted() << "\n"
+      << "Done: " << (gs->isDone() && mc->isDone()) << std::endl;
+
+    // the elapsed time of a finished execution stays constant
+    double const elapsed = gs->getProgress().getElapsed();
+    boost::this_thread::sleep(boost::posix_time::millisec(20));
+    std::cout << "Progress finished: " << gs->getProgress().isFinished()
+      << "\n"
+      << "Elapsed time constant after finishing: "
+      << (elapsed == gs->getProgress().getElapsed()) << std::endl;
+  }
+
+  std::cout << "------------------\n"
+    << "Cancellation\n"
+    << "------------------" << std::endl;
+  {
+    TgridSearch gridsearch(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    gridsearch.setThreadPool(pool);
+    gridsearch.constructParameterSpace();
+    Sum app(2);
+    std::unique_ptr<opt::Execution<TcoordType, TresultType>> gs(
+        gridsearch.executeAsync(app));
+    while (gs->getProgress().getCompleted() < 10)
+    {
+      boost::this_thread::sleep(boost::posix_time::millisec(1));
+    }
+    gs->cancel();
+    gs->get();
+    size_t count = 0;
+    total(gridsearch, count);
+    std::cout << "Cancelled: " << gs->isCancelled() << "\n"
+      << "Computed less than all nodes: " << (count < 1025) << "\n"
+      << "Progress consistent: "
+      << (count == gs->getProgress().getCompleted() &&
+          count == gs->getProgress().getSubmitted()) << std::endl;
+  }
+
+  std::cout << "------------------\n"
+    << "Cancellation (single threaded)\n"
+    << "------------------" << std::endl;
+  {
+    TgridSearch gridsearch(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    gridsearch.constructParameterSpace();
+    Sum app(1);
+    std::unique_ptr<opt::Execution<TcoordType, TresultType>> gs(
+        gridsearch.executeAsync(app));
+    // poll the progress of the algorithm which is handed over by the
+    // execution thread
+    double elapsed = 0;
+    while (gridsearch.getProgress()->getCompleted() < 10)
+    {
+      elapsed = gridsearch.getProgress()->getElapsed();
+      boost::this_thread::sleep(boost::posix_time::millisec(1));
+    }
+    gs->cancel();
+    gs->get();
+    size_t count = 0;
+    total(gridsearch, count);
+    std::cout << "Computed less than all nodes: " << (count < 1025) << "\n"
+      << "Progress consistent: "
+      << (count == gs->getProgress().getCompleted()) << "\n"
+      << "Progress of the algorithm is the one of the execution: "
+      << (gridsearch.getProgress().get() == &gs->getProgress()) << "\n"
+      << "Elapsed time increasing: "
+      << (elapsed <= gs->getProgress().getElapsed()) << std::endl;
+  }
+
+  std::cout << "------------------\n"
+    << "Cancelling one of the executions sharing a thread pool\n"
+    << "------------------" << std::endl;
+  {
+    TgridSearch cancelled(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    TgridSearch other(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    TgridSearch reference(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    cancelled.setThreadPool(pool);
+    other.setThreadPool(pool);
+    cancelled.constructParameterSpace();
+    other.constructParameterSpace();
+    reference.constructParameterSpace();
+    Sum app_slow(2);
+    Sum app_other(1);
+    std::unique_ptr<opt::Execution<TcoordType, TresultType>> gs(
+        cancelled.executeAsync(app_slow));
+    std::unique_ptr<opt::Execution<TcoordType, TresultType>> gs_other(
+        other.executeAsync(app_other));
+    while (gs->getProgress().getCompleted() < 10)
+    {
+      boost::this_thread::sleep(boost::posix_time::millisec(1));
+    }
+    gs->cancel();
+    // the shared pool has no job of its own - the executions are unaffected
+    pool->cancel();
+    gs->get();
+    gs_other->get();
+    Sum app_ref;
+    reference.execute(app_ref);
+    size_t count_cancelled = 0;
+    size_t count_other = 0;
+    size_t count_ref = 0;
+    total(cancelled, count_cancelled);
+    TresultType const sum_other = total(other, count_other);
+    TresultType const sum_ref = total(reference, count_ref);
+
+    // the pool executes the tasks submitted after the cancellation
+    TgridSearch gridsearch(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    gridsearch.setThreadPool(pool);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    gridsearch.execute(app);
+    size_t count = 0;
+    TresultType const sum = total(gridsearch, count);
+    std::cout << "Cancelled execution computed less than all nodes: "
+      << (count_cancelled < 1025) << "\n"
+      << "Other execution computed nodes: " << count_other << "\n"
+      << "Other execution results equal to serial: "
+      << (sum_other == sum_ref) << "\n"
+      << "Cancellation pending: " << pool->isCancelled() << "\n"
+      << "Computed nodes after resubmitting: " << count << "\n"
+      << "Results equal to serial: " << (sum == sum_ref) << std::endl;
+  }
+
+  std::cout << "------------------\n"
+    << "Persistent thread pools\n"
+    << "------------------" << std::endl;
+  {
+    // thread pool with workers pinned to the CPUs
+    std::vector<size_t> cpus;
+    for (size_t i = 0; i < std::max(1u, boost::thread::hardware_concurrency());
+        ++i)
+    {
+      cpus.push_back(i);
+    }
+    std::shared_ptr<opt::thread::ThreadPool<TcoordType, TresultType>> pinned(
+        new opt::thread::ThreadPool<TcoordType, TresultType>(2));
+    pinned->setAffinity(cpus);
+    pinned->initialize();
+
+    // small sub-grids computed by many executions
+    std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> sub;
+    sub.push_back(param1);
+    sub.push_back(param2);
+    bool equal = true;
+    TgridSearch own(std::unique_ptr<Tstandard>(new Tstandard), sub, 2);
+    own.constructParameterSpace();
+    for (size_t i = 0; i < 200; ++i)
+    {
+      TgridSearch gridsearch(std::unique_ptr<Tstandard>(new Tstandard), sub);
+      gridsearch.setThreadPool(pinned);
+      gridsearch.constructParameterSpace();
+      Sum app;
+      gridsearch.execute(app);
+      // the thread pool of its own is reused by each execution
+      own.execute(app);
+      size_t count = 0;
+      size_t count_own = 0;
+      equal = equal && total(gridsearch, count) == total(own, count_own) &&
+        25 == count && 25 == count_own;
+    }
+    std::cout << "Affinity set: " << (pinned->getAffinity() == cpus) << "\n"
+      << "Results of the executions equal: " << equal << std::endl;
+  }
+
+  std::cout << "------------------\n"
+    << "Failing execution\n"
+    << "------------------" << std::endl;
+  {
+    TgridSearch gridsearch(std::unique_ptr<Tstandard>(new Tstandard),
+        params);
+    gridsearch.constructParameterSpace();
+    Sum app(0, true);
+    std::unique_ptr<opt::Execution<TcoordType, TresultType>> gs(
+        gridsearch.executeAsync(app));
+    try
+    {
+      gs->get();
+      std::cout << "No exception" << std::endl;
+    }
+    catch (std::runtime_error const& e)
+    {
+      std::cout << "Exception: " << e.what() << std::endl;
+    }
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF asyncexecutiontest.cc  ----- */
@@ -0,0 +1,233 @@
+/*! \file batchinstrumentationtest.cc
+ * \brief Test batch applications applied through decorators.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test batch applications applied through decorators.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+// batch applications are applied through the instrumenting decorator
+#define OPTIMIZE_INSTRUMENTATION
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/arraybuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/resultcache.h>
+#include <optimizexx/instrumentation.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+/*!
+ * batch application calculating the sum of the parameters - the blocks and
+ * grid points are counted by clones of the application
+ */
+class BatchSum : 
+  public opt::BatchParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    BatchSum() : Mblocks(0), Mpoints(0) { }
+    //! Visit function for a block of grid points.
+    virtual void operator()(
+        opt::CoordinateBlock<TcoordType, TresultType> const& block)
+    {
+      TresultType* results = block.getResults();
+      size_t const size = block.getSize();
+      for (size_t i = 0; i < size; ++i) { results[i] = 0; }
+      for (size_t d = 0; d < block.getDimensions(); ++d)
+      {
+        TcoordType const* column = block.getColumn(d);
+        for (size_t i = 0; i < size; ++i) { results[i] += column[i]; }
+      }
+      ++Mblocks;
+      Mpoints += size;
+    }
+    //! create a clone for a worker thread
+    virtual std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+      TresultType>> clone() const
+    {
+      BatchSum* clone = new BatchSum;
+      clone->setBlockSize(getBlockSize());
+      return std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+             TresultType>>(clone);
+    }
+    //! merge the counts of a clone
+    virtual void merge(
+        opt::ParameterSpaceVisitor<TcoordType, TresultType>& clone)
+    {
+      Mblocks += static_cast<BatchSum&>(clone).Mblocks;
+      Mpoints += static_cast<BatchSum&>(clone).Mpoints;
+    }
+    //! query function for the number of blocks computed
+    size_t getBlocks() const { return Mblocks; }
+    //! query function for the number of grid points computed
+    size_t getPoints() const { return Mpoints; }
+
+  private:
+    //! number of blocks
+    size_t Mblocks;
+    //! number of grid points
+    size_t Mpoints;
+
+}; // class BatchSum
+
+//! number of nodes whose results are wrong or which are not computed
+size_t count_wrong(opt::GridComponent<TcoordType, TresultType> const& space)
+{
+  size_t num_wrong = 0;
+  opt::Iterator<TcoordType, TresultType> it(
+      space.createIterator(opt::ForwardNodeIter));
+  for (it.first(); !it.isDone(); ++it)
+  {
+    std::vector<TcoordType> const& params = (*it)->getCoordinates();
+    TresultType result = 0;
+    for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+    {
+      result += *cit;
+    }
+    if (std::fabs(result - (*it)->getResultData()) > 1e-12 ||
+        ! (*it)->isComputed())
+    {
+      ++num_wrong;
+    }
+  }
+  return num_wrong;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  std::cout << "Instrumentation enabled: "
+    << opt::Instrumentation::isEnabled() << std::endl;
+
+  char const* const names[] = { "standard", "array" };
+  for (size_t b = 0; b < 2; ++b)
+  {
+    for (size_t threads = 0; threads <= 4; threads += 4)
+    {
+      std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>
+        builder;
+      if (0 == b)
+      {
+        builder.reset(
+            new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+      } else
+      {
+        builder.reset(
+            new opt::ArrayParameterSpaceBuilder<TcoordType, TresultType>);
+      }
+      opt::GridSearch<TcoordType, TresultType> gridsearch(
+          std::move(builder), params, threads);
+      gridsearch.constructParameterSpace();
+
+      // instrumentation only
+      BatchSum app;
+      app.setBlockSize(128);
+      gridsearch.execute(app);
+      opt::Instrumentation const& instr = gridsearch.getInstrumentation();
+      std::cout << names[b] << " grid, " << threads << " threads: "
+        << app.getPoints() << " nodes computed, blocks "
+        << (app.getBlocks() <= app.getPoints()/10 ? "batched" : "unbatched")
+        << ", a visit per block "
+        << (instr.getVisitCount() == app.getBlocks())
+        << ", wrong results "
+        << count_wrong(gridsearch.getParameterSpace()) << std::endl;
+
+      // result cache - the second execution takes all results from the
+      // cache
+      std::shared_ptr<opt::ResultCache<TcoordType, TresultType>> cache(
+          new opt::ResultCache<TcoordType, TresultType>(1e-6));
+      gridsearch.setResultCache(cache);
+      for (size_t run = 1; run <= 2; ++run)
+      {
+        BatchSum cached_app;
+        cached_app.setBlockSize(128);
+        gridsearch.execute(cached_app);
+        std::cout << "  cached run " << run << ": "
+          << cached_app.getPoints() << " nodes computed, blocks "
+          << (cached_app.getBlocks() <= cached_app.getPoints()/10 ?
+              "batched" : "unbatched")
+          << ", cache hits " << cache->getHits()
+          << ", wrong results "
+          << count_wrong(gridsearch.getParameterSpace()) << std::endl;
+      }
+      gridsearch.setResultCache(
+          std::shared_ptr<opt::ResultCache<TcoordType, TresultType>>());
+
+      // incremental - nodes already computed are skipped
+      gridsearch.setIncremental(true);
+      gridsearch.setParameter(0, std::shared_ptr<
+          opt::Parameter<TcoordType> const>(
+            new opt::StandardParameter<TcoordType>("param1",0,2.,0.25)));
+      gridsearch.updateParameterSpace();
+      BatchSum incremental_app;
+      incremental_app.setBlockSize(128);
+      gridsearch.execute(incremental_app);
+      std::cout << "  incremental run: " << incremental_app.getPoints()
+        << " nodes computed, blocks "
+        << (incremental_app.getBlocks() <= incremental_app.getPoints()/10 ?
+            "batched" : "unbatched")
+        << ", wrong results "
+        << count_wrong(gridsearch.getParameterSpace()) << std::endl;
+      BatchSum repeated_app;
+      gridsearch.execute(repeated_app);
+      std::cout << "  repeated incremental run: "
+        << repeated_app.getPoints() << " nodes computed" << std::endl;
+    }
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF batchinstrumentationtest.cc  ----- */
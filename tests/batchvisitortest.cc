@@ -0,0 +1,203 @@
+/*! \file batchvisitortest.cc
+ * \brief Test batch applications visiting blocks of coordinates.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test batch applications visiting blocks of coordinates.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/arraybuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! simple application calculating the sum of the parameters
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+    }
+}; // class Sum
+
+//! batch application calculating the sum of the parameters
+class BatchSum : 
+  public opt::BatchParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    BatchSum() : Mblocks(0), Mpoints(0), Mmisaligned(0) { }
+    //! Visit function for a block of grid points.
+    virtual void operator()(
+        opt::CoordinateBlock<TcoordType, TresultType> const& block)
+    {
+      TresultType* results = block.getResults();
+      size_t const size = block.getSize();
+      for (size_t i = 0; i < size; ++i) { results[i] = 0; }
+      for (size_t d = 0; d < block.getDimensions(); ++d)
+      {
+        TcoordType const* column = block.getColumn(d);
+        if (0 != reinterpret_cast<std::uintptr_t>(column) %
+            opt::CoordinateBlock<TcoordType, TresultType>::Malignment)
+        {
+          ++Mmisaligned;
+        }
+        // vectorizable loop
+        for (size_t i = 0; i < size; ++i) { results[i] += column[i]; }
+      }
+      ++Mblocks;
+      Mpoints += size;
+    }
+    //! query function for the number of blocks computed
+    size_t getBlocks() const { return Mblocks; }
+    //! query function for the number of grid points computed
+    size_t getPoints() const { return Mpoints; }
+    //! query function for the number of misaligned coordinate spans
+    size_t getMisaligned() const { return Mmisaligned; }
+
+  private:
+    std::atomic<size_t> Mblocks;
+    std::atomic<size_t> Mpoints;
+    std::atomic<size_t> Mmisaligned;
+
+}; // class BatchSum
+
+//! compare the results of two parameter spaces
+size_t compare(opt::GridComponent<TcoordType, TresultType> const& lhs,
+    opt::GridComponent<TcoordType, TresultType> const& rhs)
+{
+  opt::Iterator<TcoordType, TresultType> it_lhs(
+      lhs.createIterator(opt::ForwardNodeIter));
+  opt::Iterator<TcoordType, TresultType> it_rhs(
+      rhs.createIterator(opt::ForwardNodeIter));
+  size_t num_mismatches = 0;
+  for (it_lhs.first(), it_rhs.first(); !it_lhs.isDone() && !it_rhs.isDone();
+      ++it_lhs, ++it_rhs)
+  {
+    if ((*it_lhs)->getCoordinates() != (*it_rhs)->getCoordinates() ||
+        (*it_lhs)->getResultData() != (*it_rhs)->getResultData() ||
+        ! (*it_rhs)->isComputed())
+    {
+      ++num_mismatches;
+    }
+  }
+  return num_mismatches + (it_lhs.isDone() && it_rhs.isDone() ? 0 : 1);
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  // standard parameter space and scalar application as reference
+  Sum app;
+  std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> builder(
+    new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> reference(std::move(builder),
+      params);
+  reference.constructParameterSpace();
+  reference.execute(app);
+
+  char const* const names[] = { "standard", "array" };
+  for (size_t b = 0; b < 2; ++b)
+  {
+    for (size_t threads = 0; threads <= 4; threads += 4)
+    {
+      for (size_t block_size = 100; block_size <= 256; block_size += 156)
+      {
+        if (0 == b)
+        {
+          builder.reset(
+              new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+        } else
+        {
+          builder.reset(
+              new opt::ArrayParameterSpaceBuilder<TcoordType, TresultType>);
+        }
+        opt::GridSearch<TcoordType, TresultType> gridsearch(
+            std::move(builder), params, threads);
+        gridsearch.constructParameterSpace();
+
+        BatchSum batch_app;
+        batch_app.setBlockSize(block_size);
+        gridsearch.execute(batch_app);
+
+        std::cout << names[b] << " grid, " << threads << " threads, "
+          << "block size " << block_size << ": " << batch_app.getPoints()
+          << " nodes computed, blocks "
+          << (batch_app.getBlocks() <= batch_app.getPoints()/10 ?
+              "batched" : "unbatched")
+          << ", misaligned spans " << batch_app.getMisaligned()
+          << ", mismatches "
+          << compare(reference.getParameterSpace(),
+              gridsearch.getParameterSpace())
+          << std::endl;
+      }
+    }
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF batchvisitortest.cc  ----- */
@@ -0,0 +1,399 @@
+/*! \file benchmark.cc
+ * \brief Microbenchmarks of builders, iterators and global algorithms.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Microbenchmarks of builders, iterators and global algorithms. The
+ * results are written to stdout as CSV to track scaling curves
+ * between releases.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Batch application on an array grid.
+ * 14/10/2026  V0.3  Teardown of parameter spaces.
+ * 
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <limits>
+#include <cmath>
+#include <cstdlib>
+#include <boost/thread.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/arraybuilder.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+typedef opt::StandardParameterSpaceBuilder<TcoordType, TresultType>
+  Tstandard;
+typedef opt::ArrayParameterSpaceBuilder<TcoordType, TresultType> Tarray;
+typedef std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>>
+  Tparameters;
+
+//! Application calculating the sum of squares of the parameters.
+class SumOfSquares :
+  public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      TcoordType const* params = node->getCoordinateData();
+      TresultType result = 0;
+      for (size_t i = 0; i < node->getDimensions(); ++i)
+      {
+        result += params[i] * params[i];
+      }
+      node->setResultData(result);
+    }
+    //! create a clone for a worker thread
+    virtual std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+      TresultType>> clone() const
+    {
+      return std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+             TresultType>>(new SumOfSquares);
+    }
+
+}; // class SumOfSquares
+
+//! Batch application calculating the sum of squares of the parameters.
+class BatchSumOfSquares :
+  public opt::BatchParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a block of grid points.
+    virtual void operator()(
+        opt::CoordinateBlock<TcoordType, TresultType> const& block)
+    {
+      TresultType* results = block.getResults();
+      size_t const size = block.getSize();
+      for (size_t i = 0; i < size; ++i) { results[i] = 0; }
+      for (size_t d = 0; d < block.getDimensions(); ++d)
+      {
+        TcoordType const* column = block.getColumn(d);
+        for (size_t i = 0; i < size; ++i)
+        {
+          results[i] += column[i]*column[i];
+        }
+      }
+    }
+
+}; // class BatchSumOfSquares
+
+//! Timings of the repetitions of a benchmark.
+struct Timing
+{
+  //! constructor
+  Timing() : Mmin(std::numeric_limits<double>::max()), Mtotal(0), Mcount(0)
+  { }
+  //! add the duration of a repetition in seconds
+  void add(double const seconds)
+  {
+    Mmin = std::min(Mmin, seconds);
+    Mtotal += seconds;
+    ++Mcount;
+  }
+  //! shortest repetition
+  double Mmin;
+  //! total of all repetitions
+  double Mtotal;
+  //! number of repetitions
+  size_t Mcount;
+}; // struct Timing
+
+//! measure the duration of \c reps calls of a function object
+template <typename Cfunction>
+Timing measure(size_t const reps, Cfunction f)
+{
+  Timing timing;
+  for (size_t i = 0; i < reps; ++i)
+  {
+    boost::posix_time::ptime const start(
+        boost::posix_time::microsec_clock::universal_time());
+    f();
+    boost::posix_time::time_duration const elapsed(
+        boost::posix_time::microsec_clock::universal_time()-start);
+    timing.add(elapsed.total_microseconds()*1e-6);
+  }
+  return timing;
+}
+
+//! measure the disposal of \c reps parameter spaces built by a builder
+template <typename Cbuilder>
+Timing measureTeardown(size_t const reps, Tparameters const& params)
+{
+  Timing timing;
+  for (size_t i = 0; i < reps; ++i)
+  {
+    Cbuilder builder;
+    builder.buildParameterSpace();
+    builder.buildGrid(params);
+    std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+        builder.getParameterSpace());
+    boost::posix_time::ptime const start(
+        boost::posix_time::microsec_clock::universal_time());
+    space.reset();
+    boost::posix_time::time_duration const elapsed(
+        boost::posix_time::microsec_clock::universal_time()-start);
+    timing.add(elapsed.total_microseconds()*1e-6);
+  }
+  return timing;
+}
+
+//! measure the disposal of parameter spaces of nodes of fixed dimension
+Timing measureFixedTeardown(size_t const dims, size_t const reps,
+    Tparameters const& params)
+{
+  switch (dims)
+  {
+    case 1: return measureTeardown<opt::StandardParameterSpaceBuilder<
+              TcoordType, TresultType, 1>>(reps, params);
+    case 2: return measureTeardown<opt::StandardParameterSpaceBuilder<
+              TcoordType, TresultType, 2>>(reps, params);
+    case 3: return measureTeardown<opt::StandardParameterSpaceBuilder<
+              TcoordType, TresultType, 3>>(reps, params);
+    default: return measureTeardown<opt::StandardParameterSpaceBuilder<
+              TcoordType, TresultType, 4>>(reps, params);
+  }
+}
+
+/*!
+ * write a CSV record of a benchmark
+ *
+ * \param benchmark name of the benchmark
+ * \param variant variant of the benchmark (e.g. the iterator type)
+ * \param dims number of dimensions of the parameter space
+ * \param nodes number of nodes of the parameter space
+ * \param items number of items (nodes, samples, seeks) a repetition
+ * processes
+ * \param threads number of threads - zero for single threading
+ * \param timing timings of the repetitions
+ */
+void report(std::string const& benchmark, std::string const& variant,
+    size_t const dims, size_t const nodes, size_t const items,
+    size_t const threads, Timing const& timing)
+{
+  std::cout << benchmark << "," << variant << "," << dims << "," << nodes
+    << "," << items << "," << threads << "," << timing.Mcount << ","
+    << timing.Mmin << "," << timing.Mtotal/timing.Mcount << ","
+    << timing.Mmin*1e9/std::max<size_t>(1, items) << std::endl;
+}
+
+//! create \c dims parameters with \c num points each
+Tparameters createParameters(size_t const dims, size_t const num)
+{
+  Tparameters params;
+  for (size_t i = 0; i < dims; ++i)
+  {
+    std::ostringstream id;
+    id << "param" << i;
+    params.push_back(std::shared_ptr<opt::Parameter<TcoordType> const>(
+          new opt::StandardParameter<TcoordType>(id.str(), 0, num-1, 1.)));
+  }
+  return params;
+}
+
+//! name of an iterator type
+char const* getName(opt::EiteratorType const type)
+{
+  switch (type)
+  {
+    case opt::ForwardIter: return "ForwardIter";
+    case opt::ForwardGridIter: return "ForwardGridIter";
+    case opt::ForwardNodeIter: return "ForwardNodeIter";
+    case opt::ReverseIter: return "ReverseIter";
+    case opt::ReverseGridIter: return "ReverseGridIter";
+    case opt::ReverseNodeIter: return "ReverseNodeIter";
+    case opt::RandomAccessNodeIter: return "RandomAccessNodeIter";
+    default: return "NullIter";
+  }
+}
+
+//! run the benchmarks of a single grid configuration
+void run(size_t const dims, size_t const num, size_t const reps,
+    std::vector<size_t> const& threads)
+{
+  Tparameters const params(createParameters(dims, num));
+  size_t nodes = 1;
+  for (size_t i = 0; i < dims; ++i) { nodes *= num; }
+
+  // builder
+  report("build", "StandardParameterSpaceBuilder", dims, nodes, nodes, 0,
+      measure(reps, [&params]()
+        {
+          Tstandard builder;
+          builder.buildParameterSpace();
+          builder.buildGrid(params);
+          std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+              builder.getParameterSpace());
+        }));
+
+  // teardown - nodes of fixed dimension are trivially disposable
+  report("teardown", "StandardParameterSpaceBuilder", dims, nodes, nodes, 0,
+      measureTeardown<Tstandard>(reps, params));
+  report("teardown", "StandardParameterSpaceBuilder/fixed", dims, nodes,
+      nodes, 0, measureFixedTeardown(dims, reps, params));
+
+  Tstandard builder;
+  builder.buildParameterSpace();
+  builder.buildGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+      builder.getParameterSpace());
+
+  // traversals
+  opt::EiteratorType const types[] = { opt::ForwardIter, opt::ForwardGridIter,
+    opt::ForwardNodeIter, opt::ReverseIter, opt::ReverseGridIter,
+    opt::ReverseNodeIter, opt::RandomAccessNodeIter };
+  for (size_t t = 0; t < sizeof(types)/sizeof(types[0]); ++t)
+  {
+    size_t count = 0;
+    opt::Iterator<TcoordType, TresultType> iter(
+        space->createIterator(types[t]));
+    report("traverse", getName(types[t]), dims, nodes, nodes, 0,
+        measure(reps, [&iter, &count]()
+          {
+            for (iter.first(); !iter.isDone(); ++iter) { ++count; }
+          }));
+  }
+
+  // advance and distance - seeks to positions spread over the nodes
+  size_t const seeks = 64;
+  opt::EiteratorType const seek_types[] = { opt::ForwardNodeIter,
+    opt::RandomAccessNodeIter };
+  for (size_t t = 0; t < 2; ++t)
+  {
+    opt::Iterator<TcoordType, TresultType> first(
+        space->createIterator(seek_types[t]));
+    first.first();
+    std::vector<opt::Iterator<TcoordType, TresultType>> targets(seeks, first);
+    report("advance", getName(seek_types[t]), dims, nodes, seeks, 0,
+        measure(reps, [&first, &targets, nodes, seeks]()
+          {
+            for (size_t i = 0; i < seeks; ++i)
+            {
+              targets[i] = first;
+              opt::advance(targets[i], i*(nodes/seeks));
+            }
+          }));
+    size_t dist = 0;
+    report("distance", getName(seek_types[t]), dims, nodes, seeks, 0,
+        measure(reps, [&first, &targets, &dist, seeks]()
+          {
+            for (size_t i = 0; i < seeks; ++i)
+            {
+              dist += opt::distance(first, targets[i]);
+            }
+          }));
+    if (dist == 0 && 1 < nodes) { std::cerr << "Invalid seeks." << std::endl; }
+  }
+
+  // global algorithms
+  for (auto cit(threads.cbegin()); cit != threads.cend(); ++cit)
+  {
+    opt::GridSearch<TcoordType, TresultType> gridsearch(
+        std::unique_ptr<Tstandard>(new Tstandard), params, *cit);
+    gridsearch.constructParameterSpace();
+    SumOfSquares app;
+    report("execute", "GridSearch", dims, nodes, nodes, *cit,
+        measure(reps, [&gridsearch, &app]() { gridsearch.execute(app); }));
+  }
+  for (auto cit(threads.cbegin()); cit != threads.cend(); ++cit)
+  {
+    opt::GridSearch<TcoordType, TresultType> gridsearch(
+        std::unique_ptr<Tarray>(new Tarray), params, *cit);
+    gridsearch.constructParameterSpace();
+    SumOfSquares app;
+    report("execute", "GridSearch/array", dims, nodes, nodes, *cit,
+        measure(reps, [&gridsearch, &app]() { gridsearch.execute(app); }));
+    BatchSumOfSquares batch_app;
+    report("execute", "GridSearch/array/batch", dims, nodes, nodes, *cit,
+        measure(reps, [&gridsearch, &batch_app]()
+          {
+            gridsearch.execute(batch_app);
+          }));
+  }
+  for (auto cit(threads.cbegin()); cit != threads.cend(); ++cit)
+  {
+    float const percent = 10;
+    opt::MonteCarlo<TcoordType, TresultType> montecarlo(
+        std::unique_ptr<Tstandard>(new Tstandard), params, opt::UniformInt,
+        percent, *cit);
+    montecarlo.constructParameterSpace();
+    SumOfSquares app;
+    report("execute", "MonteCarlo", dims, nodes, nodes*percent/100, *cit,
+        measure(reps, [&montecarlo, &app]() { montecarlo.execute(app); }));
+  }
+}
+
+/*!
+ * usage: benchmark [repetitions [max_nodes]]
+ */
+int main(int iargc, char* argv[])
+{
+  size_t const reps = 1 < iargc ? std::atol(argv[1]) : 3;
+  size_t const max_nodes = 2 < iargc ? std::atol(argv[2]) : 100000;
+
+  // thread counts of the global algorithms - zero for single threading
+  std::vector<size_t> threads;
+  threads.push_back(0);
+  for (size_t n = 1; n <= std::max(1u, boost::thread::hardware_concurrency());
+      n *= 2)
+  {
+    threads.push_back(n);
+  }
+
+  std::cout << "benchmark,variant,dimensions,nodes,items,threads,"
+    << "repetitions,min_s,mean_s,min_ns_per_item" << std::endl;
+  for (size_t dims = 1; dims <= 4; ++dims)
+  {
+    for (size_t size = 1000; size <= max_nodes; size *= 10)
+    {
+      size_t const num = static_cast<size_t>(
+          std::floor(std::pow(double(size), 1./dims)+0.5));
+      run(dims, num, reps, threads);
+    }
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF benchmark.cc  ----- */
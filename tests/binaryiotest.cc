@@ -0,0 +1,179 @@
+/*! \file binaryiotest.cc
+ * \brief Test binary export and import of a parameter space.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test binary export and import of a parameter space.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/binaryio.h>
+#include <optimizexx/mappedgrid.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! Application calculating the sum of the parameters.
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+      node->setComputed();
+    }
+}; // class Sum
+
+/*!
+ * compare two parameter spaces node by node
+ *
+ * \return number of mismatching nodes
+ */
+size_t compare(opt::GridComponent<TcoordType, TresultType> const& lhs,
+    opt::GridComponent<TcoordType, TresultType> const& rhs)
+{
+  size_t num_mismatches = 0;
+  opt::Iterator<TcoordType, TresultType> it_lhs(
+      lhs.createIterator(opt::ForwardNodeIter));
+  opt::Iterator<TcoordType, TresultType> it_rhs(
+      rhs.createIterator(opt::ForwardNodeIter));
+  for (it_lhs.first(), it_rhs.first(); !it_lhs.isDone() && !it_rhs.isDone();
+      ++it_lhs, ++it_rhs)
+  {
+    if ((*it_lhs)->getCoordinates() != (*it_rhs)->getCoordinates() ||
+        (*it_lhs)->getResultData() != (*it_rhs)->getResultData() ||
+        (*it_lhs)->isComputed() != (*it_rhs)->isComputed())
+    {
+      ++num_mismatches;
+    }
+  }
+  if (!it_lhs.isDone() || !it_rhs.isDone()) { ++num_mismatches; }
+  return num_mismatches;
+}
+
+int main()
+{
+  char const* filename = "binaryiotest.bin";
+
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25,"m"));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+    builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+      params, 4);
+  gridsearch.constructParameterSpace();
+  Sum app;
+  gridsearch.execute(app);
+
+  typedef opt::BinaryFormat<TcoordType, TresultType> Tformat;
+  // export
+  std::stringstream ss;
+  Tformat::write(ss, gridsearch.getParameterSpace(), params);
+  std::cout << "Size of binary parameter space: " << ss.str().size()
+    << " bytes" << std::endl;
+
+  // import
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> loaded;
+  std::unique_ptr<opt::ArrayGrid<TcoordType, TresultType>> grid(
+      Tformat::read(ss, &loaded));
+  std::cout << "Imported grid points: " << grid->size() << "\n"
+    << "Mismatches: " << compare(gridsearch.getParameterSpace(), *grid)
+    << std::endl;
+  for (auto cit(loaded.cbegin()); cit != loaded.cend(); ++cit)
+  {
+    std::cout << (*cit)->getId() << ": start: " << (*cit)->getStart()
+      << " end: " << (*cit)->getEnd() << " delta: " << (*cit)->getDelta()
+      << " unit: '" << (*cit)->getUnit() << "'" << std::endl;
+  }
+  std::cout << "Coordinate ids:";
+  for (auto cit(grid->getCoordinateId().cbegin());
+      cit != grid->getCoordinateId().cend(); ++cit)
+  {
+    std::cout << " " << *cit;
+  }
+  std::cout << std::endl;
+
+  // export an array grid once again - columns are written directly
+  std::stringstream ss_array;
+  Tformat::write(ss_array, *grid, loaded);
+  std::cout << "Identical export of array grid: "
+    << (ss_array.str() == ss.str() ? "yes" : "no") << std::endl;
+
+  // map read-only
+  {
+    std::ofstream ofs(filename, std::ios::binary);
+    ofs << ss.str();
+  }
+  {
+    opt::MappedGrid<TcoordType, TresultType> mapped(filename);
+    std::cout << "Mapped grid points: " << mapped.size() << "\n"
+      << "Mismatches: " << compare(gridsearch.getParameterSpace(), mapped)
+      << std::endl;
+  }
+  std::remove(filename);
+
+  return 0;
+} // function main
+
+/* ----- END OF binaryiotest.cc  ----- */
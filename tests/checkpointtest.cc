@@ -0,0 +1,124 @@
+/*! \file checkpointtest.cc
+ * \brief Test checkpoint/resume of global algorithms.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test checkpoint/resume of global algorithms.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Use the fixture of testhelper.h.
+ * 14/10/2026  V0.3  Enable unique sampling.
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <cmath>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/error.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+#include "testhelper.h"
+
+int main()
+{
+  char const* filename = "checkpointtest.ckpt";
+  std::remove(filename);
+
+  // create parameters
+  std::vector<Tparameter> params(createParameters());
+
+  std::cout << "------------------\n"
+    << "Interrupted run (MonteCarlo, 50%)\n"
+    << "------------------" << std::endl;
+  {
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::MonteCarlo<TcoordType, TresultType> montecarlo(std::move(builder),
+        params, opt::UniformInt, 50, 4);
+    montecarlo.setSeed(42);
+    montecarlo.setUniqueSampling(true);
+    montecarlo.setCheckpointFile(filename);
+    montecarlo.constructParameterSpace();
+    Sum app;
+    montecarlo.execute(app);
+    std::cout << "Visited nodes: " << app.getCount() << std::endl;
+    report(montecarlo.getParameterSpace(), true);
+  }
+
+  // resume twice - the second run does not compute anything
+  for (size_t run = 1; run <= 2; ++run)
+  {
+    std::cout << "------------------\n"
+      << "Resumed run " << run << " (GridSearch)\n"
+      << "------------------" << std::endl;
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params, 4);
+    gridsearch.setCheckpointFile(filename);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    gridsearch.execute(app);
+    std::cout << "Visited nodes: " << app.getCount() << std::endl;
+    report(gridsearch.getParameterSpace(), true);
+  }
+
+  std::cout << "------------------\n"
+    << "Mismatching parameter space\n"
+    << "------------------" << std::endl;
+  {
+    params.pop_back();
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params);
+    gridsearch.setCheckpointFile(filename);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    try
+    {
+      gridsearch.execute(app);
+    }
+    catch (opt::Exception& e)
+    {
+      std::cout << "Checkpoint file rejected." << std::endl;
+    }
+  }
+
+  std::remove(filename);
+  return 0;
+} // function main
+
+/* ----- END OF checkpointtest.cc  ----- */
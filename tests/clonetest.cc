@@ -0,0 +1,153 @@
+/*! \file clonetest.cc
+ * \brief Test per thread clones of an application.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test per thread clones of an application.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+/*!
+ * Application calculating the sum of the parameters. Each clone owns a
+ * scratch buffer and counts the nodes it visited. The counts are merged into
+ * the original application.
+ */
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    Sum() : Mcount(0), Mclones(0) { }
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      Mscratch.assign(node->getCoordinateData(),
+          node->getCoordinateData()+node->getDimensions());
+      TresultType result = 0;
+      for (auto cit(Mscratch.cbegin()); cit != Mscratch.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+      ++Mcount;
+    }
+    //! create a clone for a worker thread
+    virtual std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+      TresultType>> clone() const
+    {
+      return std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+             TresultType>>(new Sum);
+    }
+    //! merge the count of a clone
+    virtual void merge(
+        opt::ParameterSpaceVisitor<TcoordType, TresultType>& clone)
+    {
+      Mcount += static_cast<Sum&>(clone).Mcount;
+      ++Mclones;
+    }
+    //! query function for the number of visited nodes
+    size_t getCount() const { return Mcount; }
+    //! query function for the number of merged clones
+    size_t getClones() const { return Mclones; }
+
+  private:
+    //! scratch buffer
+    std::vector<TcoordType> Mscratch;
+    //! number of visited nodes
+    size_t Mcount;
+    //! number of merged clones
+    size_t Mclones;
+
+}; // class Sum
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  size_t const threads[] = { 0, 4 };
+  for (size_t i = 0; i < 2; ++i)
+  {
+    std::cout << "------------------\n"
+      << "Threads in use: " << threads[i] << "\n"
+      << "------------------" << std::endl;
+
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params, threads[i]);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    gridsearch.execute(app);
+    std::cout << "GridSearch: " << app.getCount() << " nodes visited by "
+      << app.getClones() << " clones" << std::endl;
+
+    builder.reset(
+        new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::MonteCarlo<TcoordType, TresultType> montecarlo(std::move(builder),
+        params, opt::UniformInt, 50, threads[i]);
+    montecarlo.setSeed(42);
+    montecarlo.constructParameterSpace();
+    Sum mc_app;
+    montecarlo.execute(mc_app);
+    std::cout << "MonteCarlo: " << mc_app.getCount() << " nodes visited by "
+      << mc_app.getClones() << " clones" << std::endl;
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF clonetest.cc  ----- */
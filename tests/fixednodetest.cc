@@ -0,0 +1,224 @@
+/*! \file fixednodetest.cc
+ * \brief Test nodes of a parameter space with fixed dimension.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test nodes of a parameter space with fixed dimension.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Size and allocations of a node.
+ * 14/10/2026  V0.3  Nodes of dynamic dimension are optimize::Node.
+ * 
+ * ============================================================================
+ */
+
+// the replaced allocation and deallocation functions below are a matching
+// pair though gcc is not able to figure it out
+#if __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstdlib>
+#include <atomic>
+#include <type_traits>
+#include <algorithm>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/fixednode.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! number of calls to the global allocation function
+std::atomic<size_t> num_allocations(0);
+
+//! global allocation function counting allocations
+void* operator new(size_t size)
+{
+  ++num_allocations;
+  void* p = std::malloc(size ? size : 1);
+  if (! p) { throw std::bad_alloc(); }
+  return p;
+}
+
+//! global deallocation function
+void operator delete(void* p) throw() { std::free(p); }
+
+//! global sized deallocation function
+void operator delete(void* p, size_t size) throw() { std::free(p); }
+
+//! count the allocations when constructing a node in place
+template <typename Cnode>
+size_t countAllocations(std::vector<TcoordType> const& coordinates)
+{
+  typename std::aligned_storage<sizeof(Cnode),
+           std::alignment_of<Cnode>::value>::type memory;
+  size_t const before = num_allocations;
+  Cnode* node = new (&memory) Cnode(coordinates);
+  size_t const retval = num_allocations - before;
+  node->~Cnode();
+  return retval;
+}
+
+/*!
+ * Application calculating the sum of the coordinates by means of the raw
+ * coordinate access.
+ */
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      TcoordType const* coordinates = node->getCoordinateData();
+      TresultType result = 0;
+      for (size_t i = 0; i < node->getDimensions(); ++i)
+      {
+        result += coordinates[i];
+      }
+      node->setResultData(result);
+    }
+
+}; // class Sum
+
+//! compute the sum of the results of a grid search
+TresultType search(
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>
+    builder,
+    std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> const&
+    params, size_t threads)
+{
+  opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+      params, threads);
+  gridsearch.constructParameterSpace();
+  Sum app;
+  gridsearch.execute(app);
+  TresultType sum = 0;
+  opt::Iterator<TcoordType, TresultType> it(
+      gridsearch.getParameterSpace().createIterator(opt::ForwardNodeIter));
+  for (it.first(); !it.isDone(); ++it)
+  {
+    sum += (*it)->getResultData();
+  }
+  return sum;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",0,1.,0.1));
+
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  // nodes of fixed dimension
+  typedef opt::FixedNode<TcoordType, TresultType, 3> Tnode;
+  typedef opt::Node<TcoordType, TresultType> TdynamicNode;
+  std::vector<TcoordType> const coordinates(3, 1.);
+  std::cout << "Size overhead of a node of fixed dimension: "
+    << sizeof(Tnode) - sizeof(opt::Node<TcoordType, TresultType>)
+    - sizeof(Tnode::TfixedCoordinates) << "\n"
+    << "Not larger than a node of dynamic dimension and its coordinates: "
+    << (sizeof(Tnode) <= sizeof(TdynamicNode) + 3*sizeof(TcoordType))
+    << "\n"
+    << "Allocations per node of fixed dimension: "
+    << countAllocations<Tnode>(coordinates) << "\n"
+    << "Allocations per node of dynamic dimension: "
+    << countAllocations<TdynamicNode>(coordinates) << std::endl;
+  TdynamicNode const dynamic_node(coordinates);
+  std::cout << "Coordinates of a node of dynamic dimension referenced: "
+    << (dynamic_node.getCoordinates().data() ==
+        dynamic_node.getCoordinateData()) << std::endl;
+
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType, 3> builder;
+  builder.buildParameterSpace();
+  builder.buildGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+      builder.getParameterSpace());
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType> dyn_builder;
+  dyn_builder.buildParameterSpace();
+  dyn_builder.buildGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> dyn_space(
+      dyn_builder.getParameterSpace());
+
+  size_t num_fixed = 0;
+  size_t num_mismatches = 0;
+  auto it_dyn(dyn_space->begin());
+  for (auto it(space->begin()); it != space->end(); ++it, ++it_dyn)
+  {
+    if (dynamic_cast<Tnode*>(*it)) { ++num_fixed; }
+    opt::Node<TcoordType, TresultType> const* node =
+      static_cast<opt::Node<TcoordType, TresultType> const*>(*it);
+    if (! std::equal(node->getCoordinateData(),
+          node->getCoordinateData()+node->getDimensions(),
+          (*it_dyn)->getCoordinates().begin()))
+    {
+      ++num_mismatches;
+    }
+  }
+  std::cout << "Nodes of fixed dimension: " << num_fixed << "\n"
+    << "Mismatches: " << num_mismatches << std::endl;
+
+  // grid search
+  size_t const threads[] = { 0, 4 };
+  for (size_t i = 0; i < 2; ++i)
+  {
+    TresultType sum_fixed = search(
+        std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>(
+          new opt::StandardParameterSpaceBuilder<TcoordType, TresultType, 3>),
+        params, threads[i]);
+    TresultType sum = search(
+        std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>(
+          new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>),
+        params, threads[i]);
+    std::cout << "Threads in use: " << threads[i] << "\n"
+      << "Sum of results (fixed dimension): " << sum_fixed << "\n"
+      << "Sum of results: " << sum << std::endl;
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF fixednodetest.cc  ----- */
@@ -36,6 +36,7 @@
  * 13/03/2012   V0.1    Daniel Armbruster
  * 09/04/2012   V0.2    Both multithreading and single threading test.
  * 25/04/2012   V0.3    Make use of smart pointers and C++0x.
+ * 14/10/2026   V0.4    Really make use of multiple threads.
  * 
  * ============================================================================
  */
@@ -104,7 +105,8 @@ int main()
 
   // create gridsearch algorithm (multiple threads)
   std::unique_ptr<opt::GridSearch<TcoordType, TresultType>> gridsearch(
-    new opt::GridSearch<TcoordType, TresultType>(std::move(builder), params));
+    new opt::GridSearch<TcoordType, TresultType>(std::move(builder), params,
+      4));
 
   gridsearch->constructParameterSpace();
 
@@ -144,6 +146,7 @@ int main()
     << "--------------------" << std::endl;
 
   gridsearch->execute(app);
+  it = gridsearch->getParameterSpace().createIterator(opt::ForwardNodeIter);
   for (it.first(); !it.isDone(); ++it)
   {
     std::vector<TcoordType> const& c = (*it)->getCoordinates();
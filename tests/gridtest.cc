@@ -0,0 +1,176 @@
+/*! \file gridtest.cc
+ * \brief Test the insertion of grid components.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the insertion of grid components.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Parallel construction of nodes.
+ * 14/10/2026  V0.3  Construction on a persistent thread pool.
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/grid.h>
+#include <optimizexx/node.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/threadpool.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! count the children of a grid
+size_t countChildren(opt::GridComponent<TcoordType, TresultType>& grid)
+{
+  size_t num = 0;
+  for (auto it(grid.begin()); it != grid.end(); ++it) { ++num; }
+  return num;
+}
+
+int main()
+{
+  typedef opt::GridComponent<TcoordType, TresultType>* Tcomp_ptr;
+
+  opt::Grid<TcoordType, TresultType> grid;
+  std::vector<Tcomp_ptr> nodes;
+  for (size_t i = 0; i < 10; ++i)
+  {
+    nodes.push_back(new opt::Node<TcoordType, TresultType>(
+          std::vector<TcoordType>(1, i)));
+  }
+  grid.add(nodes[0]);
+  grid.add(nodes[0]);
+  std::cout << "Children after adding a node twice: "
+    << countChildren(grid) << std::endl;
+  grid.addRange(nodes.data(), nodes.data()+nodes.size());
+  std::cout << "Children after adding a range: "
+    << countChildren(grid) << std::endl;
+  grid.remove(nodes[5]);
+  grid.addRange(nodes.data(), nodes.data()+5);
+  std::cout << "Children after removal and adding a range once again: "
+    << countChildren(grid) << std::endl;
+
+  // large grid - insertion takes constant time
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.0025));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.005));
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType> builder;
+  builder.buildParameterSpace();
+  builder.buildGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+      builder.getParameterSpace());
+  std::cout << "Nodes of large grid: " << countChildren(*space) << std::endl;
+
+  // parallel construction
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType>
+    parallel_builder(4);
+  parallel_builder.buildParameterSpace();
+  parallel_builder.buildGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> parallel_space(
+      parallel_builder.getParameterSpace());
+  size_t num_mismatches = 0;
+  auto it(space->begin());
+  for (auto it_par(parallel_space->begin()); it_par != parallel_space->end();
+      ++it_par, ++it)
+  {
+    if ((*it)->getCoordinates() != (*it_par)->getCoordinates() ||
+        parallel_space.get() != (*it_par)->getParent())
+    {
+      ++num_mismatches;
+    }
+  }
+  std::cout << "Nodes of large grid built in parallel: "
+    << countChildren(*parallel_space) << "\n"
+    << "Mismatches: " << num_mismatches << std::endl;
+
+  // parallel construction on a persistent thread pool
+  std::shared_ptr<opt::thread::ThreadPool<TcoordType, TresultType>> pool(
+      new opt::thread::ThreadPool<TcoordType, TresultType>(4));
+  pool->initialize();
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType> pool_builder;
+  pool_builder.setThreadPool(pool);
+  size_t num_pool_mismatches = 0;
+  for (size_t build = 0; build < 2; ++build)
+  {
+    pool_builder.buildParameterSpace();
+    pool_builder.buildGrid(params);
+    std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> pool_space(
+        pool_builder.getParameterSpace());
+    auto it_ref(space->begin());
+    for (auto it_pool(pool_space->begin()); it_pool != pool_space->end();
+        ++it_pool, ++it_ref)
+    {
+      if ((*it_ref)->getCoordinates() != (*it_pool)->getCoordinates())
+      {
+        ++num_pool_mismatches;
+      }
+    }
+  }
+  std::cout << "Tasks of two builds executed by the persistent pool: "
+    << (0 < pool->getCompletedTasksCount()) << "\n"
+    << "Mismatches: " << num_pool_mismatches << std::endl;
+
+  // the builder of a global algorithm shares the algorithm's thread pool
+  std::unique_ptr<opt::StandardParameterSpaceBuilder<TcoordType,
+    TresultType>> algo_builder(
+        new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType> const* const
+    algo_builder_ptr = algo_builder.get();
+  opt::GridSearch<TcoordType, TresultType> gridsearch(
+      std::move(algo_builder), params);
+  gridsearch.setThreadPool(pool);
+  size_t const completed = pool->getCompletedTasksCount();
+  gridsearch.constructParameterSpace();
+  size_t num_nodes = 0;
+  opt::Iterator<TcoordType, TresultType> it_node(
+      gridsearch.getParameterSpace().createIterator(opt::ForwardNodeIter));
+  for (it_node.first(); !it_node.isDone(); ++it_node) { ++num_nodes; }
+  std::cout << "Builder shares the thread pool of the algorithm: "
+    << (algo_builder_ptr->getThreadPool() == pool) << "\n"
+    << "Nodes built on the shared pool: " << num_nodes << "\n"
+    << "Pool executed the build: "
+    << (completed < pool->getCompletedTasksCount()) << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF gridtest.cc  ----- */
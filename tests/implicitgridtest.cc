@@ -0,0 +1,184 @@
+/*! \file implicitgridtest.cc
+ * \brief Test implicit parameter space grid.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test implicit parameter space grid.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/implicitbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+/*!
+ * Application calculating the sum of the parameters. Since the results of an
+ * implicit grid are not stored the application keeps track of the number of
+ * visited nodes and the total of all results.
+ */
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    Sum() : Mcount(0), Mtotal(0) { }
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      ++Mcount;
+      Mtotal += result;
+    }
+    //! query function for the number of visited nodes
+    size_t getCount() const { return Mcount; }
+    //! query function for the total of all results
+    TresultType getTotal() const { return Mtotal; }
+
+  private:
+    boost::mutex Mmutex;
+    size_t Mcount;
+    TresultType Mtotal;
+
+}; // class Sum
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  // standard parameter space as reference
+  std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> builder(
+    new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> reference(std::move(builder),
+      params);
+  reference.constructParameterSpace();
+
+  // implicit parameter space
+  builder.reset(
+      new opt::ImplicitParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+      params, 4);
+  gridsearch.constructParameterSpace();
+
+  std::cout << "------------------------------\n"
+    << "Compare forward node iteration\n"
+    << "------------------------------" << std::endl;
+
+  opt::Iterator<TcoordType, TresultType> it_ref(
+      reference.getParameterSpace().createIterator(opt::ForwardNodeIter));
+  opt::Iterator<TcoordType, TresultType> it(
+      gridsearch.getParameterSpace().createIterator(opt::ForwardNodeIter));
+
+  size_t num_nodes = 0;
+  size_t num_mismatches = 0;
+  for (it_ref.first(), it.first(); !it_ref.isDone() && !it.isDone();
+      ++it_ref, ++it, ++num_nodes)
+  {
+    // the standard builder accumulates the delta intervals - so allow
+    // rounding errors
+    std::vector<TcoordType> const& c_ref = (*it_ref)->getCoordinates();
+    std::vector<TcoordType> const& c = (*it)->getCoordinates();
+    for (size_t i = 0; i < c.size(); ++i)
+    {
+      if (std::fabs(c_ref[i]-c[i]) > 1e-9) { ++num_mismatches; break; }
+    }
+  }
+  std::cout << "Number of nodes: " << num_nodes << std::endl;
+  std::cout << "Both iterators done: " << std::boolalpha 
+    << (it_ref.isDone() && it.isDone()) << std::endl;
+  std::cout << "Mismatching coordinates: " << num_mismatches << std::endl;
+
+  std::cout << "------------------------------\n"
+    << "Compare reverse node iteration\n"
+    << "------------------------------" << std::endl;
+
+  it = gridsearch.getParameterSpace().createIterator(opt::ReverseNodeIter);
+  for (it.first(); !it.isDone(); ++it)
+  {
+    std::vector<TcoordType> const& c = (*it)->getCoordinates();
+    for (auto cit(c.cbegin()); cit != c.cend(); ++cit)
+    {
+      std::cout << *cit << " ";
+    }
+    std::cout << std::endl;
+    if (c[2] < -0.9) { break; }
+  }
+
+  std::cout << "-----------------------\n"
+    << "Multiple threads in use\n"
+    << "-----------------------" << std::endl;
+
+  Sum app;
+  gridsearch.execute(app);
+  std::cout << "Visited nodes: " << app.getCount() << std::endl;
+  std::cout << "Total of results: " << app.getTotal() << std::endl;
+
+  Sum app_ref;
+  reference.execute(app_ref);
+  std::cout << "Total of results (reference): " << app_ref.getTotal()
+    << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF implicitgridtest.cc  ----- */
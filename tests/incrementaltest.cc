@@ -0,0 +1,148 @@
+/*! \file incrementaltest.cc
+ * \brief Test the incremental rebuild of a parameter space.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the incremental rebuild of a parameter space.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Use the fixture of testhelper.h.
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include "testhelper.h"
+
+/*!
+ * print the number of nodes, the number of wrong results, the number of
+ * computed nodes and if the nodes are ordered as in a parameter space
+ * constructed from scratch
+ */
+void report(opt::GridSearch<TcoordType, TresultType> const& gridsearch)
+{
+  std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+    builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> reference(std::move(builder),
+      gridsearch.getParameters());
+  reference.constructParameterSpace();
+
+  opt::GridComponent<TcoordType, TresultType> const& space(
+      gridsearch.getParameterSpace());
+  bool ordered = true;
+  opt::Iterator<TcoordType, TresultType> it(
+      space.createIterator(opt::ForwardNodeIter));
+  opt::Iterator<TcoordType, TresultType> ref(
+      reference.getParameterSpace().createIterator(opt::ForwardNodeIter));
+  for (it.first(), ref.first(); !it.isDone() && !ref.isDone() && ordered;
+      ++it, ++ref)
+  {
+    std::vector<TcoordType> const params((*it)->getCoordinates());
+    std::vector<TcoordType> const ref_params((*ref)->getCoordinates());
+    ordered = params.size() == ref_params.size();
+    for (size_t i = 0; i < params.size() && ordered; ++i)
+    {
+      ordered = std::fabs(params[i] - ref_params[i]) < 1e-12;
+    }
+  }
+  ordered = ordered && it.isDone() && ref.isDone();
+  report(space);
+  std::cout << "Computed nodes: " << countNodes(space, true) << "\n"
+    << "Ordered as built from scratch: " << ordered << std::endl;
+}
+
+/*!
+ * execute the grid search and print the number of visited nodes
+ */
+void run(opt::GridSearch<TcoordType, TresultType>& gridsearch)
+{
+  Sum app(true);
+  gridsearch.execute(app);
+  std::cout << "Visited nodes: " << app.getCount() << std::endl;
+  report(gridsearch);
+}
+
+int main()
+{
+  // create parameters
+  std::vector<Tparameter> params;
+  params.push_back(Tparameter(
+        new opt::StandardParameter<TcoordType>("param1",0,1.,0.25)));
+  params.push_back(Tparameter(
+        new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5)));
+
+  for (size_t num_threads = 0; num_threads <= 4; num_threads += 4)
+  {
+    std::cout << "------------------\n"
+      << "Threads: " << num_threads << "\n"
+      << "------------------" << std::endl;
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params, num_threads);
+    gridsearch.setIncremental(true);
+    gridsearch.constructParameterSpace();
+    run(gridsearch);
+
+    std::cout << "Widened range and refined samples" << std::endl;
+    gridsearch.setParameter(0, Tparameter(
+          new opt::StandardParameter<TcoordType>("param1",-0.5,1.5,0.25)));
+    gridsearch.setParameter(1, Tparameter(
+          new opt::StandardParameter<TcoordType>("param2",-1,1.,0.25)));
+    gridsearch.updateParameterSpace();
+    run(gridsearch);
+
+    std::cout << "Narrowed range" << std::endl;
+    gridsearch.setParameter(0, Tparameter(
+          new opt::StandardParameter<TcoordType>("param1",0,1.,0.5)));
+    gridsearch.updateParameterSpace();
+    run(gridsearch);
+
+    std::cout << "Additional parameter (rebuilt from scratch)" << std::endl;
+    gridsearch.addParameter(Tparameter(
+          new opt::StandardParameter<TcoordType>("param3",0,1.,0.5)));
+    gridsearch.updateParameterSpace();
+    run(gridsearch);
+
+    std::cout << "Non-incremental execution" << std::endl;
+    gridsearch.setIncremental(false);
+    run(gridsearch);
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF incrementaltest.cc  ----- */
@@ -0,0 +1,177 @@
+/*! \file instrumentationtest.cc
+ * \brief Test the instrumentation of global algorithms.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the instrumentation of global algorithms.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+// compile the instrumentation in
+#define OPTIMIZE_INSTRUMENTATION
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <numeric>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/instrumentation.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! Application calculating the sum of the parameters.
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+    }
+    //! create a clone for a worker thread
+    virtual std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+      TresultType>> clone() const
+    {
+      return std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+             TresultType>>(new Sum);
+    }
+
+}; // class Sum
+
+//! print a summary of the instrumentation
+void report(opt::Instrumentation const& instr)
+{
+  size_t tasks = 0;
+  size_t nodes = 0;
+  for (size_t i = 0; i < instr.getNumWorkers(); ++i)
+  {
+    tasks += instr.getTaskCount(i);
+    nodes += instr.getNodeCount(i);
+  }
+  std::vector<size_t> const histogram(instr.getLatencyHistogram());
+  std::cout << "Visitor calls: " << instr.getVisitCount() << "\n"
+    << "Calls within the latency histogram: "
+    << std::accumulate(histogram.begin(), histogram.end(), size_t(0)) << "\n"
+    << "Nodes computed by the workers: " << nodes << "\n"
+    << "Tasks consistent: " << (tasks == instr.getQueuedTaskCount()) << "\n"
+    << "Construction timed: "
+    << (0 < instr.getPhaseTime(opt::Instrumentation::Construction)) << "\n"
+    << "Execution timed: "
+    << (0 < instr.getPhaseTime(opt::Instrumentation::Execution)) << "\n"
+    << "Waiting within execution: "
+    << (instr.getPhaseTime(opt::Instrumentation::Waiting) <=
+        instr.getPhaseTime(opt::Instrumentation::Execution)) << "\n"
+    << "Queue waits consistent: "
+    << (instr.getMaxQueueWaitTime() <= instr.getQueueWaitTime())
+    << std::endl;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  typedef opt::StandardParameterSpaceBuilder<TcoordType, TresultType>
+    Tstandard;
+
+  std::cout << "Instrumentation enabled: "
+    << opt::Instrumentation::isEnabled() << std::endl;
+
+  std::cout << "------------------\n"
+    << "GridSearch (single threaded)\n"
+    << "------------------" << std::endl;
+  {
+    opt::GridSearch<TcoordType, TresultType> gridsearch(
+        std::unique_ptr<Tstandard>(new Tstandard), params);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    gridsearch.execute(app);
+    report(gridsearch.getInstrumentation());
+  }
+
+  std::cout << "------------------\n"
+    << "GridSearch (thread pool)\n"
+    << "------------------" << std::endl;
+  {
+    opt::GridSearch<TcoordType, TresultType> gridsearch(
+        std::unique_ptr<Tstandard>(new Tstandard), params, 4);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    gridsearch.execute(app);
+    report(gridsearch.getInstrumentation());
+    std::cout << "Workers: " << gridsearch.getInstrumentation().getNumWorkers()
+      << std::endl;
+    gridsearch.getInstrumentation().reset();
+    std::cout << "Visitor calls after reset: "
+      << gridsearch.getInstrumentation().getVisitCount() << std::endl;
+  }
+
+  std::cout << "------------------\n"
+    << "MonteCarlo (thread pool)\n"
+    << "------------------" << std::endl;
+  {
+    opt::MonteCarlo<TcoordType, TresultType> montecarlo(
+        std::unique_ptr<Tstandard>(new Tstandard), params, opt::UniformInt,
+        50., 4);
+    montecarlo.constructParameterSpace();
+    Sum app;
+    montecarlo.execute(app);
+    report(montecarlo.getInstrumentation());
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF instrumentationtest.cc  ----- */
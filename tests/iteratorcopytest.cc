@@ -0,0 +1,189 @@
+/*! \file iteratorcopytest.cc
+ * \brief Test copying and advancing parameter space iterators.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test copying and advancing parameter space iterators.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Grids nested deeper than the inline memento capacity.
+ * 
+ * ============================================================================
+ */
+
+// the replaced allocation and deallocation functions below are a matching
+// pair though gcc is not able to figure it out
+#if __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstdlib>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/grid.h>
+#include <optimizexx/node.h>
+#include <optimizexx/iterator.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! number of calls to the global allocation function
+size_t num_allocations = 0;
+
+//! global allocation function counting allocations
+void* operator new(size_t size)
+{
+  ++num_allocations;
+  void* p = std::malloc(size ? size : 1);
+  if (! p) { throw std::bad_alloc(); }
+  return p;
+}
+
+//! global deallocation function
+void operator delete(void* p) throw() { std::free(p); }
+
+//! global sized deallocation function
+void operator delete(void* p, size_t size) throw() { std::free(p); }
+
+//! print the dimensions of the grids an iterator visits
+void printGrids(opt::GridComponent<TcoordType, TresultType>& space,
+    opt::EiteratorType type, opt::EiterationMode mode)
+{
+  opt::Iterator<TcoordType, TresultType> it(space.createIterator(type, mode));
+  for (it.first(); !it.isDone(); ++it)
+  {
+    std::cout << (*it)->getCoordinateId().size() << " ";
+  }
+  std::cout << std::endl;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> sub_params;
+  sub_params.push_back(param1);
+
+  // parameter space with nested subgrids
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType> builder;
+  builder.buildParameterSpace();
+  builder.buildGrid(params);
+  builder.buildSubGrid(sub_params);
+  builder.buildSubGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+      builder.getParameterSpace());
+
+  // iterate nodes of the grid and its subgrids
+  size_t num_nodes = 0;
+  opt::Iterator<TcoordType, TresultType> it(
+      space->createIterator(opt::ForwardNodeIter));
+  for (it.first(); !it.isDone(); ++it) { ++num_nodes; }
+  size_t num_reverse_nodes = 0;
+  opt::Iterator<TcoordType, TresultType> rit(
+      space->createIterator(opt::ReverseNodeIter));
+  for (rit.first(); !rit.isDone(); ++rit) { ++num_reverse_nodes; }
+  std::cout << "Nodes: " << num_nodes << "\n"
+    << "Nodes (reverse): " << num_reverse_nodes << std::endl;
+
+  // dimensions of the subgrids visited
+  std::cout << "Subgrids (pre-order): ";
+  printGrids(*space, opt::ForwardGridIter, opt::PreOrder);
+  std::cout << "Subgrids (reverse, post-order): ";
+  printGrids(*space, opt::ReverseGridIter, opt::PostOrder);
+
+  // copying and advancing iterators
+  it.first();
+  size_t const allocations = num_allocations;
+  opt::Iterator<TcoordType, TresultType> last_it(it);
+  last_it.back();
+  size_t const distance = opt::distance(it, last_it);
+  opt::advance(it, 5);
+  opt::Iterator<TcoordType, TresultType> copy_it(it++);
+  copy_it = it;
+  std::cout << "Distance first to last: " << distance << "\n"
+    << "Allocations copying and advancing iterators: "
+    << num_allocations-allocations << std::endl;
+
+  // grids nested deeper than the inline capacity of the memento - each
+  // level holds a node and the grid of the next level
+  size_t const depth = 20;
+  opt::Grid<TcoordType, TresultType> deep_space;
+  opt::Grid<TcoordType, TresultType>* grid = &deep_space;
+  for (size_t i = 0; i < depth; ++i)
+  {
+    grid->add(new opt::Node<TcoordType, TresultType>(
+          std::vector<TcoordType>(1, i)));
+    opt::Grid<TcoordType, TresultType>* subgrid =
+      new opt::Grid<TcoordType, TresultType>;
+    grid->add(subgrid);
+    grid = subgrid;
+  }
+  TcoordType sum = 0;
+  opt::Iterator<TcoordType, TresultType> deep_it(
+      deep_space.createIterator(opt::ForwardNodeIter));
+  for (deep_it.first(); !deep_it.isDone(); ++deep_it)
+  {
+    sum += (*deep_it)->getCoordinates()[0];
+  }
+  size_t num_deep_grids[2] = { 0, 0 };
+  opt::EiterationMode const modes[] = { opt::PreOrder, opt::PostOrder };
+  for (size_t i = 0; i < 2; ++i)
+  {
+    opt::Iterator<TcoordType, TresultType> grid_it(
+        deep_space.createIterator(opt::ReverseGridIter, modes[i]));
+    for (grid_it.first(); !grid_it.isDone(); ++grid_it)
+    {
+      ++num_deep_grids[i];
+    }
+  }
+  deep_it.first();
+  opt::advance(deep_it, depth-1);
+  opt::Iterator<TcoordType, TresultType> deep_copy(deep_it);
+  std::cout << "Depth of nested grids: " << depth << "\n"
+    << "Sum of the node coordinates: " << sum << "\n"
+    << "Subgrids (pre-order): " << num_deep_grids[0] << "\n"
+    << "Subgrids (post-order): " << num_deep_grids[1] << "\n"
+    << "Deepest node of the copy: " << (*deep_copy)->getCoordinates()[0]
+    << "\n"
+    << "Copy at the end: " << (++deep_copy).isDone() << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF iteratorcopytest.cc  ----- */
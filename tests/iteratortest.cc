@@ -31,6 +31,7 @@
  * REVISIONS and CHANGES 
  * 13/03/2012   V0.1    Daniel Armbruster
  * 25/04/2012   V0.2    Make use of smart pointers and C++0x.
+ * 14/10/2026   V0.3    Random access node iterator test.
  * 
  * ============================================================================
  */
@@ -129,6 +130,36 @@ int main ()
     it.next();
   }
 
+  std::cout << "------------------------------------" << std::endl;
+  std::cout << "Testing random access node iterator:" << std::endl;
+  std::cout << "------------------------------------" << std::endl;
+  it = parameterSpace->createIterator(opt::RandomAccessNodeIter);
+  it.first();
+  opt::Iterator<TcoordType, TresultType> last_it(it);
+  last_it.back();
+  std::cout << "Random access: " << std::boolalpha << it.isRandomAccess()
+    << std::endl;
+  std::cout << "Number of nodes: " << it.getSize() << std::endl;
+  std::cout << "Distance first to last: " << opt::distance(it, last_it)
+    << std::endl;
+
+  for (size_t n = 0; n < it.getSize(); n += 2)
+  {
+    it.first();
+    opt::advance(it, n);
+    std::cout << "advance(" << n << "): ";
+    std::vector<TcoordType> const& c = (*it)->getCoordinates();
+    for (auto cit(c.cbegin()); cit != c.cend(); ++cit)
+    {
+      std::cout << *cit << " ";
+    }
+    std::cout << std::endl;
+  }
+  it.first();
+  opt::advance(it, 100);
+  std::cout << "advance(100) points to last node: " << (it == last_it)
+    << std::endl;
+
   std::cout << "------------------------------" << std::endl;
   std::cout << "Testing reverse node iterator:" << std::endl;
   std::cout << "------------------------------" << std::endl;
@@ -0,0 +1,165 @@
+/*! \file localsearchtest.cc
+ * \brief Test the local search seeded from grid results.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the local search seeded from grid results.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include <optimizexx/globalalgorithms/localsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! application calculating a Rosenbrock like function with its minimum off
+//! the grid at (0.3, -0.45)
+class Valley : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    Valley() : Mcount(0) { }
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& c = node->getCoordinates();
+      double const x = c[0]-0.3;
+      double const y = c[1]+0.45;
+      node->setResultData(x*x + 10*(y-x*x)*(y-x*x));
+      ++Mcount;
+    }
+    //! query function for the number of nodes computed
+    size_t getCount() const { return Mcount; }
+
+  private:
+    std::atomic<size_t> Mcount;
+
+}; // class Valley
+
+//! print a node
+void print(opt::Node<TcoordType, TresultType> const* node)
+{
+  std::vector<TcoordType> const& c = node->getCoordinates();
+  for (auto cit(c.cbegin()); cit != c.cend(); ++cit)
+  {
+    std::cout << std::fixed << std::setprecision(3) << *cit << " ";
+  }
+  std::cout << std::setprecision(6) << node->getResultData() << std::endl;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",-1.,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1.,1.,0.25));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+
+  // seed from the coarse grid of the local search itself
+  opt::ElocalSearch const methods[] = { opt::NelderMead, opt::CompassSearch };
+  char const* const names[] = { "Nelder-Mead", "compass search" };
+  for (size_t m = 0; m < 2; ++m)
+  {
+    for (size_t threads = 0; threads <= 4; threads += 4)
+    {
+      std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+        builder(
+            new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+      opt::LocalSearch<TcoordType, TresultType> search(
+          std::move(builder), params, methods[m], 3, threads);
+      search.setTolerance(1e-4);
+      search.constructParameterSpace();
+
+      Valley app;
+      search.execute(app);
+
+      std::cout << names[m] << " (" << threads << " threads): "
+        << app.getCount() << " nodes computed, " << search.getEvaluations()
+        << " off the grid, " << search.getBestNodes().size()
+        << " optima" << std::endl << "  best node ";
+      print(search.getBestNodes()[0]);
+    }
+  }
+
+  // seed from the results of a grid search
+  std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+    grid_builder(
+        new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> grid_search(
+      std::move(grid_builder), params);
+  grid_search.constructParameterSpace();
+  Valley grid_app;
+  grid_search.execute(grid_app);
+
+  std::vector<std::vector<TcoordType>> starts(
+      opt::LocalSearch<TcoordType, TresultType>::selectBest(
+        grid_search.getParameterSpace(), 2));
+
+  std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+    builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::LocalSearch<TcoordType, TresultType> search(
+      std::move(builder), params, opt::NelderMead, 1, 2);
+  search.constructParameterSpace();
+  search.setStartPoints(starts);
+  search.setMaxEvaluations(20);
+
+  Valley app;
+  search.execute(app);
+  std::cout << "seeded by grid search: " << starts.size()
+    << " starting points, " << app.getCount() << " nodes computed"
+    << std::endl;
+  for (size_t i = 0; i < search.getBestNodes().size(); ++i)
+  {
+    std::cout << "  optimum " << i << ": ";
+    print(search.getBestNodes()[i]);
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF localsearchtest.cc  ----- */
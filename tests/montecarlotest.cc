@@ -31,6 +31,9 @@
  * REVISIONS and CHANGES 
  * 19/03/2012   V0.1    Daniel Armbruster
  * 25/04/2012   V0.2    Make use of smart pointers and C++0x.
+ * 14/10/2026   V0.3    Reproducibility test with multiple threads.
+ * 14/10/2026   V0.4    Unique sampling test.
+ * 14/10/2026   V0.5    Samples drawn several times with multiple threads.
  * 
  * ============================================================================
  */
@@ -128,6 +131,92 @@ int main()
     }
   }
 
+  std::cout << "-------------------------------------------\n"
+    << "Same seed - single thread and multiple threads\n"
+    << "-------------------------------------------" << std::endl;
+
+  std::unique_ptr<opt::MonteCarlo<TcoordType, TresultType>> reference(
+    new opt::MonteCarlo<TcoordType, TresultType>(
+      std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>(
+        new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>),
+      params, opt::UniformInt, 50));
+  reference->setSeed(42);
+  reference->setUniqueSampling(true);
+  reference->constructParameterSpace();
+  reference->execute(app);
+
+  montecarlo.reset(new opt::MonteCarlo<TcoordType, TresultType>(
+      std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>(
+        new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>),
+      params, opt::UniformInt, 50, 4));
+  montecarlo->setSeed(42);
+  montecarlo->setUniqueSampling(true);
+  montecarlo->constructParameterSpace();
+  montecarlo->execute(app);
+
+  opt::Iterator<TcoordType, TresultType> it_ref(
+      reference->getParameterSpace().createIterator(opt::ForwardNodeIter));
+  it = montecarlo->getParameterSpace().createIterator(opt::ForwardNodeIter);
+  size_t num_computed = 0;
+  size_t num_mismatches = 0;
+  for (it_ref.first(), it.first(); !it_ref.isDone(); ++it_ref, ++it)
+  {
+    if ((*it)->isComputed()) { ++num_computed; }
+    if ((*it_ref)->isComputed() != (*it)->isComputed()) { ++num_mismatches; }
+  }
+  std::cout << "Computed nodes: " << num_computed << std::endl;
+  std::cout << "Mismatches: " << num_mismatches << std::endl;
+
+  std::cout << "------------------------------------\n"
+    << "Second run skips nodes computed yet\n"
+    << "------------------------------------" << std::endl;
+
+  montecarlo->execute(app);
+  num_computed = 0;
+  for (it.first(); !it.isDone(); ++it)
+  {
+    if ((*it)->isComputed()) { ++num_computed; }
+  }
+  std::cout << "Computed nodes: " << num_computed << std::endl;
+
+  std::cout << "------------------------------------\n"
+    << "Samples drawn several times - multiple threads\n"
+    << "------------------------------------" << std::endl;
+
+  reference.reset(new opt::MonteCarlo<TcoordType, TresultType>(
+      std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>(
+        new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>),
+      params, opt::UniformInt, 100));
+  reference->setSeed(42);
+  reference->constructParameterSpace();
+  reference->execute(app);
+
+  montecarlo.reset(new opt::MonteCarlo<TcoordType, TresultType>(
+      std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>(
+        new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>),
+      params, opt::UniformInt, 100, 4));
+  montecarlo->setSeed(42);
+  montecarlo->constructParameterSpace();
+  montecarlo->execute(app);
+
+  it_ref = reference->getParameterSpace().createIterator(opt::ForwardNodeIter);
+  it = montecarlo->getParameterSpace().createIterator(opt::ForwardNodeIter);
+  num_computed = 0;
+  num_mismatches = 0;
+  for (it_ref.first(), it.first(); !it_ref.isDone(); ++it_ref, ++it)
+  {
+    if ((*it)->isComputed()) { ++num_computed; }
+    if ((*it_ref)->isComputed() != (*it)->isComputed() ||
+        ((*it)->isComputed() &&
+         (*it_ref)->getResultData() != (*it)->getResultData()))
+    {
+      ++num_mismatches;
+    }
+  }
+  std::cout << "Computed nodes less than samples: " << (num_computed < 1025)
+    << std::endl;
+  std::cout << "Mismatches: " << num_mismatches << std::endl;
+
   return 0;
 } // function main
 
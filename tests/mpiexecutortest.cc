@@ -0,0 +1,185 @@
+/*! \file mpiexecutortest.cc
+ * \brief Test the distributed execution by means of MPI.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the distributed execution by means of MPI.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Use the fixture of testhelper.h.
+ * 14/10/2026  V0.3  Partitions of large parameter spaces.
+ * 
+ * ============================================================================
+ */
+
+#include <mpi.h>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/binaryio.h>
+#include <optimizexx/mpiexecutor.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+#include "testhelper.h"
+
+//! sum up the number of visited nodes of all ranks
+unsigned long getTotal(Sum const& app, int root)
+{
+  unsigned long count = app.getCount();
+  unsigned long total = 0;
+  MPI_Reduce(&count, &total, 1, MPI_UNSIGNED_LONG, MPI_SUM, root,
+      MPI_COMM_WORLD);
+  return total;
+}
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+  char const* filename = "mpiexecutortest.bin";
+
+  // create parameters
+  std::vector<Tparameter> params(createParameters());
+
+  opt::MPIExecutor<TcoordType, TresultType> executor;
+  bool const root = executor.getRoot() == executor.getRank();
+  if (root)
+  {
+    std::cout << "Ranks: " << executor.getSize() << std::endl;
+  }
+
+  // grid search gathered to the root rank
+  {
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params, 2);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    executor.execute(gridsearch, app);
+    unsigned long const total = getTotal(app, executor.getRoot());
+    executor.gather(gridsearch);
+    if (root)
+    {
+      std::cout << "------------------\n"
+        << "GridSearch (gathered)\n"
+        << "------------------\n"
+        << "Visited nodes: " << total << "\n"
+        << "Wrong results: "
+        << countWrong(gridsearch.getParameterSpace()) << std::endl;
+    }
+  }
+
+  // grid search written collectively
+  {
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    executor.execute(gridsearch, app);
+    executor.write(filename, gridsearch);
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (root)
+    {
+      std::ifstream is(filename, std::ios::binary);
+      std::unique_ptr<opt::ArrayGrid<TcoordType, TresultType>> space(
+          opt::BinaryFormat<TcoordType, TresultType>::read(is));
+      std::cout << "------------------\n"
+        << "GridSearch (written collectively)\n"
+        << "------------------\n"
+        << "Wrong results: " << countWrong(*space) << std::endl;
+      std::remove(filename);
+    }
+  }
+
+  // Monte Carlo search - all ranks draw the samples of the root rank
+  {
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::MonteCarlo<TcoordType, TresultType> montecarlo(std::move(builder),
+        params, opt::UniformInt, 50, 2);
+    montecarlo.constructParameterSpace();
+    Sum app;
+    executor.execute(montecarlo, app);
+    unsigned long const total = getTotal(app, executor.getRoot());
+    if (root)
+    {
+      std::cout << "------------------\n"
+        << "MonteCarlo\n"
+        << "------------------\n"
+        << "Visited nodes: " << total << std::endl;
+    }
+  }
+
+  // partitions of a parameter space whose products of indices overflow
+  if (root)
+  {
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params);
+    size_t const num_nodes = std::numeric_limits<size_t>::max()-2;
+    size_t const count = 1000;
+    bool contiguous = true;
+    size_t min_size = num_nodes;
+    size_t max_size = 0;
+    size_t end = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+      size_t first = 0;
+      size_t last = 0;
+      gridsearch.setPartition(i, count);
+      gridsearch.getPartitionRange(num_nodes, first, last);
+      contiguous = contiguous && first == end && first <= last;
+      min_size = std::min(min_size, last-first);
+      max_size = std::max(max_size, last-first);
+      end = last;
+    }
+    std::cout << "------------------\n"
+      << "Partitions of a large parameter space\n"
+      << "------------------\n"
+      << "Contiguous: " << contiguous << "\n"
+      << "Covering all nodes: " << (end == num_nodes) << "\n"
+      << "Sizes differing by at most one: " << (max_size-min_size <= 1)
+      << std::endl;
+  }
+
+  MPI_Finalize();
+  return 0;
+} // function main
+
+/* ----- END OF mpiexecutortest.cc  ----- */
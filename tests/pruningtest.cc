@@ -0,0 +1,241 @@
+/*! \file pruningtest.cc
+ * \brief Test early termination and pruning of a grid search.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test early termination and pruning of a grid search.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/implicitbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/traversal.h>
+#include <optimizexx/pruning.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+/*!
+ * Application calculating the sum of the parameters. The number of visited
+ * nodes is counted by clones of the application.
+ */
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    Sum() : Mcount(0) { }
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+      ++Mcount;
+    }
+    //! create a clone for a worker thread
+    virtual std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+      TresultType>> clone() const
+    {
+      return std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+             TresultType>>(new Sum);
+    }
+    //! merge the count of a clone
+    virtual void merge(
+        opt::ParameterSpaceVisitor<TcoordType, TresultType>& clone)
+    {
+      Mcount += static_cast<Sum&>(clone).Mcount;
+    }
+    //! query function for the number of visited nodes
+    size_t getCount() const { return Mcount; }
+
+  private:
+    //! number of visited nodes
+    size_t Mcount;
+
+}; // class Sum
+
+/*!
+ * Pruning policy terminating the run as soon as a result exceeds a
+ * threshold.
+ */
+class Threshold : public opt::Pruner<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    Threshold(TresultType threshold, bool prune_all=false) :
+      Mthreshold(threshold), MpruneAll(prune_all)
+    { }
+    //! terminate if the result is good enough
+    virtual bool terminate(opt::Node<TcoordType, TresultType> const* node)
+    {
+      return node->getResultData() >= Mthreshold;
+    }
+    //! bound function
+    virtual bool prune(opt::Grid<TcoordType, TresultType>* grid)
+    {
+      return MpruneAll;
+    }
+
+  private:
+    //! threshold
+    TresultType Mthreshold;
+    //! status variable if all grids are pruned
+    bool MpruneAll;
+
+}; // class Threshold
+
+//! run a grid search with a pruning policy
+void run(std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>>
+    builder,
+    std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> const&
+    params, std::shared_ptr<opt::Pruner<TcoordType, TresultType>> pruner,
+    size_t num_threads, bool print_count)
+{
+  opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+      params, num_threads);
+  gridsearch.setPruner(pruner);
+  gridsearch.constructParameterSpace();
+  Sum app;
+  gridsearch.execute(app);
+  if (print_count)
+  {
+    std::cout << "Visited nodes: " << app.getCount() << "\n";
+  } else
+  {
+    std::cout << "Visited less than all nodes: " << (app.getCount() < 1025)
+      << "\n";
+  }
+  std::cout << "Terminated: " << gridsearch.isTerminated() << std::endl;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  typedef opt::StandardParameterSpaceBuilder<TcoordType, TresultType>
+    Tstandard;
+  typedef opt::ImplicitParameterSpaceBuilder<TcoordType, TresultType>
+    Timplicit;
+
+  std::cout << "------------------\n"
+    << "Without pruning\n"
+    << "------------------" << std::endl;
+  run(std::unique_ptr<Tstandard>(new Tstandard), params,
+      std::shared_ptr<Threshold>(), 0, true);
+
+  std::cout << "------------------\n"
+    << "Termination (single threaded)\n"
+    << "------------------" << std::endl;
+  run(std::unique_ptr<Tstandard>(new Tstandard), params,
+      std::shared_ptr<Threshold>(new Threshold(2.5)), 0, true);
+
+  std::cout << "------------------\n"
+    << "Termination (thread pool)\n"
+    << "------------------" << std::endl;
+  run(std::unique_ptr<Tstandard>(new Tstandard), params,
+      std::shared_ptr<Threshold>(new Threshold(2.5)), 4, false);
+
+  std::cout << "------------------\n"
+    << "Termination (index addressed grid)\n"
+    << "------------------" << std::endl;
+  run(std::unique_ptr<Timplicit>(new Timplicit), params,
+      std::shared_ptr<Threshold>(new Threshold(2.5)), 4, false);
+
+  std::cout << "------------------\n"
+    << "Pruned parameter space\n"
+    << "------------------" << std::endl;
+  run(std::unique_ptr<Tstandard>(new Tstandard), params,
+      std::shared_ptr<Threshold>(new Threshold(10, true)), 4, true);
+
+  std::cout << "------------------\n"
+    << "Pruned subgrid\n"
+    << "------------------" << std::endl;
+  {
+    Tstandard builder;
+    builder.buildParameterSpace();
+    builder.buildGrid(params);
+    builder.buildSubGrid(params);
+    std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+        builder.getParameterSpace());
+    size_t count = 0;
+    auto visit = [&count](opt::Node<TcoordType, TresultType>* node)
+    {
+      ++count;
+    };
+    // skip all grids but the root
+    opt::GridComponent<TcoordType, TresultType>* root = space.get();
+    auto prune = [root](opt::Grid<TcoordType, TresultType>* grid)
+    {
+      std::vector<TcoordType> lower, upper;
+      if (grid != root && opt::getBounds(grid, lower, upper))
+      {
+        std::cout << "Pruned box:";
+        for (size_t i = 0; i < lower.size(); ++i)
+        {
+          std::cout << " [" << lower[i] << "," << upper[i] << "]";
+        }
+        std::cout << std::endl;
+        return true;
+      }
+      return false;
+    };
+    opt::forEachNode(*space, visit, prune);
+    std::cout << "Visited nodes: " << count << std::endl;
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF pruningtest.cc  ----- */
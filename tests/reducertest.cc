@@ -0,0 +1,141 @@
+/*! \file reducertest.cc
+ * \brief Test lock-free per thread reducers.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test lock-free per thread reducers.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/reducer.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+/*!
+ * Application calculating the sum of the parameters. The results are reduced
+ * without any locking.
+ */
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! constructor
+    Sum(size_t num_threads) : Mmin(num_threads), Mmax(num_threads),
+      Mtop(3, num_threads), Mmean(num_threads)
+    { }
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+
+      Mmin.update(result);
+      Mmax.update(result);
+      Mtop.update(result);
+      Mmean.update(result);
+    }
+    //! print the reduced results
+    void print() const
+    {
+      std::cout << "Minimum: " << Mmin.getResult() << std::endl;
+      std::cout << "Maximum: " << Mmax.getResult() << std::endl;
+      std::cout << "Three smallest: ";
+      std::vector<TresultType> const top = Mtop.getResult();
+      for (auto cit(top.cbegin()); cit != top.cend(); ++cit)
+      {
+        std::cout << *cit << " ";
+      }
+      std::cout << std::endl;
+      std::cout << "Mean: " << Mmean.getResult() << " of "
+        << Mmean.getCount() << " results" << std::endl;
+    }
+
+  private:
+    opt::thread::MinReducer<TresultType> Mmin;
+    opt::thread::MaxReducer<TresultType> Mmax;
+    opt::thread::TopKReducer<TresultType> Mtop;
+    opt::thread::MeanReducer<TresultType> Mmean;
+
+}; // class Sum
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  size_t const threads[] = { 0, 4 };
+  for (size_t i = 0; i < 2; ++i)
+  {
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params, threads[i]);
+    gridsearch.constructParameterSpace();
+
+    std::cout << "------------------\n"
+      << "Threads in use: " << threads[i] << "\n"
+      << "------------------" << std::endl;
+
+    Sum app(threads[i]);
+    gridsearch.execute(app);
+    app.print();
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF reducertest.cc  ----- */
@@ -0,0 +1,119 @@
+/*! \file resultcachetest.cc
+ * \brief Test the result cache shared between global algorithms.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the result cache shared between global algorithms.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Use the fixture of testhelper.h.
+ * 
+ * ============================================================================
+ */
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/resultcache.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+#include "testhelper.h"
+
+int main()
+{
+  // create parameters
+  std::vector<Tparameter> params(createParameters());
+
+  std::shared_ptr<opt::ResultCache<TcoordType, TresultType>> cache(
+      new opt::ResultCache<TcoordType, TresultType>(1e-6));
+
+  // the second run takes all results from the cache
+  for (size_t run = 1; run <= 2; ++run)
+  {
+    std::cout << "------------------\n"
+      << "Run " << run << " (GridSearch)\n"
+      << "------------------" << std::endl;
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params, 4);
+    gridsearch.setResultCache(cache);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    gridsearch.execute(app);
+    std::cout << "Visited nodes: " << app.getCount() << "\n"
+      << "Cached entries: " << cache->size() << "\n"
+      << "Cache hits: " << cache->getHits() << std::endl;
+    report(gridsearch.getParameterSpace());
+  }
+
+  std::cout << "------------------\n"
+    << "Shared cache (MonteCarlo)\n"
+    << "------------------" << std::endl;
+  {
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::MonteCarlo<TcoordType, TresultType> montecarlo(std::move(builder),
+        params, opt::UniformInt, 100);
+    montecarlo.setSeed(42);
+    montecarlo.setResultCache(cache);
+    montecarlo.constructParameterSpace();
+    Sum app;
+    montecarlo.execute(app);
+    std::cout << "Visited nodes: " << app.getCount() << std::endl;
+  }
+
+  std::cout << "------------------\n"
+    << "Memory budget exceeded\n"
+    << "------------------" << std::endl;
+  {
+    std::shared_ptr<opt::ResultCache<TcoordType, TresultType>> small_cache(
+        new opt::ResultCache<TcoordType, TresultType>(1e-6, 16<<10, 4));
+    std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+      builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+    opt::GridSearch<TcoordType, TresultType> gridsearch(std::move(builder),
+        params, 4);
+    gridsearch.setResultCache(small_cache);
+    gridsearch.constructParameterSpace();
+    Sum app;
+    gridsearch.execute(app);
+    size_t const num = small_cache->size();
+    std::cout << "Visited nodes: " << app.getCount() << "\n"
+      << "Entries bounded: " << (0 < num && num < app.getCount()) << "\n"
+      << "Entries evicted: "
+      << (num + small_cache->getEvictions() == app.getCount()) << std::endl;
+    report(gridsearch.getParameterSpace());
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF resultcachetest.cc  ----- */
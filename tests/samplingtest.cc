@@ -0,0 +1,233 @@
+/*! \file samplingtest.cc
+ * \brief Test the space-filling designs of the Monte Carlo algorithm.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the space-filling designs of the Monte Carlo algorithm.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Enable unique sampling.
+ * 
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/sampling.h>
+#include <optimizexx/globalalgorithms/montecarlo.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+typedef opt::StandardParameterSpaceBuilder<TcoordType, TresultType>
+  Tstandard;
+typedef std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>>
+  Tparameters;
+
+//! application marking the nodes computed
+class Mark : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      node->setResultData(1);
+      node->setComputed();
+    }
+}; // class Mark
+
+//! collect the coordinates of the computed nodes
+std::vector<std::vector<TcoordType>> getComputed(
+    opt::GlobalAlgorithm<TcoordType, TresultType>& algo)
+{
+  std::vector<std::vector<TcoordType>> computed;
+  opt::Iterator<TcoordType, TresultType> iter(
+      algo.getParameterSpace().createIterator(opt::ForwardNodeIter));
+  for (iter.first(); !iter.isDone(); ++iter)
+  {
+    if ((*iter)->isComputed())
+    {
+      computed.push_back(static_cast<opt::Node<TcoordType, TresultType>*>(
+            *iter)->getCoordinates());
+    }
+  }
+  return computed;
+}
+
+//! run the Monte Carlo algorithm
+std::vector<std::vector<TcoordType>> run(Tparameters const& params,
+    opt::Edistribution distr, float percent, size_t num_threads=0)
+{
+  opt::MonteCarlo<TcoordType, TresultType> montecarlo(
+      std::unique_ptr<Tstandard>(new Tstandard), params, distr, percent,
+      num_threads);
+  montecarlo.setSeed(42);
+  montecarlo.setUniqueSampling(true);
+  montecarlo.constructParameterSpace();
+  Mark app;
+  montecarlo.execute(app);
+  return getComputed(montecarlo);
+}
+
+//! report the coverage of a 2-D parameter space of 50x50 nodes
+void report(char const* name, Tparameters const& params,
+    opt::Edistribution distr)
+{
+  std::vector<std::vector<TcoordType>> const samples(
+      run(params, distr, 4));
+  // 10 strata per dimension and 10x10 cells
+  std::vector<size_t> strata_x(10, 0);
+  std::vector<size_t> strata_y(10, 0);
+  std::vector<bool> cells(100, false);
+  for (auto cit(samples.cbegin()); cit != samples.cend(); ++cit)
+  {
+    size_t const x = (*cit)[0]/5;
+    size_t const y = (*cit)[1]/5;
+    ++strata_x[x];
+    ++strata_y[y];
+    cells[x+10*y] = true;
+  }
+  std::cout << std::setw(16) << std::left << name
+    << " samples: " << samples.size()
+    << " empty strata: "
+    << std::count(strata_x.begin(), strata_x.end(), 0) << "/"
+    << std::count(strata_y.begin(), strata_y.end(), 0)
+    << " max per stratum: "
+    << *std::max_element(strata_x.begin(), strata_x.end()) << "/"
+    << *std::max_element(strata_y.begin(), strata_y.end())
+    << " covered cells: " << std::count(cells.begin(), cells.end(), true)
+    << std::endl;
+}
+
+int main()
+{
+  std::cout << "------------------\n"
+    << "Point sequences\n"
+    << "------------------" << std::endl;
+  {
+    std::vector<double> point;
+    opt::SobolSequence sobol(3);
+    std::cout << "Sobol:";
+    for (size_t i = 0; i < 4; ++i)
+    {
+      sobol.next(point);
+      std::cout << " (" << point[0] << "," << point[1] << "," << point[2]
+        << ")";
+    }
+    opt::HaltonSequence halton(2);
+    std::cout << "\nHalton:";
+    for (size_t i = 0; i < 4; ++i)
+    {
+      halton.next(point);
+      std::cout << " (" << point[0] << "," << point[1] << ")";
+    }
+    // each stratum of a Latin hypercube batch contains a single point
+    opt::LatinHypercubeSequence lhs(2, 8, 42);
+    std::vector<size_t> strata(8, 0);
+    for (size_t i = 0; i < 8; ++i)
+    {
+      lhs.next(point);
+      ++strata[point[1]*8];
+    }
+    std::cout << "\nLatin hypercube strata balanced: "
+      << (std::count(strata.begin(), strata.end(), 1) == 8) << std::endl;
+    // the first 2^m Sobol points stratify each dimension
+    opt::SobolSequence sobol16(16);
+    std::vector<std::vector<size_t>> bins(16, std::vector<size_t>(64, 0));
+    for (size_t i = 0; i < 63; ++i)
+    {
+      sobol16.next(point);
+      for (size_t d = 0; d < 16; ++d) { ++bins[d][point[d]*64]; }
+    }
+    size_t balanced = 0;
+    for (size_t d = 0; d < 16; ++d)
+    {
+      // the skipped point zero falls into the first bin
+      if (0 == bins[d][0] && std::count(bins[d].begin(), bins[d].end(), 1)
+          == 63) { ++balanced; }
+    }
+    std::cout << "Sobol dimensions stratified: " << balanced << "/16"
+      << std::endl;
+  }
+
+  Tparameters params;
+  params.push_back(std::shared_ptr<opt::Parameter<TcoordType> const>(
+        new opt::StandardParameter<TcoordType>("x",0,49,1)));
+  params.push_back(std::shared_ptr<opt::Parameter<TcoordType> const>(
+        new opt::StandardParameter<TcoordType>("y",0,49,1)));
+
+  std::cout << "------------------\n"
+    << "Coverage of the parameter space\n"
+    << "------------------" << std::endl;
+  report("Normal", params, opt::Normal);
+  report("UniformInt", params, opt::UniformInt);
+  report("LatinHypercube", params, opt::LatinHypercube);
+  report("Halton", params, opt::Halton);
+  report("Sobol", params, opt::Sobol);
+
+  std::cout << "------------------\n"
+    << "Reproducibility\n"
+    << "------------------" << std::endl;
+  opt::Edistribution const designs[] = { opt::LatinHypercube, opt::Halton,
+    opt::Sobol };
+  for (size_t i = 0; i < 3; ++i)
+  {
+    std::cout << "Single thread and multiple threads equal: "
+      << (run(params, designs[i], 10) == run(params, designs[i], 10, 4))
+      << std::endl;
+  }
+
+  std::cout << "------------------\n"
+    << "Second run skips nodes computed yet\n"
+    << "------------------" << std::endl;
+  {
+    opt::MonteCarlo<TcoordType, TresultType> montecarlo(
+        std::unique_ptr<Tstandard>(new Tstandard), params, opt::Sobol, 30);
+    montecarlo.setUniqueSampling(true);
+    montecarlo.constructParameterSpace();
+    Mark app;
+    montecarlo.execute(app);
+    std::cout << "Computed nodes: " << getComputed(montecarlo).size()
+      << std::endl;
+    montecarlo.execute(app);
+    std::cout << "Computed nodes: " << getComputed(montecarlo).size()
+      << std::endl;
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF samplingtest.cc  ----- */
@@ -0,0 +1,224 @@
+/*! \file streamingtest.cc
+ * \brief Test the streaming execution of the grid search.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the streaming execution of the grid search.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdio>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/implicitbuilder.h>
+#include <optimizexx/application.h>
+#include <optimizexx/batchapplication.h>
+#include <optimizexx/binaryio.h>
+#include <optimizexx/reducer.h>
+#include <optimizexx/streaming.h>
+#include <optimizexx/globalalgorithms/gridsearch.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! Application calculating the sum of the parameters.
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      std::vector<TcoordType> const& params = node->getCoordinates();
+      TresultType result = 0;
+      for (auto cit(params.cbegin()); cit != params.cend(); ++cit)
+      {
+        result += *cit;
+      }
+      node->setResultData(result);
+      node->setComputed();
+    }
+}; // class Sum
+
+//! Batch application calculating the sum of the parameters.
+class BatchSum : 
+  public opt::BatchParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    //! Visit function for a block of grid points.
+    virtual void operator()(
+        opt::CoordinateBlock<TcoordType, TresultType> const& block)
+    {
+      TresultType* results = block.getResults();
+      for (size_t i = 0; i < block.getSize(); ++i) { results[i] = 0; }
+      for (size_t d = 0; d < block.getDimensions(); ++d)
+      {
+        TcoordType const* column = block.getColumn(d);
+        for (size_t i = 0; i < block.getSize(); ++i)
+        {
+          results[i] += column[i];
+        }
+      }
+    }
+}; // class BatchSum
+
+//! read a file
+std::string readFile(char const* filename)
+{
+  std::ifstream ifs(filename, std::ios::binary);
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  return ss.str();
+}
+
+int main()
+{
+  char const* filename = "streamingtest.bin";
+
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25,"m"));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",-4,4.,0.125));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  typedef opt::BinaryFormat<TcoordType, TresultType> Tformat;
+
+  // reference - a parameter space kept in memory
+  std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+    builder(new opt::StandardParameterSpaceBuilder<TcoordType, TresultType>);
+  opt::GridSearch<TcoordType, TresultType> reference(std::move(builder),
+      params);
+  reference.constructParameterSpace();
+  Sum ref_app;
+  reference.execute(ref_app);
+  std::stringstream ss;
+  Tformat::write(ss, reference.getParameterSpace(), params);
+
+  for (size_t threads = 0; threads <= 4; threads += 4)
+  {
+    for (size_t batch = 0; batch < 2; ++batch)
+    {
+      Sum app;
+      BatchSum batch_app;
+      opt::ParameterSpaceVisitor<TcoordType, TresultType>& v =
+        batch ? static_cast<opt::ParameterSpaceVisitor<TcoordType,
+              TresultType>&>(batch_app) : app;
+      std::cout << threads << " threads, "
+        << (batch ? "batch application" : "application") << std::endl;
+
+      // minimum by means of a reducer - no parameter space is constructed
+      {
+        std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+          builder(new opt::ImplicitParameterSpaceBuilder<TcoordType,
+              TresultType>);
+        opt::GridSearch<TcoordType, TresultType> gridsearch(
+            std::move(builder), params, threads);
+        opt::thread::MinReducer<TresultType> min_reducer(threads);
+        opt::thread::MaxReducer<TresultType> max_reducer(threads);
+        gridsearch.setSink(std::make_shared<opt::ReducerSink<TcoordType,
+            TresultType, opt::thread::MinReducer<TresultType>>>(
+              min_reducer), 100);
+        gridsearch.execute(v);
+        gridsearch.setSink(std::make_shared<opt::ReducerSink<TcoordType,
+            TresultType, opt::thread::MaxReducer<TresultType>>>(
+              max_reducer), 100);
+        gridsearch.execute(v);
+        std::cout << "  minimum: " << min_reducer.getResult()
+          << " maximum: " << max_reducer.getResult() << std::endl;
+      }
+
+      // tiles passed to a callback
+      {
+        std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+          builder(new opt::ImplicitParameterSpaceBuilder<TcoordType,
+              TresultType>);
+        opt::GridSearch<TcoordType, TresultType> gridsearch(
+            std::move(builder), params, threads);
+        std::atomic<size_t> num_tiles(0);
+        std::atomic<size_t> num_points(0);
+        std::atomic<size_t> max_tile(0);
+        gridsearch.setSink(std::make_shared<opt::CallbackSink<TcoordType,
+            TresultType>>([&](size_t first,
+                opt::CoordinateBlock<TcoordType, TresultType> const& tile)
+              {
+                ++num_tiles;
+                num_points += tile.getSize();
+                size_t m = max_tile;
+                while (m < tile.getSize() &&
+                    ! max_tile.compare_exchange_weak(m, tile.getSize()))
+                { }
+              }), 64);
+        gridsearch.execute(v);
+        std::cout << "  tiles: " << num_tiles << " grid points: "
+          << num_points << " largest tile: " << max_tile << " progress: "
+          << gridsearch.getProgress()->getCompleted() << std::endl;
+      }
+
+      // binary file
+      {
+        std::unique_ptr<opt::ParameterSpaceBuilder<TcoordType, TresultType>> 
+          builder(new opt::ImplicitParameterSpaceBuilder<TcoordType,
+              TresultType>);
+        opt::GridSearch<TcoordType, TresultType> gridsearch(
+            std::move(builder), params, threads);
+        {
+          std::ofstream ofs(filename, std::ios::binary);
+          gridsearch.setSink(std::make_shared<opt::BinarySink<TcoordType,
+              TresultType>>(ofs), 100);
+          gridsearch.execute(v);
+        }
+        std::cout << "  identical to the export of the parameter space: "
+          << (readFile(filename) == ss.str() ? "yes" : "no") << std::endl;
+        std::remove(filename);
+      }
+    }
+  }
+
+  return 0;
+} // function main
+
+/* ----- END OF streamingtest.cc  ----- */
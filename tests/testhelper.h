@@ -0,0 +1,189 @@
+/*! \file testhelper.h
+ * \brief Fixture shared by test programs of the global algorithms.
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ *
+ * Purpose: Fixture shared by test programs of the global algorithms.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ *
+ * Copyright (c) 2026 by Daniel Armbruster
+ *
+ * REVISIONS and CHANGES
+ * 14/10/2026  V0.1  Daniel Armbruster
+ *
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <optimizexx/parameter.h>
+#include <optimizexx/application.h>
+#include <optimizexx/iterator.h>
+#include <optimizexx/node.h>
+#include <optimizexx/gridcomponent.h>
+
+#ifndef _OPTIMIZEXX_TESTHELPER_H_
+#define _OPTIMIZEXX_TESTHELPER_H_
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+typedef std::shared_ptr<opt::Parameter<TcoordType> const> Tparameter;
+
+/*!
+ * Application calculating the sum of the parameters. The number of visited
+ * nodes is counted by clones of the application.
+ */
+class Sum : public opt::ParameterSpaceVisitor<TcoordType, TresultType>
+{
+  public:
+    /*!
+     * constructor
+     *
+     * \param mark_computed flag if visited nodes are marked as computed
+     */
+    Sum(bool const mark_computed=false) :
+      Mcount(0), MmarkComputed(mark_computed)
+    { }
+    //! Visit function for a grid.
+    virtual void operator()(opt::Grid<TcoordType, TresultType>* grid) { }
+    //! Visit function / application for a node.
+    virtual void operator()(opt::Node<TcoordType, TresultType>* node)
+    {
+      node->setResultData(sum(*node));
+      if (MmarkComputed) { node->setComputed(); }
+      ++Mcount;
+    }
+    //! create a clone for a worker thread
+    virtual std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+      TresultType>> clone() const
+    {
+      return std::unique_ptr<opt::ParameterSpaceVisitor<TcoordType,
+             TresultType>>(new Sum(MmarkComputed));
+    }
+    //! merge the count of a clone
+    virtual void merge(
+        opt::ParameterSpaceVisitor<TcoordType, TresultType>& clone)
+    {
+      Mcount += static_cast<Sum&>(clone).Mcount;
+    }
+    //! query function for the number of visited nodes
+    size_t getCount() const { return Mcount; }
+    //! the sum of the coordinates of a node
+    static TresultType sum(opt::Node<TcoordType, TresultType> const& node)
+    {
+      TcoordType const* const coordinates = node.getCoordinateData();
+      TresultType result = 0;
+      for (size_t i = 0; i < node.getDimensions(); ++i)
+      {
+        result += coordinates[i];
+      }
+      return result;
+    }
+
+  private:
+    //! number of visited nodes
+    size_t Mcount;
+    //! flag if visited nodes are marked as computed
+    bool const MmarkComputed;
+
+}; // class Sum
+
+/*!
+ * parameters of the parameter space most tests are run on (1025 nodes)
+ */
+inline std::vector<Tparameter> createParameters()
+{
+  std::vector<Tparameter> params;
+  params.push_back(Tparameter(
+        new opt::StandardParameter<TcoordType>("param1",0,1.,0.25)));
+  params.push_back(Tparameter(
+        new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5)));
+  params.push_back(Tparameter(
+        new opt::StandardParameter<TcoordType>("param3",-1,1.,0.05)));
+  return params;
+}
+
+/*!
+ * number of nodes of a parameter space
+ *
+ * \param space parameter space
+ * \param computed_only flag if only computed nodes are counted
+ */
+inline size_t countNodes(
+    opt::GridComponent<TcoordType, TresultType> const& space,
+    bool const computed_only=false)
+{
+  size_t num = 0;
+  opt::Iterator<TcoordType, TresultType> it(
+      space.createIterator(opt::ForwardNodeIter));
+  for (it.first(); !it.isDone(); ++it)
+  {
+    if (! computed_only || (*it)->isComputed()) { ++num; }
+  }
+  return num;
+}
+
+/*!
+ * number of nodes whose result is not the sum of the coordinates
+ *
+ * \param space parameter space
+ * \param computed_only flag if only computed nodes are checked
+ */
+inline size_t countWrong(
+    opt::GridComponent<TcoordType, TresultType> const& space,
+    bool const computed_only=false)
+{
+  size_t num = 0;
+  opt::Iterator<TcoordType, TresultType> it(
+      space.createIterator(opt::ForwardNodeIter));
+  for (it.first(); !it.isDone(); ++it)
+  {
+    if (computed_only && ! (*it)->isComputed()) { continue; }
+    opt::Node<TcoordType, TresultType> const& node =
+      static_cast<opt::Node<TcoordType, TresultType> const&>(**it);
+    if (std::fabs(Sum::sum(node) - node.getResultData()) > 1e-12) { ++num; }
+  }
+  return num;
+}
+
+/*!
+ * print the number of (computed) nodes and the number of wrong results
+ *
+ * \param space parameter space
+ * \param computed_only flag if only computed nodes are reported
+ */
+inline void report(opt::GridComponent<TcoordType, TresultType> const& space,
+    bool const computed_only=false)
+{
+  std::cout << (computed_only ? "Computed nodes: " : "Nodes: ")
+    << countNodes(space, computed_only) << "\n"
+    << "Wrong results: " << countWrong(space, computed_only) << std::endl;
+}
+
+#endif // include guard
+
+/* ----- END OF testhelper.h  ----- */
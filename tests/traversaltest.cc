@@ -0,0 +1,129 @@
+/*! \file traversaltest.cc
+ * \brief Test the non-virtual traversal of a parameter space.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Test the non-virtual traversal of a parameter space.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <optimizexx/parameter.h>
+#include <optimizexx/standardbuilder.h>
+#include <optimizexx/implicitbuilder.h>
+#include <optimizexx/traversal.h>
+
+namespace opt = optimize;
+
+typedef double TcoordType;
+typedef double TresultType;
+
+//! Function object counting the nodes and summing up their coordinates.
+struct Sum
+{
+  //! constructor
+  Sum() : Mcount(0), Mtotal(0) { }
+  //! apply the function to a node
+  void operator()(opt::Node<TcoordType, TresultType>* node)
+  {
+    std::vector<TcoordType> const& c = node->getCoordinates();
+    for (auto cit(c.cbegin()); cit != c.cend(); ++cit) { Mtotal += *cit; }
+    ++Mcount;
+  }
+  //! number of visited nodes
+  size_t Mcount;
+  //! total of all coordinates
+  TcoordType Mtotal;
+}; // struct Sum
+
+//! count the nodes of a parameter space and its subgrids
+size_t countNodes(opt::GridComponent<TcoordType, TresultType>& space)
+{
+  size_t num = 0;
+  for (auto it(space.begin()); it != space.end(); ++it)
+  {
+    if (opt::GridComponent<TcoordType, TresultType>::Leaf ==
+        (*it)->getComponentType())
+    {
+      ++num;
+    } else
+    {
+      num += countNodes(**it);
+    }
+  }
+  return num;
+}
+
+int main()
+{
+  // create parameters
+  std::shared_ptr<opt::Parameter<TcoordType> const> param1( 
+    new opt::StandardParameter<TcoordType>("param1",0,1.,0.25));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param2( 
+    new opt::StandardParameter<TcoordType>("param2",-1,1.,0.5));
+  std::shared_ptr<opt::Parameter<TcoordType> const> param3( 
+    new opt::StandardParameter<TcoordType>("param3",0,1.,0.05));
+  
+  std::vector<std::shared_ptr<opt::Parameter<TcoordType> const>> params;
+  params.push_back(param1);
+  params.push_back(param2);
+  params.push_back(param3);
+
+  // parameter space with a subgrid
+  opt::StandardParameterSpaceBuilder<TcoordType, TresultType> builder;
+  builder.buildParameterSpace();
+  builder.buildGrid(params);
+  builder.buildSubGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>> space(
+      builder.getParameterSpace());
+  Sum sum;
+  opt::forEachNode(*space, sum);
+  std::cout << "Nodes: " << countNodes(*space) << "\n"
+    << "Nodes traversed: " << sum.Mcount << "\n"
+    << "Total of coordinates: " << sum.Mtotal << std::endl;
+
+  // index addressed parameter space
+  opt::ImplicitParameterSpaceBuilder<TcoordType, TresultType>
+    implicit_builder;
+  implicit_builder.buildParameterSpace();
+  implicit_builder.buildGrid(params);
+  std::unique_ptr<opt::GridComponent<TcoordType, TresultType>>
+    implicit_space(implicit_builder.getParameterSpace());
+  Sum implicit_sum;
+  opt::forEachNode(*implicit_space, implicit_sum);
+  std::cout << "Grid points traversed: " << implicit_sum.Mcount << "\n"
+    << "Total of coordinates: " << implicit_sum.Mtotal << std::endl;
+
+  return 0;
+} // function main
+
+/* ----- END OF traversaltest.cc  ----- */
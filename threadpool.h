@@ -32,14 +32,40 @@
  * 
  * REVISIONS and CHANGES 
  * 07/04/2012  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Replaced the spinning Fifo by a work-stealing scheduler
+ *                   with per-worker queues, parking workers and a completion
+ *                   latch.
+ * 14/10/2026  V0.3  Tasks are commands now, providing batches of nodes.
+ * 14/10/2026  V0.4  Task for ranges of index addressed grid points.
+ * 14/10/2026  V0.5  Workers publish their index thread locally.
+ * 14/10/2026  V0.6  Workers make use of clones of the application.
+ * 14/10/2026  V0.7  Cancellation draining the queued tasks.
+ * 14/10/2026  V0.8  Jobs sharing a thread pool and progress reporting.
+ * 14/10/2026  V0.9  Pinning workers to CPUs.
+ * 14/10/2026  V0.10 Optional instrumentation of jobs.
+ * 14/10/2026  V0.11 Index ranges visited by batch applications.
+ * 14/10/2026  V0.12 Cancellation is scoped to the tasks submitted before.
+ * 14/10/2026  V0.13 Completion is signalled by a counter of pending tasks.
+ * 14/10/2026  V0.14 Cancellation is scoped to a job.
  * 
  * ============================================================================
  */
  
-#include <queue>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <atomic>
 #include <boost/thread.hpp>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 #include <optimizexx/application.h>
 #include <optimizexx/gridcomponent.h>
+#include <optimizexx/indexedgrid.h>
+#include <optimizexx/progress.h>
+#include <optimizexx/instrumentation.h>
+#include <optimizexx/error.h>
 
 #ifndef _OPTIMIZEXX_THREADPOOL_H_
 #define _OPTIMIZEXX_THREADPOOL_H_
@@ -67,57 +93,377 @@ namespace optimize
   namespace thread
   {
 
+    /* ===================================================================== */
+    //! cleanup function of the worker index - the index is owned by a worker
+    inline void releaseWorkerIndex(size_t* index) { }
+
+    /* --------------------------------------------------------------------- */
+    //! thread local pointer to the index of the worker thread
+    inline boost::thread_specific_ptr<size_t>& getWorkerIndexPtr()
+    {
+      static boost::thread_specific_ptr<size_t> index(
+          &releaseWorkerIndex);
+      return index;
+    }
+
+    /* --------------------------------------------------------------------- */
+    /*!
+     * query function for the index of the calling thread within its thread
+     * pool\n
+     * Applications and reducers (e.g. optimize::thread::MinReducer) might use
+     * the index to access per thread data without locking.
+     *
+     * \return index of the worker - 0 if not called by a worker of a thread
+     * pool
+     *
+     * \ingroup group_thread
+     */
+    inline size_t getWorkerIndex()
+    {
+      size_t const* index = getWorkerIndexPtr().get();
+      return index ? *index : 0;
+    }
+
+    /* ===================================================================== */
+    /*!
+     * Abstract base class of a thread pool task. Note that here the command
+     * design pattern is in use (GoF p.233). A task encapsulates the part of a
+     * parameter space an application has to be applied to.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData>
+    class Task
+    {
+      public:
+        //! destructor
+        virtual ~Task() { }
+        /*!
+         * apply an application to the task's part of the parameter space
+         *
+         * \param app application to be applied
+         */
+        virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app)
+          = 0;
+        //! query function for the number of nodes of the task
+        virtual size_t getSize() const { return 1; }
+        //! submission number of the task within its job (set by the pool)
+        size_t Mticket;
+#ifdef OPTIMIZE_INSTRUMENTATION
+        //! point in time the task had been queued
+        Instrumentation::Ttime MqueuedAt;
+#endif
+
+      protected:
+        //! constructor
+        Task() : Mticket(0) { }
+
+    }; // class template Task
+
+    /* ===================================================================== */
+    /*!
+     * Task applying an application to a single grid component.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData>
+    class ComponentTask : public Task<Ctype, CresultData>
+    {
+      public:
+        //! constructor
+        ComponentTask(GridComponent<Ctype, CresultData>* comp_ptr) :
+          Mcomponent(comp_ptr)
+        { }
+        //! destructor
+        virtual ~ComponentTask() { }
+        //! apply an application to the grid component
+        virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app);
+
+      private:
+        //! grid component to be visited
+        GridComponent<Ctype, CresultData>* Mcomponent;
+
+    }; // class template ComponentTask
+
+    /* ===================================================================== */
+    /*!
+     * Task applying an application to a contiguous range of nodes.\n
+     * The nodes are passed to the batch visit function of
+     * optimize::ParameterSpaceVisitor. Notice that the task does not own the
+     * range. The storage the range refers to must be valid until the task had
+     * been completed.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData>
+    class NodeRangeTask : public Task<Ctype, CresultData>
+    {
+      public:
+        //! constructor
+        NodeRangeTask(Node<Ctype, CresultData>** begin,
+            Node<Ctype, CresultData>** end) : Mbegin(begin), Mend(end)
+        { }
+        //! destructor
+        virtual ~NodeRangeTask() { }
+        //! apply an application to the range of nodes
+        virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app)
+        {
+          app(Mbegin, Mend);
+        }
+        //! query function for the number of nodes of the task
+        virtual size_t getSize() const { return Mend-Mbegin; }
+
+      private:
+        //! first node of the range
+        Node<Ctype, CresultData>** Mbegin;
+        //! end of the range
+        Node<Ctype, CresultData>** Mend;
+
+    }; // class template NodeRangeTask
+
     /* ===================================================================== */
     /*!
-     * Declaration of a thread safe task queue. Notice that here the Thread pool
-     * design pattern is in use (<a
-     * href="http://en.wikipedia.org/wiki/Thread_pool_pattern">Wikipedia</a>).
+     * Task applying an application to a range of grid points of an
+     * optimize::IndexedGrid. The task visits the grid points by means of its
+     * own flyweight node. Batch applications are passed blocks of the range
+     * instead (see IndexedGrid::visitRange).
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData>
+    class IndexRangeTask : public Task<Ctype, CresultData>
+    {
+      public:
+        /*!
+         * constructor
+         *
+         * \param grid index addressed grid
+         * \param first linear index of the first grid point
+         * \param last linear index past the last grid point
+         */
+        IndexRangeTask(IndexedGrid<Ctype, CresultData> const* grid,
+            size_t first, size_t last) : Mgrid(grid), Mfirst(first),
+            Mlast(last)
+        { }
+        //! destructor
+        virtual ~IndexRangeTask() { }
+        //! apply an application to the range of grid points
+        virtual void execute(ParameterSpaceVisitor<Ctype, CresultData>& app)
+        {
+          BatchParameterSpaceVisitor<Ctype, CresultData>* batch =
+            dynamic_cast<BatchParameterSpaceVisitor<Ctype, CresultData>*>(
+                &app);
+          if (batch)
+          {
+            // result data is passed to the grid as by the flyweight node
+            const_cast<IndexedGrid<Ctype, CresultData>*>(Mgrid)->visitRange(
+                *batch, Mfirst, Mlast);
+            return;
+          }
+          IndexedNode<Ctype, CresultData> node(Mgrid);
+          for (size_t i = Mfirst; i < Mlast; ++i)
+          {
+            node.setIndex(i);
+            app(&node);
+          }
+        }
+        //! query function for the number of nodes of the task
+        virtual size_t getSize() const { return Mlast-Mfirst; }
+
+      private:
+        //! grid the grid points belong to
+        IndexedGrid<Ctype, CresultData> const* Mgrid;
+        //! first grid point
+        size_t Mfirst;
+        //! end of the range
+        size_t Mlast;
+
+    }; // class template IndexRangeTask
+
+    /* ===================================================================== */
+    /*!
+     * Declaration of a thread safe double ended task queue. Every worker of a
+     * optimize::thread::ThreadPool owns one of these queues (<a
+     * href="http://en.wikipedia.org/wiki/Work_stealing">Work stealing</a>).
      * \n
      *
-     * Thread safety for the task queue is guaranteed to prevent from deadlocks
-     * are other unpleasant side effects. 
+     * The owner takes its tasks from the front so that tasks are worked off in
+     * the order they had been submitted. Idle workers steal from the back of
+     * a foreign queue which keeps the owner and the thieves apart from each
+     * other. Each queue is guarded by its own mutex so that workers do not
+     * compete for a single global lock.
      *
      * \ingroup group_thread
      */
     template <typename Ctask>
-    class Fifo
+    class WorkStealingQueue
     {
       public:
         //! constructor
-        Fifo() : MnumPopped(0)
-        { }
-        //! add a new task to the task queue
-        void addTask(Ctask& task);
-        //! query function for the next task in the task queue
-        Ctask& waitAndPopTask();
+        WorkStealingQueue() { }
+        //! add a new task to the back of the queue
+        void push(Ctask task);
         /*!
-         * query function for the next task in the task queue\n
-         * In contrast to optimize::thread::Fifo::waitAndPopTask this function
-         * does not keep the the thread waiting until the task queue does
-         * contain a task to pop.
+         * take the next task from the front of the queue (owner side)
          *
-         * \param reference to the task which is set if pop had been successful
+         * \param task reference to the task which is set if pop had been
+         * successful
          * \return if pop was successful
          */
-        bool tryAndPopTask(Ctask& popped_task);
+        bool tryPop(Ctask& task);
+        /*!
+         * take a task from the back of the queue (thief side)
+         *
+         * \param task reference to the task which is set if the steal had been
+         * successful
+         * \return if steal was successful
+         */
+        bool trySteal(Ctask& task);
         //! query function if task queue is empty
         bool empty() const;
-        //! query function for number of popped tasks
-        size_t const& getNumPoppedTasks();
 
       private:
-        //! fifo buffer
-        std::queue<Ctask> Mqueue;
-        //! status variable to save number of popped tasks
-        size_t MnumPopped;
+        //! task buffer
+        std::deque<Ctask> Mdeque;
+        //! mutual exclusion variable to guarantee thread safety
+        mutable boost::mutex Mmutex; 
+
+    }; // class template WorkStealingQueue
+
+    // forward declaration
+    template <typename Ctype, typename CresultData> class ThreadPool;
+
+    /* ===================================================================== */
+    /*!
+     * Pin the calling thread to a CPU.
+     *
+     * \param cpu index of the CPU
+     * \return if the thread had been pinned - pinning is supported on Linux
+     * only
+     */
+    inline bool pinThread(size_t const cpu)
+    {
+#ifdef __linux__
+      if (CPU_SETSIZE <= cpu) { return false; }
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(cpu, &set);
+      return 0 == pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+      return false;
+#endif
+    }
+
+    /* ===================================================================== */
+    /*!
+     * Job of a thread pool. A job binds the tasks of a single execution to
+     * an application so that several executions (e.g. of different global
+     * algorithms) are able to share a single thread pool.\n
+     *
+     * If the application provides clones (see
+     * optimize::ParameterSpaceVisitor::clone) the job creates a clone for
+     * each worker of the pool. The nodes of the tasks are counted by a
+     * optimize::Progress. If the cancellation of the progress had been
+     * requested or the job had been cancelled (see cancel()) the tasks of
+     * the job still queued are discarded. Cancelling a job does not affect
+     * the other jobs of the pool. If an
+     * optimize::Instrumentation is passed (and compiled in) the tasks are
+     * recorded per worker including the time they waited within the queues.
+     *
+     * \note The thread pool must have been initialized and must outlive the
+     * job. A job must not be destroyed before wait() had returned.
+     *
+     * \ingroup group_thread
+     */
+    template <typename Ctype, typename CresultData>
+    class Job
+    {
+      public:
+        //! task type of the job
+        typedef typename std::unique_ptr<Task<Ctype, CresultData>> Ttask;
+
+      public:
         /*!
-         * condition variable to guarantee thread safety of class
+         * constructor
+         *
+         * \param pool initialized thread pool the tasks are executed by
+         * \param app application applied by the tasks
+         * \param progress progress counting the nodes of the tasks
+         * \param instrumentation instrumentation recording the tasks
+         * (optional)
          */
-        boost::condition_variable Mcondition;
-        //! mutual exclusion variable to guarantee thread safety
-        boost::mutex Mmutex; 
+        Job(ThreadPool<Ctype, CresultData>& pool,
+            ParameterSpaceVisitor<Ctype, CresultData>& app,
+            Progress& progress, Instrumentation* instrumentation = 0);
+        //! add a new task to the thread pool
+        void addTask(Ttask task);
+        /*!
+         * Block the calling thread until all tasks of the job submitted so
+         * far have been completed or the pool had been stopped.
+         */
+        void wait();
+        /*!
+         * Cancel the tasks of the job submitted so far. Tasks still queued
+         * are discarded but counted as completed. Tasks submitted
+         * afterwards are executed again. Tasks of other jobs sharing the
+         * pool are not affected.
+         */
+        void cancel() { McancelledTickets = Msubmitted.load(); }
+        /*!
+         * query function if the job had been cancelled, i.e. tasks cancelled
+         * might still be pending
+         */
+        bool isCancelled() const { return Mcompleted < McancelledTickets; }
+        /*!
+         * Merge the clones of the application into the application. Call
+         * this function once after wait().
+         */
+        void merge();
+        //! query function for the progress of the job
+        Progress& getProgress() { return Mprogress; }
+        //! query function for the thread pool of the job
+        ThreadPool<Ctype, CresultData>& getThreadPool() { return Mpool; }
 
-    }; // class template Fifo
+      private:
+        //! not copyable
+        Job(Job const&);
+        //! not assignable
+        Job& operator=(Job const&);
+        /*!
+         * Execute a task of the job (called by the workers of the pool).
+         *
+         * \param task task to be executed
+         * \param worker index of the calling worker
+         */
+        void execute(Ttask task, size_t const worker);
+
+        friend class ThreadPool<Ctype, CresultData>;
+
+      private:
+        //! thread pool
+        ThreadPool<Ctype, CresultData>& Mpool;
+        //! application
+        ParameterSpaceVisitor<Ctype, CresultData>* Mapplication;
+        //! clones of the application - one for each worker if available
+        std::vector<std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>>>
+          Mclones;
+        //! progress
+        Progress& Mprogress;
+        //! instrumentation (optional)
+        Instrumentation* Minstrumentation;
+        //! number of submitted tasks
+        std::atomic<size_t> Msubmitted;
+        //! number of completed tasks
+        std::atomic<size_t> Mcompleted;
+        //! number of tasks submitted but not completed yet
+        std::atomic<size_t> Mpending;
+        /*!
+         * tasks whose submission number is less than this value had been
+         * cancelled
+         */
+        std::atomic<size_t> McancelledTickets;
+
+    }; // class template Job
 
     /* ===================================================================== */
     /*!
@@ -129,7 +475,19 @@ namespace optimize
      * creating instances of new threads. In contrast to generating new
      * instances of threads a thread pool keeps a defined number of threads
      * which acctually act as \a workers always alive. These workes wake up as
-     * soon as the task queue contains tasks that have to be worked off.
+     * soon as the task queue contains tasks that have to be worked off.\n
+     *
+     * Submitted tasks are distributed round robin to the workers' queues. A
+     * worker whose queue ran empty steals from the other workers and parks on
+     * a condition variable if there is no work at all, so idle workers do not
+     * consume any CPU time. optimize::thread::ThreadPool::wait blocks the
+     * caller until all submitted tasks have been \em completed.\n
+     *
+     * Tasks belong to jobs (see optimize::thread::Job) which provide the
+     * application the tasks are executed with. A thread pool constructed
+     * without an application is shared by the jobs of several executions.
+     * Otherwise the pool creates a job of its own for the tasks added by
+     * addTask(Ttask).
      *
      * \ingroup group_thread
      */
@@ -137,6 +495,9 @@ namespace optimize
     class ThreadPool
     {
       public:
+        //! task type of the thread pool
+        typedef typename std::unique_ptr<Task<Ctype, CresultData>> Ttask;
+
         /* ----------------------------------------------------------------- */
         /*!
          * Member class for a thread pool thread to make handling easier.
@@ -147,142 +508,375 @@ namespace optimize
         {
           public:
             //! constructor
-            ThreadHandle(bool& active,
-                Fifo<GridComponent<Ctype, CresultData>*>& tasks,
-                ParameterSpaceVisitor<Ctype, CresultData>& app) :
-              Mactive(active), Mtasks(tasks), Mapp(&app)
+            ThreadHandle(ThreadPool<Ctype, CresultData>& pool, size_t index) :
+              Mpool(&pool), Mindex(index)
             { }
             
             //! thread function to be executed
-            void operator()()
-            {
-              while (Mactive) 
-              { 
-                GridComponent<Ctype, CresultData>* comp_ptr = 0;
-                if(Mtasks.tryAndPopTask(comp_ptr))
-                {
-                  if (GridComponent<Ctype, CresultData>::Leaf ==
-                      comp_ptr->getComponentType())
-                  {
-                    Mapp->operator()(dynamic_cast<Node<Ctype, CresultData>*>(
-                          comp_ptr));
-                  } else
-                  {
-                    Mapp->operator()(dynamic_cast<Grid<Ctype, CresultData>*>(
-                          comp_ptr));
-                  }
-                }
-              }
-            }
+            void operator()();
 
           private:
-            //! status if active
-            bool& Mactive;
-            //! task queue
-            Fifo<GridComponent<Ctype, CresultData>*>& Mtasks;
-            //! application to execute on tasks
-            ParameterSpaceVisitor<Ctype, CresultData>* Mapp;
+            //! thread pool the worker belongs to
+            ThreadPool<Ctype, CresultData>* Mpool;
+            //! index of the worker's task queue
+            size_t Mindex;
 
         }; // class ThreadHandle
 
       public:
-        //! constructor
+        /*!
+         * constructor
+         *
+         * \param app application the tasks added by addTask(Ttask) are
+         * executed with
+         * \param numThreads number of worker threads - zero for the number
+         * of hardware threads
+         */
         ThreadPool(ParameterSpaceVisitor<Ctype, CresultData>& app,
             size_t numThreads = 0) : Mapplication(&app),
-          MnumThreads(numThreads), Mactive(false)
+          MnumThreads(numThreads), Mactive(false),
+          MnextQueue(0), Mqueued(0), Msubmitted(0), Mcompleted(0),
+          Mpending(0), MnumParked(0)
+        { }
+        /*!
+         * constructor of a thread pool shared by jobs
+         *
+         * \param numThreads number of worker threads - zero for the number
+         * of hardware threads
+         */
+        explicit ThreadPool(size_t numThreads = 0) : Mapplication(0),
+          MnumThreads(numThreads), Mactive(false),
+          MnextQueue(0), Mqueued(0), Msubmitted(0), Mcompleted(0),
+          Mpending(0), MnumParked(0)
         { }
 
         //! destructor
         ~ThreadPool();
         //! initialize the thread pool
         void initialize();
-        //! add a new task
+        //! add a new task visiting a single grid component
         void addTask(GridComponent<Ctype, CresultData>* task);
-        //! stop work of threads in threadpool
-        void stop() { Mactive = false; }
+        //! add a new task to the job of the pool
+        void addTask(Ttask task);
+        //! add a new task of a job
+        void addTask(Job<Ctype, CresultData>& job, Ttask task);
+        //! query function if the thread pool had been initialized
+        bool isInitialized() const { return Mactive; }
+        /*!
+         * stop work of threads in threadpool\n
+         * Workers finish the task they are currently working on. Tasks still
+         * remaining in the queues are discarded.
+         */
+        void stop();
+        /*!
+         * Cancel the computation of the job of the pool (see
+         * optimize::thread::Job::cancel)\n
+         * In contrast to stop() the workers stay alive. Tasks added by
+         * addTask(Ttask) before and still remaining in the queues are
+         * discarded but counted as completed so that wait() returns as soon
+         * as the tasks currently worked on had been completed. Tasks added
+         * afterwards are executed again. The jobs of a pool shared by
+         * several executions are cancelled individually (see
+         * optimize::Execution::cancel), so does nothing for a pool
+         * constructed without an application.
+         */
+        void cancel() { if (Mjob) { Mjob->cancel(); } }
+        /*!
+         * query function if the computation of the job of the pool had been
+         * cancelled, i.e. tasks cancelled might still be pending
+         */
+        bool isCancelled() const { return Mjob && Mjob->isCancelled(); }
+        /*!
+         * Block the calling thread until all tasks submitted so far have been
+         * completed or the pool had been stopped.
+         */
+        void wait();
         //! query function for number of completed tasks
-        size_t const& getCompletedTasksCount();
+        size_t getCompletedTasksCount() const { return Mcompleted; }
+        //! query function for the number of worker threads
+        size_t getNumThreads() const { return MnumThreads; }
+        /*!
+         * Merge the clones of the application the workers use into the
+         * application. Call this function once after the computation had
+         * finished (i.e. after wait()).
+         */
+        void merge();
+        //! query function for the progress of the job of the pool
+        Progress const& getProgress() const { return Mprogress; }
+        /*!
+         * Pin the workers to CPUs. Worker \c i is pinned to the CPU
+         * <tt>cpus[i % cpus.size()]</tt>. Must be set before the thread pool
+         * is initialized.
+         *
+         * \param cpus indices of the CPUs - empty for no pinning
+         */
+        void setAffinity(std::vector<size_t> const& cpus)
+        {
+          OPTIMIZE_assert(! Mactive, "Thread pool already initialized.");
+          Maffinity = cpus;
+        }
+        //! query function for the CPUs the workers are pinned to
+        std::vector<size_t> const& getAffinity() const { return Maffinity; }
 
       private:
-        //! application to execute
+        //! task of a job
+        typedef std::pair<Job<Ctype, CresultData>*, Ttask> Titem;
+
+        friend class Job<Ctype, CresultData>;
+
+        /*!
+         * Fetch a task for the worker \c index. Looks up the worker's own
+         * queue first and tries to steal from the other workers afterwards.
+         *
+         * \param index index of the worker
+         * \param task reference to the task which is set on success
+         * \return if a task could be fetched
+         */
+        bool acquireTask(size_t index, Titem& task);
+        //! park the calling worker until there is work or the pool stops
+        void park();
+        //! count a completed task and release waiting threads if necessary
+        void completeTask();
+
+      private:
+        //! application to execute the tasks of the job of the pool with
         ParameterSpaceVisitor<Ctype, CresultData>* Mapplication;
+        //! progress of the job of the pool
+        Progress Mprogress;
+        //! job of the pool (if constructed with an application)
+        std::unique_ptr<Job<Ctype, CresultData>> Mjob;
         //! number of threads
         size_t MnumThreads;
+        //! CPUs the workers are pinned to
+        std::vector<size_t> Maffinity;
         //! status variable
-        bool Mactive;
-        //! queue of tasks
-        Fifo<GridComponent<Ctype, CresultData>*> Mtasks;
+        std::atomic<bool> Mactive;
+        //! task queues - one for each worker
+        std::vector<std::unique_ptr<WorkStealingQueue<Titem>>> Mqueues;
+        //! queue the next submitted task will be pushed to
+        std::atomic<size_t> MnextQueue;
+        //! number of tasks currently stored in the queues
+        std::atomic<size_t> Mqueued;
+        //! number of submitted tasks
+        std::atomic<size_t> Msubmitted;
+        //! number of completed tasks
+        std::atomic<size_t> Mcompleted;
+        //! number of tasks submitted but not completed yet
+        std::atomic<size_t> Mpending;
+        //! number of parked workers
+        std::atomic<size_t> MnumParked;
+        //! mutual exclusion variable for parking and waiting
+        boost::mutex Mmutex;
+        //! condition to wake up parked workers
+        boost::condition_variable MworkAvailable;
+        //! condition to signal that all submitted tasks had been completed
+        boost::condition_variable MtasksCompleted;
         //! thread group
         boost::thread_group Mworkers; 
 
     }; // class template ThreadPool<Ctype, CresultData>
 
     /* ===================================================================== */
-    // function implementations of class template Fifo
+    // function implementations of class template WorkStealingQueue
     /* --------------------------------------------------------------------- */
     template <typename Ctask>
-    void Fifo<Ctask>::addTask(Ctask& task)
+    void WorkStealingQueue<Ctask>::push(Ctask task)
     {
-      {
-        boost::lock_guard<boost::mutex> lock(Mmutex);
-        Mqueue.push(task);
-      }
-      Mcondition.notify_one();
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      Mdeque.push_back(std::move(task));
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctask>
-    Ctask& Fifo<Ctask>::waitAndPopTask()
+    bool WorkStealingQueue<Ctask>::tryPop(Ctask& task)
     {
-      boost::unique_lock<boost::mutex> lock(Mmutex);
-      while(Mqueue.empty())
+      boost::lock_guard<boost::mutex> lock(Mmutex);
+      if (Mdeque.empty())
       {
-        Mcondition.wait(lock);
+        return false;
       }
-      Ctask& retval = Mqueue.front(); 
-      Mqueue.pop();
-      ++MnumPopped;
-      return retval;
+      task = std::move(Mdeque.front());
+      Mdeque.pop_front();
+      return true;
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctask>
-    bool Fifo<Ctask>::empty() const
+    bool WorkStealingQueue<Ctask>::trySteal(Ctask& task)
     {
       boost::lock_guard<boost::mutex> lock(Mmutex);
-      return Mqueue.empty();
+      if (Mdeque.empty())
+      {
+        return false;
+      }
+      task = std::move(Mdeque.back());
+      Mdeque.pop_back();
+      return true;
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctask>
-    bool Fifo<Ctask>::tryAndPopTask(Ctask& popped_task)
+    bool WorkStealingQueue<Ctask>::empty() const
     {
       boost::lock_guard<boost::mutex> lock(Mmutex);
-      if (Mqueue.empty())
+      return Mdeque.empty();
+    }
+
+    /* ===================================================================== */
+    // function implementations of class template ThreadPool::ThreadHandle
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ThreadPool<Ctype, CresultData>::ThreadHandle::operator()()
+    {
+      getWorkerIndexPtr().reset(&Mindex);
+      if (! Mpool->Maffinity.empty())
       {
-        return false;
+        pinThread(Mpool->Maffinity[Mindex % Mpool->Maffinity.size()]);
+      }
+      while (Mpool->Mactive) 
+      { 
+        Titem item;
+        if (Mpool->acquireTask(Mindex, item))
+        {
+          item.first->execute(std::move(item.second), Mindex);
+          Mpool->completeTask();
+        } else
+        {
+          Mpool->park();
+        }
+      }
+      getWorkerIndexPtr().reset();
+    } // function ThreadPool<Ctype, CresultData>::ThreadHandle::operator()
+
+    /* ===================================================================== */
+    // function implementations of class template ComponentTask
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ComponentTask<Ctype, CresultData>::execute(
+        ParameterSpaceVisitor<Ctype, CresultData>& app)
+    {
+      if (GridComponent<Ctype, CresultData>::Leaf ==
+          Mcomponent->getComponentType())
+      {
+        app(dynamic_cast<Node<Ctype, CresultData>*>(Mcomponent));
+      } else
+      {
+        app(dynamic_cast<Grid<Ctype, CresultData>*>(Mcomponent));
       }
-      popped_task = Mqueue.front();
-      Mqueue.pop();
-      ++MnumPopped;
-      return true;
     }
 
+    /* ===================================================================== */
+    // function implementations of class template Job
     /* --------------------------------------------------------------------- */
-    template <typename Ctask>
-    size_t const& Fifo<Ctask>::getNumPoppedTasks()
+    template <typename Ctype, typename CresultData>
+    Job<Ctype, CresultData>::Job(ThreadPool<Ctype, CresultData>& pool,
+        ParameterSpaceVisitor<Ctype, CresultData>& app, Progress& progress,
+        Instrumentation* instrumentation) : Mpool(pool), Mapplication(&app),
+      Mprogress(progress), Minstrumentation(instrumentation), Msubmitted(0),
+      Mcompleted(0), Mpending(0), McancelledTickets(0)
     {
-      boost::lock_guard<boost::mutex> lock(Mmutex);
-      return MnumPopped;
+      OPTIMIZE_assert(Mpool.isInitialized(), "Thread pool not initialized.");
+      if (Minstrumentation)
+      {
+        Minstrumentation->prepare(Mpool.getNumThreads());
+      }
+      // create clones of the application
+      for (size_t i = 0; i < Mpool.getNumThreads(); ++i)
+      {
+        std::unique_ptr<ParameterSpaceVisitor<Ctype, CresultData>> clone(
+            Mapplication->clone());
+        if (! clone) { Mclones.clear(); break; }
+        Mclones.push_back(std::move(clone));
+      }
+    } // constructor Job<Ctype, CresultData>
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void Job<Ctype, CresultData>::addTask(Ttask task)
+    {
+#ifdef OPTIMIZE_INSTRUMENTATION
+      if (Minstrumentation)
+      {
+        ScopedPhase const phase(*Minstrumentation,
+            Instrumentation::Submission);
+        task->MqueuedAt = Instrumentation::now();
+        Mpool.addTask(*this, std::move(task));
+        return;
+      }
+#endif
+      Mpool.addTask(*this, std::move(task));
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void Job<Ctype, CresultData>::wait()
+    {
+#ifdef OPTIMIZE_INSTRUMENTATION
+      std::unique_ptr<ScopedPhase> phase(Minstrumentation ?
+          new ScopedPhase(*Minstrumentation, Instrumentation::Waiting) : 0);
+#endif
+      boost::unique_lock<boost::mutex> lock(Mpool.Mmutex);
+      while (Mpool.Mactive && 0 < Mpending)
+      {
+        Mpool.MtasksCompleted.wait(lock);
+      }
     }
 
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void Job<Ctype, CresultData>::merge()
+    {
+      for (auto it(Mclones.begin()); it != Mclones.end(); ++it)
+      {
+        Mapplication->merge(**it);
+      }
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void Job<Ctype, CresultData>::execute(Ttask task, size_t const worker)
+    {
+      size_t const size = task->getSize();
+      // drain the queues if the computation had been cancelled
+      if (task->Mticket < McancelledTickets || Mprogress.isCancelled())
+      {
+        Mprogress.discard(size);
+      } else
+      {
+        Mprogress.begin(size);
+#ifdef OPTIMIZE_INSTRUMENTATION
+        Instrumentation::Ttime const start(Instrumentation::now());
+#endif
+        task->execute(Mclones.empty() ? *Mapplication : *Mclones[worker]);
+#ifdef OPTIMIZE_INSTRUMENTATION
+        if (Minstrumentation)
+        {
+          Minstrumentation->addTask(worker, size,
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                start-task->MqueuedAt).count(),
+              Instrumentation::getElapsed(start));
+        }
+#endif
+        Mprogress.end(size);
+      }
+      task.reset();
+      // the job might be destroyed as soon as the last task had been counted
+      ThreadPool<Ctype, CresultData>& pool = Mpool;
+      ++Mcompleted;
+      if (0 == --Mpending)
+      {
+        { boost::lock_guard<boost::mutex> lock(pool.Mmutex); }
+        pool.MtasksCompleted.notify_all();
+      }
+    } // function Job<Ctype, CresultData>::execute
+
     /* ===================================================================== */
     // function implementations of class template ThreadPool
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
     ThreadPool<Ctype, CresultData>::~ThreadPool()
     {
-      Mactive = false;
+      stop();
       Mworkers.join_all();
     }
 
@@ -298,28 +892,140 @@ namespace optimize
       // set default value - at least one threadhandle
       if (0 == MnumThreads) { MnumThreads = 1; }
 
+      // create task queues before any worker is able to access them
+      Mqueues.clear();
+      for (size_t i = 0; i < MnumThreads; ++i)
+      {
+        Mqueues.push_back(std::unique_ptr<WorkStealingQueue<Titem>>(
+              new WorkStealingQueue<Titem>));
+      }
+
       Mactive = true;
+      // create the job of the pool (clones of the application)
+      if (Mapplication)
+      {
+        Mjob.reset(new Job<Ctype, CresultData>(*this, *Mapplication,
+              Mprogress));
+      }
       // create threads
       for (size_t i = 0; i < MnumThreads; ++i)
       {
-        Mworkers.create_thread(ThreadHandle(
-              Mactive, Mtasks, *Mapplication));
+        Mworkers.create_thread(ThreadHandle(*this, i));
       }
     } // function ThreadPool<Ctype, CresultData>::initialize
 
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ThreadPool<Ctype, CresultData>::merge()
+    {
+      if (Mjob) { Mjob->merge(); }
+    } // function ThreadPool<Ctype, CresultData>::merge
+
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
     void ThreadPool<Ctype, CresultData>::addTask(
         GridComponent<Ctype, CresultData>* task)
     {
-      Mtasks.addTask(task);
+      addTask(Ttask(new ComponentTask<Ctype, CresultData>(task)));
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ThreadPool<Ctype, CresultData>::addTask(Ttask task)
+    {
+      OPTIMIZE_assert(Mjob, "Thread pool without application.");
+      addTask(*Mjob, std::move(task));
     }
 
     /* --------------------------------------------------------------------- */
     template <typename Ctype, typename CresultData>
-    size_t const& ThreadPool<Ctype, CresultData>::getCompletedTasksCount()
+    void ThreadPool<Ctype, CresultData>::addTask(
+        Job<Ctype, CresultData>& job, Ttask task)
+    {
+      OPTIMIZE_assert(Mactive, "Thread pool not initialized.");
+      ++job.Mpending;
+      task->Mticket = job.Msubmitted++;
+      job.Mprogress.submit(task->getSize());
+      ++Mpending;
+      ++Msubmitted;
+      Mqueues[MnextQueue++ % MnumThreads]->push(
+          Titem(&job, std::move(task)));
+      ++Mqueued;
+      // only bother the mutex if there is a parked worker to be woken up
+      if (0 < MnumParked)
+      {
+        { boost::lock_guard<boost::mutex> lock(Mmutex); }
+        MworkAvailable.notify_one();
+      }
+    } // function ThreadPool<Ctype, CresultData>::addTask
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ThreadPool<Ctype, CresultData>::stop()
     {
-      return Mtasks.getNumPoppedTasks();
+      {
+        boost::lock_guard<boost::mutex> lock(Mmutex);
+        Mactive = false;
+      }
+      MworkAvailable.notify_all();
+      MtasksCompleted.notify_all();
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ThreadPool<Ctype, CresultData>::wait()
+    {
+      boost::unique_lock<boost::mutex> lock(Mmutex);
+      while (Mactive && 0 < Mpending)
+      {
+        MtasksCompleted.wait(lock);
+      }
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    bool ThreadPool<Ctype, CresultData>::acquireTask(size_t index,
+        Titem& task)
+    {
+      if (Mqueues[index]->tryPop(task))
+      {
+        --Mqueued;
+        return true;
+      }
+      for (size_t i = 1; i < MnumThreads; ++i)
+      {
+        if (Mqueues[(index+i) % MnumThreads]->trySteal(task))
+        {
+          --Mqueued;
+          return true;
+        }
+      }
+      return false;
+    } // function ThreadPool<Ctype, CresultData>::acquireTask
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ThreadPool<Ctype, CresultData>::park()
+    {
+      boost::unique_lock<boost::mutex> lock(Mmutex);
+      ++MnumParked;
+      while (Mactive && 0 == Mqueued)
+      {
+        MworkAvailable.wait(lock);
+      }
+      --MnumParked;
+    }
+
+    /* --------------------------------------------------------------------- */
+    template <typename Ctype, typename CresultData>
+    void ThreadPool<Ctype, CresultData>::completeTask()
+    {
+      ++Mcompleted;
+      if (0 == --Mpending)
+      {
+        { boost::lock_guard<boost::mutex> lock(Mmutex); }
+        MtasksCompleted.notify_all();
+      }
     }
 
     /* --------------------------------------------------------------------- */
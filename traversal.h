@@ -0,0 +1,166 @@
+/*! \file traversal.h
+ * \brief Non-virtual traversal of the nodes of a parameter space.
+ * 
+ * ----------------------------------------------------------------------------
+ * 
+ * $Id$
+ * \author Daniel Armbruster
+ * \date 14/10/2026
+ * 
+ * Purpose: Non-virtual traversal of the nodes of a parameter space.
+ *
+ * ----
+ * This file is part of liboptimizexx.
+ *
+ * liboptimizexx is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liboptimizexx is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liboptimizexx.  If not, see <http://www.gnu.org/licenses/>.
+ * ----
+ * 
+ * Copyright (c) 2026 by Daniel Armbruster
+ * 
+ * REVISIONS and CHANGES 
+ * 14/10/2026  V0.1  Daniel Armbruster
+ * 14/10/2026  V0.2  Skip pruned grids.
+ * 
+ * ============================================================================
+ */
+
+#include <optimizexx/gridcomponent.h>
+#include <optimizexx/grid.h>
+#include <optimizexx/node.h>
+#include <optimizexx/indexedgrid.h>
+#include <optimizexx/indexednode.h>
+
+#ifndef _OPTIMIZEXX_TRAVERSAL_H_
+#define _OPTIMIZEXX_TRAVERSAL_H_
+
+namespace optimize
+{
+
+  /* ======================================================================= */
+  /*!
+   * Bound function pruning none of the grids of a parameter space.
+   *
+   * \ingroup group_grid
+   */
+  struct NoPruning
+  {
+    //! bound function
+    template <typename Cgrid>
+    bool operator()(Cgrid* grid) const { return false; }
+  }; // struct NoPruning
+
+  /* ======================================================================= */
+  /*!
+   * Apply a function to each node of a parameter space skipping pruned
+   * grids.\n
+   *
+   * In contrast to the composite iterators (see optimize::Iterator) the
+   * traversal neither allocates any memory nor makes use of iteration
+   * mementos and strategies. The tree is walked recursively in the order of
+   * a optimize::ForwardNodeIter iterator. The function is a template
+   * parameter so that the compiler is able to inline it. Per grid component
+   * a single virtual call (to determine the type of the component) remains.
+   * The grid points of index addressed grids (optimize::IndexedGrid) are
+   * visited by means of a flyweight node.\n
+   *
+   * Before the nodes of a grid (including the root) are visited the bound
+   * function is applied to the grid. If it returns \c true neither the nodes
+   * nor the subgrids of the grid are visited. Since the bound function is
+   * evaluated as soon as the traversal reaches a grid it might take the
+   * results of the nodes visited before into account (branch and bound).\n
+   *
+   * \note Grids themselves are not passed to the function.
+   *
+   * \param component root of the parameter space (a grid or a node)
+   * \param f function (object) called with a pointer to each node i.e.
+   * \c f(Node<Ctype, CresultData>*)
+   * \param prune bound function (object) i.e.
+   * \c bool prune(Grid<Ctype, CresultData>*)
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData, typename Cfunction,
+           typename Cprune>
+  void forEachNode(GridComponent<Ctype, CresultData>& component,
+      Cfunction& f, Cprune& prune)
+  {
+    typedef GridComponent<Ctype, CresultData> Tcomponent;
+
+    if (Tcomponent::Leaf == component.getComponentType())
+    {
+      f(static_cast<Node<Ctype, CresultData>*>(&component));
+      return;
+    }
+    // each composite of liboptimizexx is a grid
+    Grid<Ctype, CresultData>& grid =
+      static_cast<Grid<Ctype, CresultData>&>(component);
+    if (prune(&grid)) { return; }
+    typename Tcomponent::Titer it(grid.Grid<Ctype, CresultData>::begin());
+    typename Tcomponent::Titer const end(
+        grid.Grid<Ctype, CresultData>::end());
+    if (it == end)
+    {
+      // index addressed grids do not possess any children
+      IndexedGrid<Ctype, CresultData>* indexed_grid =
+        dynamic_cast<IndexedGrid<Ctype, CresultData>*>(&grid);
+      if (indexed_grid)
+      {
+        IndexedNode<Ctype, CresultData> node(indexed_grid);
+        size_t const num = indexed_grid->size();
+        for (size_t i = 0; i < num; ++i)
+        {
+          node.setIndex(i);
+          f(static_cast<Node<Ctype, CresultData>*>(&node));
+        }
+      }
+      return;
+    }
+    for (; it != end; ++it)
+    {
+      if (Tcomponent::Leaf == (*it)->getComponentType())
+      {
+        f(static_cast<Node<Ctype, CresultData>*>(*it));
+      } else
+      {
+        forEachNode(**it, f, prune);
+      }
+    }
+  } // function template forEachNode
+
+  /* ----------------------------------------------------------------------- */
+  /*!
+   * Apply a function to each node of a parameter space. See the overload
+   * with a bound function above.
+   *
+   * \param component root of the parameter space (a grid or a node)
+   * \param f function (object) called with a pointer to each node i.e.
+   * \c f(Node<Ctype, CresultData>*)
+   *
+   * \ingroup group_grid
+   */
+  template <typename Ctype, typename CresultData, typename Cfunction>
+  void forEachNode(GridComponent<Ctype, CresultData>& component,
+      Cfunction& f)
+  {
+    NoPruning prune;
+    forEachNode(component, f, prune);
+  } // function template forEachNode
+
+  /* ----------------------------------------------------------------------- */
+
+} // namespace optimize
+
+#endif // include guard
+
+/* ----- END OF traversal.h  ----- */